@@ -0,0 +1,7 @@
+Uq^jwx{1O!O7}*[B.F\j5^$©@6ih76gqj=( FKVwA8	1WQvI9r#ʡRLѝCxbq#0`0)ț..jٝcCEʢevt	#?b($2Z+8Cb!j$ŭȖ%_Bc]2NJ~,;~UzU8jBܪW:gC\kGmT}3Di8?!vtE8gRƕ&@zn6!N(l?XnGbw!67ExaKCM4-_Ǟ0q	u]+/
+ē!@ nKJϛaițh,8`8k[@_"3(@nz:PvL'z6*~XV	D*cOF	T?'xNjO5f#n1>9yig$>I[㵴Q՘"WM>l5lJ-F6d8I2_TOti<I}ŷ-Kz٥<>XD^.΋ΧN.!%%	1JFY69KE*ej$pםfJLyT*#9bOV2J+'Mֽ| ,91Nmpa@MЖm>
+jN[)7H1bI
+N Y4L`_~Cr NpOmĨ,Utؙ+_T7W8%LǨ^]^%#uEӜHIK\gvqeQYo!indɜL4#?-t\<+Vod6bB3[sw/~Uj
+I1vTP˦J(N04DC [1<Ӯt`>EOh*A:_3I ^>`b`H;;oy:\0?݂7_a[?U4=zjr 4KP˂,ȼN]U׵%UXAelt[}]:wZZ#?Q#D?rO;LI'-a֪o,?V-7E%g%Pj˯lڦ:V)Ӣҵ]87,)R'1D&ƋuWcylitW{Nʍ4fIs9~Dhe{BFPF1S{^3~#+WetP"¾.3{ȢUڽ:"#7_Y@cu*)ʿr3ģM"q.>|̫%
+ G	0xQ>O:##\zbvĥ,d"@;̸v;Q$LTV&!Gu{"ҁqe7bd(RGZt2,!<WT:dj)5Pvftl\A>??U:zWOҨeW@u
+gfpBзvgzf}m;"A|5OEt4	ą\pq	g6Hqsf_TYw@<FDz523JErlU Yssᕔs-vr٦r=z+g7 de_
\ No newline at end of file
@@ -0,0 +1,8 @@
+.OLYXQ(|7ya/UBY쪔K@ƤY&$Be5sa$e|`7D? n5wvtlhG#KO`ͱ1Cd5RaCl8oTqgR9Tﱠl/HJ5DiP>vB)'#~|'GMiho3s5ɑ1*Ee7-az3ﱅ/i;S;	ѳKG\:}Ñ*g<U%j0򊨰"&U#|%֦k_) ر<2SLry(y>$JZ"xPuHLDsz؞%gk4(#iauٔ|XQFݔGl`bEڊō+שs]IH
+Sk>Ͷ#?WP^4C	IA`/}lx_'yR7VkiBgnu8m6%=id3hЉ.	#xGNDEfvRCfzM͘ND=o ͒GB?k]aRF
+;oPwFϳ(&Il^3;tdE|-\v#*rTrE"-GP?77JVX<u%!=7"kۧjà~sKUc3T4^5#Wn7aڙ!|/<͝	
+PX Qg฀2-ּh}Ѐ`<&pτh֏"p$^4q]{!W"Ri{C;Ĝqx1fpG;Si ;ۣǭIԘ*Xky@[8=</>)6%]>=jG:99 uuPNR*{1yXSÜu͔ryxX a"/bha֔>IY̓^Ne^L^9uS+)v"ok.pW9p$/Qr?W.3+e0Z'p|.>G<l}gP{ Ѕ})\yة`̵l.l#kgI0ͮupy2SyďŘU^mjMkA٥*/mYR	s$*~uX(7	ᓧ_i};x茁t^t\5g	3
+j|aMk[%+L{V9*zW7+q#=ߵd\V\'Gp%uf9^|	^Wo}GM6`1K++\EP,ob=K7|.՟xŸ	c0V.u>}V3g
+8H&Ԕť/!׸,WY$i(86JHˤvBgu4rcR ]WZ1&,fTSt"̾.V]ЯdIlXjEjcn5|B;1|̭ΰz7/[Z@UXe^\3|eg`"FA`@HJW؝u*_rדX"}7bi5uBJ69#uHG$/c%*,e_<$xF-*f=AaV/A
+u5Gի̠O_n?4)F%oifho	8nte/r('QP{$ڦ3zA6SMIEr`տJbO@JiwԊ5,[meߐVTMX'6366<V0Q{25\aaKe}Ml<I>Ъܳu;l(ȱ|	@İ\mNmApJK: Fe Yۼqjv2,Fֈjʡ*cfĘiUwlL'PD	L*K@syoq)[Rw([(EKP)6XLР\)lzΉ
+Ԗ=-EYEZ3'4(hk6[*I1͝*Ε^>~0R:iaXWLߟfק"{eOY%e}=9_ʷ):f-{7E]/("9PbTj1Jnoբ=/Kx}`~8ϖ8`ٔ??f<dП7TbGYr@.մ;cU?9f
\ No newline at end of file
@@ -0,0 +1,8 @@
+"}rcV*w+e0)/ELwGihIpTPkQ*MS%%w>| C}/e$"WێӹLAOh2I$dOͭw?q-̆#нzOܢSM1$#wb07.P&aЪBL>5Ma5;e¿wq-sX-ky9"33"jR]uTX:M)]EUP_-v漽	~!~2]ʭ*L6fnv1O@;{_I@z|kگQ[(OМ=?fDVtIMN	E{^!3`]1v^B"/dC,1D.Z@dūcr4|y$EռIaDVժws_	6Q뱪8>Wt@@F\.れ!|<PGE<H9ѐt@yAדBσ#5Ly
+r|q^Ҹ5by%<Ct[}KFAVE')['jDpVPbUhbYk@sЛN#"8ȹ!Aa֖7s4Knڲ6)t8jы>~(^
+	Y=J^ԬG?ڇA_5?hkYV9^iS&<#(}I'(#Tq[,՟/RguGt>7=UN7gHh@~U)kX؄P<J[:-_`Kr{GO{v]LZ@3RY\b	^H!S-ٵ0k߶XiyPt;{Z	$U}-Ogy2u,`dR1QT|I;FjUr߳З~;"
+.n&j7X{*hod~]ymތBc|DM;<Ѫ(`ߪp0s)'V(ct{٨ehק!J-vܢMmI`9q21w9AD"vPdKd/cbQIz\2Н-h6@j3x<jbMeW;dWXQSں7LHƹ[]E5GpEʟ
+||w|yP\=a46<*x{X<9Jȟ!-2l,T`JELtə]6P%Qd0}Q_nvֿzx5Y_[cͦSHBC׻S8@G"_;3 B5V#ΎiC&ЀTJI;y-rh>?F54]5@Єr4XAawU@2Y`MTu-B&:q.Q5=Ț"#(;엾N(HBUTq9x=>3كߋ*$B\^2u_CeNKdrv1^#}x2W0ѷx[-j𣥚Q!U]8N($4h4ۢfBoS6-..:\9Py8AUw428/aoMXv`Pߞ[#%g3۠Rfxm7#diܓb#'RVAJb0:)j4l!N/8[Saٰ/R0_֟SpYaI!ol49ˆ#c}1E4߼ZoQw*#&B!J2~y,*W_ZjǺ&`>@O|gn@9?(RDc?9^'j~>ZBv͌-owjcn.	<ӌS^4@ÉHn:}Y"VM~2^+6'㶶N٧,LY>N]%briS}/I%C#FKo%]4feCYN$D-Hu\ i뚌Nk!	]Q#Q'zr(x|=hّh1E.zk,}58yRZ:Y',5zz?(XKd@ӮTy6NV2L>it	DWF㯾8>GzlW3*V.VeK6윞ݓ ]#7.i(v[	i	'o>Oҙf;eiva?"Pč3V-VsouLz;R7
+mawm'z4$(Ux3$ᝦE=p>e${^G
+v3U>NB#y_jCW%ꩻPRXU'13:,.o{ErPSs*nr$G3߲n̳x7H/ D͂Յe|;'mBY{p1mV~ƟnNYJ(m!!ʻ۴=1mb'1B(6B8HE:xGy,¾TSZ e v(Z^:i;o2jxL\~{(?
+4㰭"K=U$"vAS?}2?'P?ϖIp6i->/JT}#5 :a3bUYl7,Y\uSQQ%JL^8Y;dv͖ߜBdzԨ6zQ~<NfWؿ}.𚵪A"[,sES<<8pT,}
\ No newline at end of file
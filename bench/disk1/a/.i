@@ -0,0 +1,11 @@
+../)m:I$dRB,?QxA^[e {T6zRu)?(ˀ=b+6:D/Kq5r`~1@|P̼B`<6KN_rXlb9yЌ7Sab5{UpFNsfj,"EqNiU2r7Kkגz/EdcDsi;L'kjǔE<|3ExIWfy !{ٙ)ǨnR;`(:|r$1թz
+xՈiu\у"m1<RJ|C#`v[?G6Jhc"ϕUUFEpt*fE^iiJNK>AԲNփ>NeHҦtf&ωRFjqiXH^z!p81	L5DjWLwS/̋<ؤG8^m:PM'G֒Wg6sˁVfa;Е'W@&K@K",L0^F=AslOo0UYC_$Vx1"Ƚ$5H2bhrՔbk^{oQعVFPzK(k{VB~o=̶nV}:nt)]R	VIu&~ۺm^vykOD!qc0$Βi"_YQҞvШD5V-.RS̅[HbASĻDhvP	O1prYQ.Q<wR2SG!7tOTE1̡*X!2ȺJT:}$p^JӅn5hQn@\}*$,tܫ3yM~޺,3iaC\-i>17O{qaH:@5/}vffM6	ɜL]HXb:1}D߀M8녥R>$!>ws$_Cӣ(8j߼лT~{I1M;~t"> x*PXO+'ejFclw"
+vTTd]+H,r3J4*ס+:νɲgT	{3Ȧ	<rs:cnH0P}![7f>9}(F
+.^OvT)p\XD:Qm՗}z&iQʭ
+I`77r0)R$E]g:!!AC[gpL@]Xj@O+9dl*39NT56PC)aI+C).u&~hmMwT'91oJ=DrĪ+>hN}S0NĠUU
+nط2Y]̗6uN}s[jt6D?i*eҏ査2ŦVa@t2TgLw^`ڎgΓh-|3(_F4"{ĸMTר9.Wa<'ƺ4O[{xREL{:~'cmuȂ?Cτ;GF_x:;M2)J^|tH#e@$2*@׿X:Z8zY(V".4w3%/ ?}DNmRf\[ ʞCXmf߻A!|%*ݮK0jJl}V {?~zB2`-DzYgصsj|s]ɮt{<<qՊ=-WAJ!!%Ǭ|%켂Ưʹڌg	jDL;8FS6ƚ=4K?=pGAqeO,HյxU$yR,u7KU2_m{PwUZ[@l:G0OM_IXGEႍ1-81vYTҜ4MO4ǘ `G'\}$ޓ5zoF΃㪇SXM:"e $[] 7p{0{G"+R_6+NI`r$rbND=m* :*,f,L/KsNCʢE)82QRX,҂"p>pf}~m0xRa}רRq#S`?wA4X	G .YTQUKs:)B4IFpAW;5AO4ȃ˒Ŭ;1pfKN&趇ALkahq	)R㍬ze,SBݩbq{|.pX{:[.$j_ù]՟԰$b--g=ORC.ǝmJ5yēWgׇSl$hfN0f
+p+z$y,h3;|S^KkGSa1ɢf
+z b:łXĒP{&J*<G{&Ln癎%b;xv$hڙE6c>bw.k_3ɏ{j+tNOzف\RxLfDwZvd;QhvFZËʬkɲ#.M/Lc+j\'4綵oB89^}0|C8e	LaY3(O	$ЛA"ʝk0(Fl*TsuB&rǨn+SYS<yW-w?8*l=y`)?=)(YɗqYބjR'7Olj$'nф;	˴tlvЗUB\
+~P-Ca0{|t$(]^ D'b9}?!sk7~4m)VS2wRTklnаDwwܒz[h7*S/WT4+]Yw_X.@F~JL'\hzLr8C^_D@FAB>qۚhu	u2h_lr?MzZ|'{Smw%ǹ͕ JJX;\oP~⺈
+Ôϙ҇i9P]f%pswcw|
+:1QO,]Ӄ!PY?tiA71;(gBnibL+GUzt3RBYX!Q[RHH}=Gjz?j!4	eLyT'PU|=={0x( Ut>= J<nùߥ(
\ No newline at end of file
@@ -0,0 +1,2 @@
+gj4#U_dW?`
+27yALᚥ0ӎ(tWQE:]qyqpn'Ե^o|%ՅsǓwY`/v$čM8=.YS|H~oe-Hxh=ڶڬx.k '{%b&-fT\U fq.fxh7-$ww=+\F"mX/#͉7ab~!$@J/;Z9$6[A
\ No newline at end of file
@@ -0,0 +1,11 @@
+*6o>{xj]chS"ȤX x@사s*A1:@PQWkф,I)$i9hzKX1qUYw25[rn)m&[V١C%giqSoV(!M\$ukfzǬaZ]Kd~ݒM<z.COf`Ln<̩`vB톹K2XcGs:S8F+SMPI251fņ
+dCA9dGS%;}3B}t&'7?\ ȻߢoKTwl5̆H"r#c`7dK5wl,VS(Dc`U[7O1ށ=sX#},{Wgy0KrI'+L7ynU:DM1Bϫƿ)dB`q0n0XkmֲS
+!Oرǈ\Xv;=}wA4w״VķO1u<)Șˤ9RVY-X`$mB
+BɣTyJn|U	ױJ@iWk`l̀:p+Q%:ʓǏ)|n$ěKcNFGyZLq}L_-8wr9(5-#4c}ADF9fo"Z}`Kw1%f=aإA,+{A0'1IT?u?O&S^(9c3Ј"#T:*H$]Eo4Oa,7T]XUzYz=pr2PEA!CZʥ侾[?.jwmu)-	=#^᧪&~וeZz,%a55!Wev(sTqS㓇岙//#M@ޓr_u )7wcq_ fSZH9@}jx.sP;)66BIPr"moMkt$Y0a"o|hkWUGKu/oR;CYIKnظL^P>ӡ1KBY %H>qa6}z>aV=ˈl8Rh70ӮO<,ԥZz9*H|ʤ3l9׹̼13c b$ſ @r;[܋8I
+>%昃Qt3p"Cdy	zx&O75u0k:S(zUιj/ DbRcիy
+9нdG
+V	h;%hKp0iPUqO
+
+hs2|EP~>mG?@ 
+' T*23(\qjyT,w
+:LښiqJ?o0>rXWhDUCu߸>YG˛:0dm`[w4Y#F/hKTiY?md$窠?y4X>'}i\Ytшtcj:t@4:8xسxٹb{YS88w;Jկ T(.#E)G'r݊Z~k/fU^:q.LsJk4ZWʨm\&jo<TVrɦȬH8ۼA>v*_nq[3	7\1V}Sbo&Hrz#",hxh+8mUujKzrZa$&53D}#F&]6:ϯQ׭bbG_H
\ No newline at end of file
@@ -0,0 +1,17 @@
+_	p<Ҥ!3DCjMF$3u:;bumfZ"N@T8MS%5"ej&!SOWtXa)`YSpUS2]6JB-%zx*ewO;!9뻝bN,*yԛV["ߐ.Ā3Kgkɚ1鮱!8^㏯	:<^&2z?ocJ艆Ztf#w]Tϒ7+f\vkJeqg_Rt~?
+?>~~J<=otΦ
+w"wQزႛ"Xy<S,HH\ovi+K.ybwl2|1Lnn}kINe#2n{Br[.x!Yh[#ivovY 1uj_M>1CNE wuJS[mo˷;rp
+smvQ1ōߵGAj/==ϕ:b(qm
+AS;\0y;l.ؠh(0uhVPEgc1<^oj~8H'AM^ 礢jiĦ@4fpA#J4m;}'X?O~:0voJ[X6'&)ߔOf70H_k*Yo5evۻb49\G,])}:0L5$e/kU3l
+`:v4>l2[%ҷ})rfI1DJȱ^W#pőDxY	FM14V퇎w는*}zC: T+_Svu#jY{Lp=cΪ|:Y5A%׺ݐ=սmH<dQ$]- D6ҟd<}Ѕx&$Aq)DK
+m,J`ϫF!| M;>tcZ쳋pCV2@Kr	bHtӣV6dK^Y|}:"i$;<>'=y}o;'gbiܔgԜ#.0^(O28nŀe}+yZ+SRS4OGBkG	Asȭ	葑h4Ͷ2r?BqZ :Z~q/?(gf^!kҵb}]u}z.oXQuROJ=6B-uXO}m6Z6݊yNLjT3/M5?~JKqi_Vp摭%ݹ`&{HlwB?ndbIAOAtt˺A*h%Z`:*BeS4p+dQGt<ɝpyjO|6YT\[1͗6CHRDy%:dIr[딝H{H4K='`F`Ak	hI2wO]/_2-Ip2n 3EY{2lHY@aF]e6֓cɁ!7_oWGfUm+A?KF:;IGF0< Dmpf.5䳅D8FOuJC~EBA~8Ǽk1c|y$٪\sga-|/	] 
+A-`0a?0O3ܱo&x`I*VT$tDje=	
+Ma>qC)x34n@[ɝq![eY$q<TTC1HsJ\R/ϙ
+H.#)Afsq=]Gm1R*W(ⓙXOAO@hTBgߣJSx@=H<u47üߊQ벜X|CſS:Ot'9Wy<=::vd+wiB..i12*Z0|AVv%#8}=[pu9a^mrh-k]t}iZ4}	28V`W7ݹB=v#qASqlsOfsrPa|nՔf)* D6nx޿LZެ7B	b9A{/,}^;j.%62S#Lg?޴K<<[`jBm`%^nt}[J.2	-(d&(?6I`dfwC^Jy7NZnAȫQ-4SqtdcfH?"l3}g<ajl3&<]󲖙ANTɃ[mK*4
+j/q1u.9lXڼcPkva۱=H7&DZ$@h?S>҃"yКP4o]	#I3b-Pծ|OI?YfK֖Ļ-H;)	OYʹ{[@'F{H̓A2P>..Y.~EHQ2I;Dj
+0XHq9P"ͷ0fK7Q_A\DgߪP$}KmѵI4XNж|/!l[LJ#P1-dˑHMStD7lqKUXg=ej&GbKMacNЈˬňy4K@U"ܗb}PHFYKn@Tsd:JmpoY8WD^%~<lK"j?<55Bk^]B蟣fr+aYQQU/-p)̔nREϣc!PG3Rc^ͩ!I-Ĭ؝Io-x:苆7]"z!LJ<æ^>>
+^,
+4u$(LCT̙X.CmyUh. Cfw4\@v'<ŷ3,ڕcy$pv߁r/,&M+椊^d$LFn|[3RFjYS6gnY߸v{r:QY%OUi\or+vQYim3*)j5-,H\g=-e&`LkU,k*<ޛNt_ax\	<^H;>ׯz=ʜ7}tI1GQ]p1P,J
+oʎ	HaaYvS+^d+l55
+P}e3NvV
+cjZ_[_RF,eBQ7s`Co66<G]:P@H4iEb)yUZvqF8tS8~`~KRKP^ԍy)=W<)'ru񔅿H}ռf*+|+5X'wO+c%#CwA&ԣW,̹xPʠG6C/XD3DhN ⟘JT7A\'	P!Қ.߃~l~o,p3eTj8~S`fK/%VMV">x?|6s*x<?h
\ No newline at end of file
@@ -0,0 +1,3 @@
+9o+ǋqܝXA0]%dEZ"8}0%7RE#=-1YL6LzA_Hu	yb1A8vPm/ei1~J?@wLiFɰVҶp:gPh*!\˥1`F"De2
+8jn)k'm*('Bg?Cu	Åк<S`
+ .zQGhYE݈l'Z$Rsi1`C.j⬛P+f	tFӛx&Q52B_k߱s~}Sn_#۾	']EijȽgSʋW
\ No newline at end of file
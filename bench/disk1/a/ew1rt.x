@@ -0,0 +1,14 @@
+v#:PL:7CAU/@*AijLtE_ww''H7qZHU{z¹ل(+톴0J[d^Cζڎsp O.G89vK>st0ҫO[=Hcv[i+"i3)EɿQڳNqXϳ{-p?A7`G'Ŀis?@Ͽg31O4&Yk'+䟑%LB[]}5G8򻯪R1*')jOSȤ(vNH	,nkkP)×kۥmV9ĊW|Z='XFE'),	@N)SMӺ뼿_5r)PFYF<_R:&ZYlu!a@f vEn,5\j/5՘W7	!d@pLSz7
+>54rJV«+HR'4oILx甤$.:b S,ζ+aD_dNSJY2g\j:i5шN<x<>.OPW؈K޲%AJiY᲏Ϳh7;pe0k;JoCk%jd`{m*/)zt"!6nՕ-GpmEu>uRO)`H;3hڻZ][NLA0@U_PGogxxX{1蒦
+Q)zG1ohDŽRϩ8nC52փ^̤:aTac3Z*xܑ;Y9(X+A?ZuwK]rpN{BfӤdJݢ.?mulDxcI~Kueu-WrթN=Ϙf?Y'@VF"ta7W4߳q"GS@לKijp~P.-5
+	
+(5
+\pB:XsL		dڭ(l׉	HƬ֋	qscuiXLm	9N16*Ј9?)'/݂yEw{*'Xu!WxM2ޑpm:mY&}E˱=ޤJzo.TʹPѱ0=um'8B;2Y`Hi("Qc{ȓt;|$N6Y4lI}GsKSn
+[#=LNr_ZR$8[>z1U/=NN9]z#ת{!uzQ9SYBscg53μÃlw&	+:#UHࣣdɝEcy&eW"jT930,wL01Wꔽ@G6@cI/d|h-Ig&IW8^0[wAG,4ɲô:n9
+geSo`=f7F8(d+(Pyg4.f$ϊ8NuvK3<&I?{m@7B}?3h^
+?I^/F:
+\a=@eL=!A,8wcUE^%xgjRLS+8Ѷaݤf|28^seW<Z2~MZ]SwJlͤɶ (t,>יX҉-"jrR씇=SzO_xH!`N]OyFA>Nj<[q[}׼a&E=(+Lv8k,(:^qC=N2ù뽐cU}9re^|rUa`	ĐޱHZ;@_@~Uy2;n]V|1'b
+s93䉹Do
+ĒEv8PNCĒPς
+|'Z[4l@]V'Xm
+*ΪPYu1|!M7J	y!vn?_\ߌ!avF*Ɠflnk*CĚbư!B_Cwi_0
\ No newline at end of file
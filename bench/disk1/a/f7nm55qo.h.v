@@ -0,0 +1,13 @@
+R`]0d1B+U{snf~xdjLKM}
+mKҙ3~Iu~bP=#dìƸA{l.^`a6dBWhWک;/g״JlX&\gfrSV7" W>q8Dyq7ncր9LnSe_KEW`Pm$1K>n\=Ԃ&:)+E$p'W#*hׄ#g;c#dk_%|[OORI'OS+gtZ4M0-˄}a贍|87;xs{g=3$V=
+Z3<
+NTЀ/En1IeK, yϽu&AŒ3u=@Rn7y2'!DPWӷr!V2¤YHrًnp|U0)lxϫmJqq.>n~qkSfdF@yX?n;;GC77WSRеy>s,Oc8|5w!o<\LLb|h-|.w.*L(Cz,ZMRؿ݂v4K\IkD˅`M<pDUGu2Mα7U?0{ZTfZ|_ϴb(c1r~˔xsz/N@tn\%ڴ*!ëRF1ATc\6k^c~WvնVP+w-آnt:etg4EԵ<,Ս)E5˧ROI9:jř!/3B'Qd@Dt2RQn)^;P{5B#gks݇쓠u(>\m߭L+mq;)Igu4ΜkOp2InQPQéJc*kY\D4km4=85sRD]쾵J@kg7iFy.HGk^p+X gU!W)|_;x;ЕҚ{	0رxȳɼtT}wG.]6`WU&K'<WRO*lא];$X&^;71P5lt>u`6tc\6S `H/"cJ@.\1')Tþ,MӬ
+LՕ
+2)oj*DɏZtD'O!8ajfnX?]eF0G&FJ5oǫUj!zxwPk5pwmag!FWIB*ǮﱺG̟]Fv%׮	q
+*Á8ZvR$ŭHc4<óPҷ|Gchʔ)~廝Xs)YV#.ᣕ~L9X)lPƠ_s[qaY)J~clR~/!cUTe?myV*]5Hw&M1txd9ϰJB?)|Ӗ3OR["2+qJo:ܑ.aJ
+ůބ!UPA3g/!$W1ӎ)^y<.fK̗sR`Hka_nY
+9w,ֽӒsEx%&{F/I7`Vz6'\u՜DOWLe5oL.[oC
+~"ِP§}?֘f_./r	6X-klҰ,-vVF0Jbubu\:dL;ܑ<n0h<U2îdj݃l`On0[8v6:#JN'VAԟ+f׿̔$7eLTN4l9 q ^MDKKFVnV,{zLJ9.6>2N/Õ_ucEl~0Y[K'zrHlٌ'!dւj0x U._<JH2mgg<{PkVCv@&ho]nN&f^۳GK#	}B75}MYro}RG-T)QRQZP-"kGP˕^B7svO:R'?M#f/+#Ց(AF(m6aﳵXKm]䇛Ywt;U՞*QaACVMSyqiWAOojFަ	]7a˛hj0.Wkk<)\`nϣĵ.}beRnɛݗz P,w{DN?s'1-ԣ"!XpFԢPxTfz[(o.ßT@l2з-c,kغ^ c
+O^!@{`)9[(x4÷Vܭy8C;vdH|RqKr(Wdպ,DuN:JIY>G$>8T(_G|s`GgG"<j|IE.KUc0{s2V}]Ja~dKw3w bK@Rr.7X{ۓ%z-l-,9ʣծMA:xq׷+J5- uܰrK1u
+k<Z~spA-eD+r]'/l!T<8UUm,xE #ԢKKgbN 8J+X\sYW6oqvݬ$Ȱ`Wd
+i/]6~YlxtC|TiQ*ISQw乧qՍޓi-Ѯ%,RIde[(YkoEh_
\ No newline at end of file
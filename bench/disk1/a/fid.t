@@ -0,0 +1,6 @@
+ˬ0Ovl1f؛؋=D"7)/11g"6i}JnCр-OW%@/7l]׶<,W4PP{:I"cCQ]x׈daFj)d.m5[J:m0'.9RhԻT TɀUJH$˿d}*=y*䮘b:Bxѓ߂^=P5^LƈZ36jpKGR{An:PK,8@]"Olz
+63"%fwk+_bXk˒$g1!W/UvCg{鯵vOCėٽp<0'YXbtF*k&L1m@eAkD}!|S"󎘝"ur}"WG)F'ihR tf{}+9VhsTv23gnc.h!3Wk],,4lM3DL>	ePk~C&nT&N8Xd>n7oFю#p>uh/@22l8&bӦZxJr?%z<
+,!rĊ$ƟQgvӶ e<sPmN&k
+EH-断~v$-f~˶BJh8lW駗C?8{P6ߟ5}:qI;d/fV7[>B`[;x.Ӄ+4\8307ưTO"Y[1ͦbvu8c2BOH.VY6ɭ085@D"ze:)>w1?-a:5ȕ;BFׇ'$$(Jy:ddqP{#5^Hl+"1@K H>aLrɄ)=iNu
+!RAOw\pQ`%"1U={鮴\ѼBxKRKq8.}m㤨`͖ecU	Hsi|.VV`Gɕp/{O/|^78lFW5#$=\78!:!6M٭bquJ"ig]Ul!0>wL:6YD9:7t^	lY=#¬mFPqId'vlDQ!wyZTyLb|t
+[CӷSXuƯWU4[AtǸIGRysl@=p礶@^m^\Fl4ˤ\MfM0ӷb?i@EUCcUc0lSvg9D3(Hq_fk[pVG+%2'nd:֙룮`4TϨ~ud"cu}3lkort<$r׀hմ!*f1Mu*o=Si,TB]Å@"ղ|^C;˲F^T{B.e0nE{Ӓ|xfP>emj"(Ƿdl	"L"2`և1gøj'Np4g?Y`:]Pѧ8ňҘF6f<?82H? =MbߔɩQ뻝@8hSƽcZFZI}&*U)7eY@_	sF"q}Êi,mU6ަ-O@	՟=U4}<GWv$ȴqQw!7'<i{WVV4 v.ǉC٪ItfP{УsR:J]%Mw>sV4>ުq^XU2X?@́}c+DT[	O3	^N9dp|S@JF+A^Xvٸps8
\ No newline at end of file
@@ -0,0 +1,6 @@
+jWAwfUw֚",4(XIHJ!փꭟ OOʒNH+H%!]6Ho9rpV0&I3x:0jv	"ȷuwԌ)-ޅƳz{#6\65M,~VIMQ=~kj<phdD!Zd{c!gP"Xd[k<&jU\cks&6)M`\iK:w6g&u|DӾ>=R%_n]̳YFVԕXmU&8Xio9'bʈĞ3*QZN6=KT_!yA5Jvf":D<%~0NdHo3?.)$dڲ@/`Y]"$$Iʻư<\eRvS%5TS6h*JD>r[>E4!	1_wfu%zƽl`eY,MǼkW0d_W/cẋbu4ZbC"XFQbfR-.[:x\075$<1&Ļ0Ƞ'<I/4#=#?#tHihPc:wR;\sV8Q	ӔYUKQ:t ~)lWK*A[g^z6F9YbN1O?d뫖GV.=Y@^Hj}8{ڶ?Ey@l:zwW{/|w'!mqD]AJ93C͵<\nᙟ<<}hiKSrH#%jԘAgĞTL|OM h`/2=JjQҡci(vb1=munS":d)t˵6w8`ZSb9%NDHl>Mߡ6,&AN!Y2/{D8keX}L2JĕTw=ē(F1	W<BJg?#VI/+ۮ*
+P(9VMdPиGE_o6#=ޤ>1q
+rMraSdhގs#L5Vcu<COޥfV2.i&:'7'r!)jE9FOK"B3J;A3l`C0f0oa[~4x_u{'\+0 rK+*\jSPG0
+V'`1)F_+ZFf6AOx uGCeK7kQ8ݗҟCt5ɳu"Z(f5c:WܵbBFeׂag#<s6ON@#I^;~QCŝjJOfYx'ݺN,!r+jPΌ'462\YEoWYzNkeaٗ:DHnB6l/3~`ߏ>:^7kqT*d<(܋Pꎼe3-@$?:CkzBaK?hA}'FV}$bѹ(^cԱJև,C»60wxb=G6JZOc|;xQBK	vOctkHکܢ+RDW;m3Brp@>8p`ig+ m
+ŠA6!Y}0twόf_̿q,^]\p9J)"mf'˸Q&zV[䞔Fؐu&({n66W>qdzl(	&IaFtGG3ySwكL&ǖ2`//x0&mɌo>OٵWVq=%bQ^cNpt95G#lg-YaĬTGl,	}hR鸶?/Cɻ\Of3uxҸe7}UDCo
+%ܧ<C+-oLFzm+ppxO	qC@ޡ׻?rדYr_IbA.[-ٶJKie1uFXÂ3t{촶p2QX$#ٞΝ^[]\L1-}D92^͗}oǽocAqyR!\AZJh58aS`EɶPQ_3ӶTa[[i@wXx],QȘ#xY|f	wQKZɚvjl^w
\ No newline at end of file
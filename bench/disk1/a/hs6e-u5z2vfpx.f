@@ -0,0 +1,6 @@
+ۯ[[odX{bK=W,ϻyvZd"M)u܈uh>t#\n t5CS#kzF0s¸̣O@s]ҎWbRRRa{ks_%b'}btMkAfJhuSQ
+ztw)*ܠ=JkRMfS)ʟ:񞳄"cq(*߫SӏXLzxi)GoB02ו!p
+WU
+@vcR6݈LTss54_JLܓ+SC?5$.Fu'bl`"[mx՝6S`$oOF;ayu	ꜪkU>e`M$P9h7,5m[ߦku,j2:vwiyX>fOxh`*-f3u%rR}v)k^i3躌*
+Jp]<LʚQذ/'iZʜz$q!$[0waѣp۵9ٯY˔5<
+k@䉅[b 106T$@a{JW%_hL=lfbHr?`Fq2`z*jۇbL~]DǷ[9*kDwC0夝d1QxTܩ3PjGR96?
\ No newline at end of file
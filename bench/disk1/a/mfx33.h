@@ -0,0 +1,7 @@
+r4ebAUzfR[գ).1cvllYkz},:)Gc9Vb.0HJsIՃ<ň#eDDyϋZ)Mh4
+CsNܼ$"c_'uoNx޺*qn,}9#-.V2D彵i+=02Pmͮઙ/_z\aٱE|,xUa&Id!3aJ78~u-g?'Ew[s$
+OG|`^vlFެŸ2,֋.Z3_=o<Д
+3YxXd<M؃9gh<C-Rʬ.sW+3(/QT6 kA:"2&׬j[.֜s|CK\}Sku3|o	ϽŐOAv`WDC28!tD>R6W(ÈR(0n7cQT}މdr|ĵ{Tx"N!+"ןmXSC.yJ
+wvs&gB,2B^L9T0f4м'$Nӿ8*3J}y]T[j
+ni>&/|d`PR
+ ٞ~oi1BK7_ֈZC]%]l<Ϩ%s&akIC^+'osv<_|2_Yqd֘($ꠝՆ߮Xٷ5,]?72fzn>/1i]-VbZ)"6&˩eFC6}JY-F͝bz2Sg&]gFn!v_H;~uV{@(:1K-Hh`rfC5G,*4/fɃs`ϔcYp	ުK	E^psvjM/}øT7	9ŋS]H*?HE< Z.VA	OzYukno65˗l?gw¨LDOi#^/e
\ No newline at end of file
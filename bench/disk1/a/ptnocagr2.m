@@ -0,0 +1,11 @@
+0љ\B@k$u:hGGrRL|p0KZEgRY+ǀ	7gvu7N)X1F)/)H3򻦱|Ƚ]򫕐BDsEt4yA|߰Gk	d4ExўM}v"Э^Iʩ:Ap7A\Fw,UsL
+[TaPc,2X뱇w6!Bpz
+[C=tt%g׶:nu3N
++$0peTpF`ݬ'zt9`\ŶQ3a8и=>6ǿ.~"18ansɤ<lta(ֆMmGv1gN˴릞46i%25ds|XM}kxϨ`
+݇Vԅ`۸\ƋⴃQ{
+V8csp4
+	uY݇|Ot
+`pFJʄ@?Ej18-|&NP8dG@{ůG5'~gNHel'lS)RԱwO<Ōq'UG#Ap[- ۓW08UȨ2" q+t:x@^p**"I)	/\&d[cq.FE[]1}nT˄_?xD'4dҧ\~?B0aNK5ϡ%4}EIӈay;pٷƣ̻'JI/v3V4Q{7QkDe0K+UQ?2qu,#Iգl;]޿[~9[WeM+`BFz"yCo+8w"3msCV	TA	z,!m>rC>52@rf}Da,x*b鍵¤\z~/N;VVӹx
+ԍh%CU B#@!UN)r~kvS::@K/ҢG!ҘEk(i~(;|~VߧlZ0癃iJm:K&-O;F~ZO΍iA3bPkX#k]/Ra,H6P9M
+XT0Y 6"JM]cyL.V4QH4mZ'.Ɲ~clu}f@fQg$֒	EGEBznrf\
+ak	teF~DixCDq|5Zl~ʌnA6^[ݻFlǋ
\ No newline at end of file
@@ -0,0 +1 @@
+tznm6x36il1ofe
\ No newline at end of file
@@ -0,0 +1,2 @@
+:EE[bAEU:!ƟZ+vuIp>%yת nsU4JcGI4ݳehΞLDifSfFۗz E.<]rA`zϿ✄]|!\>}cq|q[Sv+/T_=0&xi&-mO
+r
\ No newline at end of file
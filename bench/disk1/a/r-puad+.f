@@ -0,0 +1,7 @@
+Bkjj)ZIU''DR7y/xX)BcP뒚Dno&+ab	9	e!xz5|njQZ z^*Sb0Y!W߷4$PX23w^^(hxX!'AdËkRO;D)ccPaⳫ-7<z.;<&}E>>5qJR̔h*VVxF`nR6Xϟ;[gbY1DbkXLzr[{|ΦsIi:i.{3Fc5BNxJ:@VAUD1^8|--/PӫOx==M lMU<BT~Y(zS\͘8kG:A-TCTOkr6h2_ơՎuϸr-+zkc]yę0"/xAO̬i+!7#ꕆ-̃۰'jf5C	ͥ\~A֢ÃRrڦׯ1Nޝ9ˡ9F$sd腞i'__q^MOOڙFA5l#sP^
+`4cK@V()n85`VӲ: A7Ћ%)D'k4$?EawaVTP7SDMrAf:dFUW;}T@`K}%$[$2xcs\Q2U=58[xj65LaDO/a
+[P߇=r5㶺Wl+gq $vk'uݐ)R`8*$ӑ[ʨA@qчʩWk5Kѹ#mЮW%[ˆɦ_lDLl{df[Y8{4.٬^f%6{)+uM2%8/z?w#V:,Z{܍Ր姆b#T-=uR\g7Iɤ}?G(_$v,R?Oo%_gF@(:.`F7㌑;5@MU(b	%LN9/8]3h<>M#~).-w}uZ[1rf0fu|dY$.b_Jf(vj-=334%βMǐn@^c0LM͕bZ=`aϰԝ?۾=|@,;IDHCS*ȂX<Ux/%(28Y,2!)q~tb_D-!Д1O&$XNr5%9DL>zѲ`7-(1C,'WnQ]Lid4ذH:9e!=ŲQ*q>19\`DX;ko$AN֬El=,yųe5lٺ'{RDu:n2nd/
+ՠ7"_Wyq)<feL򘻗&FmgULuX7yődSzہŋi;Kb=#Ȏ\bmQ]ኟ>`N6/FZƂv=$rQ/+C	Q~f\05{XmyBzbz`@/u%|nE]Oĩo)p#bC,+[>e,al/ 
+$dm-{bǦ*@=A2/$Rd^֟-'jED*v"йM7[lb6;yO~"xhvaoނ2vKfZ;b-wU!J@dUpI'wʷ51VPYޮs?YcweXƓ|GZy wGABu~"bEB-[21b~ͲLk@D)XPΕz1Iw1soM[Es	?N1/hKA+B4+X%G6wgzAض"K[S2,O8L=hJ1˨sR/OX*.M4M.l<bCBn\ΥB㒂}!,)7HսqGkR5a:jS_&lJwcAfΕ.f"әǓ3fZˊl`lnvW52(\wlkdyϳF_hB.xhl:gڨ(0ė+HSڏ@@.#&:T59^}0Y,it,PJ{1KĂf"GwYE^9,>a`V^R!z6P=g\ikOCR!:W6a"75ξLf3L`>y؈unFJC晌ImS$)h-:Fl#oY2_<gVR5
+/6ǣ#_%.2Vdd3$P"8PY>7r,T9qtҝqm$Nт&Y"9kϕIw"ĉi|11ۄLBW7#ݶpGWoh\]'Z=5e9 
+%8
\ No newline at end of file
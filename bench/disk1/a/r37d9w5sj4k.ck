@@ -0,0 +1,9 @@
+UPjfi57G^0AR܇{0[(8֟0&hF#:x';5*\FVi]1蝘xؼ	߄	dadX5%`>3h(˫yڗ?ѩGFfr3L9JtVɨNWh?ID%tBVEϑ8QdFdk_/Ltw>(.ƨ%+vlx-G1TkBD(j5*|Dt>[&3S놼VQ{1;b}KVK	4I0b%6jHm'Lab`ާЩTN'XT"^6٤wWؖ<Ҙ,68
+},1|RKA9MO$D.Ӽ|)&]i./ӥ!_"*ض"*$v
+S60~ic-xИ(rǇ^Uʈ(߇hF{_i}*{0׮#F<d6prVPC%xF58ZL/yG	b=H"?¨(Ny^͟OBg03&i=9/n7UI6ٗW!}i-lDW;}=6K"ε]#7Mu65*gCkH_%逤IBY{Xt
+:LzMYbVBz?z^4)hS50tRwcB-J]/l=YI2myhzr-JC޽<L~hXPz6	S8"I 4;RvzxFJf'puIvn=QLǄA4%ho+n#T([y.RFDR0ރjKcT"o|+ܞC45B,ei&VӠy+=x7 N
+> 2hnvL1۩Xy>ݩf"gU_p$^O,^q!O,ҽىnb*:_(xy@3Y^nZܰWLvDo#պ8jztE
+$aBe^ޘd4λmI+]bwSN;,^WL Lu#NqA{Z	DNCsmK,ݰ*ftb^/$ݩTEUnY		GK0̲B>CkpG|
+2ҊX8X|$=EtFU;yQ%/$LX%4
+DqN	c%DCSWoؖ9)nEI4i'5z3bRw;&{ĒOJk?ptx<c%Ј?)<)aüAX7mmRdi5xłZXoMdwPv?fwp|<l0%E\9$#R3>R5xSa/iؼ\sHߞ<KM*m}djXB[$сu:-OdAd	@}c9LrFp
++fHLpZQ5C0f@LotEm$`2KF~yQqǌ.R~ %v^kjܜ
\ No newline at end of file
@@ -0,0 +1,15 @@
+9!3zO6`6uRYTa*/zx"VIȽUWbjQ9џ'hF8+/|QǩHBIi*kqF2,mޫZo^w2E׬t,tL]D:vNH_
+V3_QgLBWrc3Тu{=:]٩
+}+iV˞ҕDz|2\bŶ:een)|)5A`mnyTc__gg䏍DIe$b5GpITMhN˩]:6*#THE.%H}ahG[>.&9<Z)F0 EŵK5
+4HT)mklӍĜmOR02:Bw6O+?ך~kw|B{T#ll@8VV].&~KzҸ{4~tJӢ [fb '(bCb9ry^׊K4,
+(3"J8FGp׹	bF8.@ɨ/a~ݿF2%%QdS5W<*-#[?;f/x[4WEf{Rgp,eC`/g5pGrɬnM`I,~eL[@E%?~J=^Y!Hͩ,brݾ7Qʸ$S:M~U.(搵p9m?>YEOWK_d6>XkҿIAIڂ>cGNa{~%	"dSxV@]qQ>ꢡ֯6=x^'yuSĲmri~O(hpir^FcXDx޴WHnLlǑsM/nz,I}J?>DLH-
+p:E.h##_>/?m14${g&?5E^v+x.A^âa{sL(:F*<|-췬S2x3_]5)g[}[fvP"\|5Emkp^PyGֲu7~Oae#՝Мeҳ:f;gtcX5邹/Z[ERHS~	4>ly;^zP:%u1p^EWR65CT9^J!LbɪBa%2
+Ǧ6
+iHaB!A8wfjLֱDV	>R;4nS&">ݦl
+6L aJ[F
+b?{':cA;ԡJÍ;0kE^;;-LvL>	wcOKjpn1MZ/]׍fFWR}+UxM#e_IfFy^,]'m~_pq.Oǎ`{*G0́M'40Ɛ"r㩹T"W,^vF&;_uШrF'r̩!84,󔁑-ysY'v<:_J9%m.@+ۨrِ~UfaYhFqy6>`d?i.}JC9OZ/gm}U8B9@zy	3 ضؓё$$Kowߪѳᛙ<eʧ!EUn}){IW+C+A$H7@HbiNFîWZ}|,}G=u':&?m΁SxǇRy@`Qi!bgg[2tբ+An@h7F2Spp|}YΠ	 w'>VoEd`\
+IQVՋImOHd %ܜ)}lD\XŜq	(۸8vDضاS[kiK[s*m]e[۷x2
+Egɖ3md 'Yׅ+>vHy
+#>}8&V۳[G%'#C2D	Իf[;TIl:'XY-r953!oˉkT7c7Ohj6dTyGMh=c	 ktSz*e%wA2{78Q8k>u車HU|P4+r[WATgݚn&g c1a
+sORQ7
+⬽vֆ6ǙSsN'9k xp$n_&ئ]BqCDăG*_jj~MiyYR~#(0ɗ{"D̢\xفpiα]Ly-ZzF`_ӵ8AB^ֳLSOC?C$kdxQ9K+{pk#@(r`uvF~'C-YQ^z3Ƌt_kT]k@PfnH,Y3i6fvU -($rz&}T3Ҡ5脧#G{ZK)?X5nɇN9Sɻ^E%:4W%6@B.v->/In^#;2nmԼvfW<{wšT%un)d=iS?LoT?ݡ~!5^CA8yVB]}mKʪ҇6RnfEX{u=$M!2NW_3dE~!Ѿrg{O&im1M$Ms({L|K?~Pb`GH#.4&A،X@ǜP&?1j-,ؾQTY,BT	jr]]%P!o,0AЦE}XV%	|?yzȩ^޾֤/#+}7ZseyafD'HVs5^
\ No newline at end of file
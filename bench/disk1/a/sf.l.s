@@ -0,0 +1,14 @@
+Y䋲u9cܢR
+a+;wg7$HŒ$[Sϖ*\7`UyX̰hym^
+SVKh[ƜLW'"^8̄I!iywHR6f6i'~ZB'
+ȝϊ>F$U^^-S)<e܋VA-:v_l}",w*YXK^wszx<}u׋pY;0)Ad"]%75cKvrN;6xnKyk05E{T{g4˵F@Gڡ}}=vB	JlOLfڼg4[`-#^#*|G~ʹGh%۟#GZ?8rcgIPG2\֕QMNop77䅠4BLJEN_-%/Z(1*XXj.<gZE7Y*Np۱"W끢"wėA̰mHʾ8G1yW\gغnl6zN_2b޾/b})ǢQ,@iSJ>_>Y&_̙0-ُ5qH=stqˀp<!ZEٌBȼSԻ83XPBC[Oj_B\LͧK庽mXv-d힨SsRؗ-#>m;a$2&{淠]hXFgi(,ع>qY0APۙW[FRJ"%^\&5V.ۄtQ'K
+ EE5vfjn!){5򣚧%銩qxʾ9
+5R:c{-k 4C0(/1fOgZ	j[vRNPeSYG#.e~D6GẂJA˂Y*$udumŁU@!]=WG@ksoM?O<o*<)"[ 
+[SK[WaPĚ/42w(:˜}[I$OS_?wxo,-E	7Z((Ț=W䷀z2R&zzR|,4I3RZC`1#Em!B<}fߒ-b6?=rfaԹ	y
+zB^CWI5~
+atnރtU~tow>]tኔLʵX5gV0iNFH#bK7xF8a]q$d(8Ly	M9FZFf启]M,T}y>'[zX_jڝjd_	EE^"ۅ"}˳瑰p8'M	Cpp]}:ޛ
+ωhCChgˇ]n{ͧR<vcjLCze\m!C?^`Nu=ȋF~O"s=Hc{)`ٓ3ߍs;vFGěu4GCT78zTeZܪIQ׉ų8vGlߺX+xnM?2rDp?hr,tUK!s z_cEc|dբL ;e,u34J%bnXВRH,;^#HgD{h~}A=E?!>)RuJ\tGҴlqZT5o:R/YPrcLrDTY\ȳ/{g/y{FDy
+woXwv
+B_1FU1BE@m=.Q=e"RP!"[D|r#,xV5POCҬ@[AC5_Y߷K*X+yw=2`Fֱy:ۣw.a_uRi?[ !ƊZNdPپѱ2?Dy4FLK<yRzTtIJիDRp0Aq{x%h9I7RG$Vg<<EJЉGv۔5}<|nw:TWD ̀"c8ix=
+Zd=PEPcVrWlbOu<
+a5|K9RPLaXUy2*0̤@z}Õ37Vʱk0=58T~cK'D/F|F_w.i/W81hIl@6{|.ւnl0o4e1{ߣәOE`HMFWjNUGܲ$Վ$zy!Vh}C>W6
\ No newline at end of file
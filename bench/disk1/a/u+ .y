@@ -0,0 +1,2 @@
+UWhhfnRS)թC:[|FI|)\2>T$iY}zHht0h;"<41ҙкYRC.ί`jyAtuD.&`] #z̨{)xV*.QsˮTE;)\e5]kʆ;@}=%%9G.}qb2ݧ晳}s.x1(Q#5·V]7w/inA%0/*Ͽ h_%5M$5.mxH5h!hmQ2_E:ՔpiXG ),PTNaveH[OQ=PvY;ld`mhB0~pY71JB6,*Snݬ1*O;68e`<dϐa~A
+b{vFICT?^B8@x4J3Ncv>h4N\E[
\ No newline at end of file
@@ -0,0 +1,8 @@
+3X"H5 0u A7'燶/d$rLSklQT|2e$e+g5nVC}y;sKtӬĕt%rkthl	L<N]j@&J&񢙿\,t c(j@l3'~|S]xL7X<'oW]W/cj:*g3
+cK7k¸~lx-~MQ&&˚	2m5g-BvO{CyFۊ	MHaԷ?uVXδhGJ9ZWvKSI+	zZ4؊N2A<!=9Ew^/߮rsxnA1W'?VZmV55f_tmg4(H|I;hKNECpQUrD^[х'%5l*xc]A括qK~>)`޿f6p(pgH|R짦<}+LRIzV{LlMIB
+bFچ0mb
+YPSx$2 c 0
+&D{-JRi&L`.弚E{0}?6_}]eq(5UC~#lK"uZګ0I%+?^Ǌ[D~a<Og9)U]&DpT$zb)	r}G5#
+lR@UXFΪ4}0A2:2QIBgwxR
+R ԣPQ ;q@i9a_"VŖoe/)Y(fV4FhO0÷=$>sJ)pĭ5Ik|GGOZ7+B`AkOKOnOFEY*,ɵ!ؕKݤj\xff_Im77`^>Rf,+c-Zke2cyk^``Z7Phv[eB[O?jGtLuH9oR&B1)47cqH1A4lM糵M}27qn寖Wb/+xVYhw~{*.@0[8wg:0moE53CtYУ'@egvG\s-YJ4C+C4VU;}d!ut
+Gqw(4j%jYbᡱaXiKCh_>rJ=*DTbӠudT]đ%By|Q)2F@1.Ju$%+HC`U$^X'P,ĈU0).7:= َ%	IAf9ZRA	x2Tcw,7Z%0s]lUuv\T]MU	~A)Iqd	MwgP].ܑ1hmKǍ7k7Y5N5JWmG! +ބ^<I[NQT׷/WUku.|49kDddڝo5U4=En?=45-8s~mvhIctJ*'`OcaPR95j?X3=⋗⇝y0EptNo+y{3숉s[nX`ێ=Ʌvc:nW@>wVmso1o|z0:WzΈǬS%fOt3>1,^#~ͫ;A5c),ڒi	<hP<s?*lڶqхtlG8`܍2۷GJ/{|xë=+2n4En	F
\ No newline at end of file
@@ -0,0 +1,12 @@
+ jfxя
+1Ōdlc2QO9b(7Ü+o.on_gmUCPE|sVu5$%Dh${i}@
+5>t
+|l,PLx,qa5A40_zYցG2Nl
+Ė)eaaTGԃh%PfLsmCaJ%ȣbڎkbia-^?;%T{j<tP椶AYPVMBgV)?݈|ʭCregF7R~B.%Sn`
+07#itQ](ao[@6DITG]uYl	$qRfs{TXj16d堹h>Szt	WSY<ќO|g6O?Nv~r&' cc77@u@!Z1=x6Q̄D>ߌDӼRBd>on/+l%bZ_-:g(H(RkUNLA{OEZ?&i2aέHjf:r@oc7ul{P?翩C:X8;d0xG $=`JfzHF@95u61##1t,ejRǈBGlG+V/W1D) 3FUY)KC02iq⣙EpRe5Z]޵6',
+ɲ(2y"2Zrvda^)ڋH>^UņPy4-WVlEEi8J>`dL8{D_MP`-moOIݩ"wc8G`w?9Y`07s\bJr0A%\TB]}0XCo&\m6֙}zF	o'~1~<gG^sO)jEa@lixwIBDk`w;ap'JӯRXzwhף(Mfc 	*I!$]-SǰTH3k6ƠFIpFEbґ3K(ڡx~iŜz'T2 w_L~=vt_!_4FBk^i `k8j3=BeM/麶gm&S@Zgv/%{S
+(ɶK[8m)+F-L}"g(#?蠏qxZ46G%'>
+_5#$^l3HhPQ1jh0O:NȬy.,G+.)^]o)x60˞+trt:L	nPt(sI=Z]wG).|I&+cl+^uF
+psVcVjgQX^2Grnx'ƨ
+Nt2f:<Dx!	|O+#dm9:HPTvchb10y:K6I'-0"ҖC\!]H\/4[VHdrZ"sTV^ɛoWlntҖ9FWDUmUܟ5Jk_ֈqXCp	!Xφ"J6qn/Mcaf&kk{^ՃC0/+2ieX]G哙wC󊽉o~ndRI;n絕>zO*ܷZ/w^,YĎ3 }ǸS尗b_pjL,sjYYPǶ>RuhfiB9ԩAIS"Y*ml,e<^~yf\GXN}KYy B7]q#͑6M~_N#3;Eizd{<vmiBSCh:<lt%vadoP-vU;[qrr8No8LA~h:kG</mlf;A(̯[b[nbeUx.gZklHTN-a<*%BO2R6`WD{?Znwb)޶?^왆Ax79LhB1H{`bkbxŖ6p,?hXU}e׹|Lx4s7ϠڷYϙ~nH7H7}_6IHL">Py%]OF3\R[`:*7Ei$ɤzHc#o¶cL^X)M4tgx=_\V4T/pMG[)e!DJpmv!<}ɲ}Ʊ%GMO5Γ[h05NQsSxo#0[=uEieKbc܄kgFI҉:Mii[׉}/2#GMFJ<(X|Ksqׂv}ej~0~[^n,{PX/#փVU9J}d-_V(`د.e
+}ȉF:>,:>ӨԮXRw(ote@қo|px߼[[6#ʋ\(yU46]=pK5SSoIȇ,oB.բfm{qA$\J^xjqDG/Ο`+7ãgVx75D,)ݓˋb(`5HIcL0+	cI 0+ǚ"]yIPм3sIQQ/]fWzmB; , N:9G5{ZshM;
\ No newline at end of file
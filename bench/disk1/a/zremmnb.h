@@ -0,0 +1,7 @@
+T_'=n&?}s!`4fR.ObxbByQ6^r֎
+ǽ~߳EfkF(F+/z8Q	#mp_feo-GBf>i:M7tIڟDt$uGL+P=._a&Ta!e,#G22)F%D/%qIȫ9e(	߀S?٘W DkCuI,'icR8	FV/]	`lQƠNApm_+zs_Mp]QW5_a?!(;BȘ6}Wky!edv),j-I_.XgGks;[Axu71Y]p焾֛cC8BI!޸cץ~2->^Ir:enC?ics-W=8k[B.G#-72|K΁Gp1Dt4}|>NYGRo08)	8{"Km)u:]$+hHzhin0Os-OHiل=5G=[%c8n!<XP˻P-`Jc;>b58};KYm&:}(Qp_?H:!!.}7I+Y燡#SLGTg7K1^c~DIG2&),$MGΐA{G	ZPٜ-qA#\?FxvG,SD;|Xj+_.Y8'BWj08eN|xf52RT+nYEy@Km7{PtGRB&>EPfyTQ 08a#J[Ec00y9;m1#K􉴸hS
+68ChkPsY=ta(@8z.&)=|3bu5G%jymיauo4``E!-$H3u#@+,]qywC D;c}}b\=aA\d]/q0<5TF,n?:ѻ* >SÁ:W>T2	-1pJfnQ@>'6ctoۦ`_&ǋQK5O&t8TSÂ(*(c6=Cz9i.yn
+ uЬyI?yu`fYBL	66DHR$W<׻/O?=:!G"{3].Jк;B<hSi@Vgj"+)&kV7^mcG5FW-e0zxE"y)urߣd? $b{DuGE঺B8-J	뻙vP#;Qc 6'TI-"c3NUV$#$;Iq
+ S6ߡ`0=4)Xxf50kY"| n(H[
+B8ӥ*@/T+ௐý[!xdgבRl*D9ڎ?Xyݢ/υ.\Ga>ێSl̈B׶yWλC@փFW7Ŷ4{QQVrt$!1Ly/Ck֗oDn=njit$0-$G=o978f~2;8ɰ hҶF~`hQPV"KPA?R逥yo?Q%؍J(^/eBq<4U˽B	HF}#]`3v`O4?'%&3) E{n'\D;1b@xd[7m9YgXB[]CZPYsbA1o3,jdk=,\	a?LRu[w~2_H7rSo2>FѶ.<"C[޽+gYYisЉhɝ&Z`F3Ume=T}C=񱳭w(qj̔NHz0F '+Dݑ&_ ERf%"xro]*Nc/8HT|
+Ζ}\lI,>ɔl\4(!;Y_v.l(<2!H[y(=7
\ No newline at end of file
@@ -0,0 +1,11 @@
+BB@ .#XztYwS|;^ʖM٧Kt;Еbt01j0/s,zN`L%}(ǌa*Z2`s.]OjsTjФō0|	,5P/4bň@?L@4P4}Cڱ&K#}G*;xV,r8m2|~*kr@Yo aԪƍ[,K*gOo[ҕYfL8$}fl\Hٞ0'Ss`i:bkseB`6A_HLDϛ8qY4v4ǜƛz3]WEvעq&cdv.ΰVxO,InRK'8ҿͭ*,
+ۈlZw;Ϳ=K8`oŞI<S[gVrz|+y"|4њcc̥@/Mz5A9!a!9@+$eN."*EXNُ}:n |9bI&|	uEI2G;$1>{+ȹ'O:LC8lEkb./)SN=|Q[Nts>t
+OiM94lK,Pp"bRtJFhx '<Īk`
+KWz$دS{p bz_#Z* xdUR0|uD6nj6&x!4"b߁¥0b/)<b{{Ưv3ͬ|V|gȡ{3>Z	嵒 TC=+2:&ylEű0A@ˊ:~)X7FjRАv6V%ږH{eǫ\ڋ6eVh}$;{w҆#mc% w[!\
+4g>~B_ΔvL.esW|[/b8A5ȸK(7$G
+wy/q_'3JܼI{jg6wN(>Ig,H=ݬ>k5xj͛:vh^4
+G])pգW6eƎ+N 9aik߈Rk،5Ҏh5K[CTM;r kW10y<:k s4e3WӕãCw颵+OR~RmPPn<Y	RBo r9&K>nc&޾		8S=Rme9+eUhϰ5!C)o*#;5[M <l'miQ>U58+[8BV
+y)E5v&._">D6koL1龱 pJ1ոzH2;s:]lE3WLc	zz'z̮U=8~ZWʘ4EAvҽB66VBbSx۬Kv%LBfjr)61LtÉ A^Id{+/ŕQHkʮ5zWá\N.]Nf{BNZwd
+Wb%871a)ʈfrNW&KӘFq+2Mm|Copni"_a5JEipKOSYEE%*k${$!wD%0~o\TpWiS-"vSt=$DEMZGF#5UUSÚ߱<s%;B{@[/"W9ؒӦR],nvz	"(ߨ׭57;&d%fP:ZL6bGfD|>G	~G@rBg6ĮKy39L@la%iB;Z{6;M9c=ހ
+0A*ffAs0O'Xel`]yT{-BcMX`:Ani+B$)-1|?[u#]q̳'kPr~gtuv`RFڪqiS0ZHqքFe=c*Dc bY~NUIz9,)
+q<,5W邷zǠ`~7~!:xHbؽ$,WX%8$ldeHg.0_@3(KkasG̣\u={9<|g[sŲ@(f)lOZ*)|Y3JvV3->Os&M:@5{H-be'(|=^}XPڦ&
\ No newline at end of file
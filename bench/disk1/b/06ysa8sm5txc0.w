@@ -0,0 +1,15 @@
+g<|JaK8xJ1&MwZͱt)%t(*?I<s6$4dJt$萲oZRic92w(ۓ*r-QB]T+{.yNq|OzXGϋ8˲7MQY<L#ič;<dupΜ{&|G9&DU5$*:P{^[7=ւ2dA1suB\m-^&~qhY0m4OLk <=5߾R$6U,XVQF~<a/)O-ɏt|g'Y(&rA{4YVZ;{,#fj쫔Zhѹc^$D)~Kg8lJ3puv`^#bdſLv68&U,.PbIk89cocFE0/09F}R;wkTwmG]5%e՞m35ٿ<ni1ޚuXkV4	}{.{bġ)s\7kWPk7C\x2XwoYz?$fl~)mWBR$YaҌ'$nXyК[BIH+AAxSOw%V?,s#'?V!kΩ%;=O4_9`lzy'71dWge)_xn`m:' _fka5_FBM}?fǁ`}^jN蕮tj->r{iޠ'uɾV9sO߻^ԓ-=0BRM<Oɗ
+Z_E16rUZƄ4j:%|1*V
+;jD:2e6G=cdǇa?m\-`M9F^r3[%d%%:#\4Ýtk68E{Z.+C.Q݊	ƲMq㪐KCCoxP֧e1@"`2س`fG[rrY![m5:}oxW56U^R{QX(@kje{pUa'o$Y(=CtRu*BiҧTũ%=6;# LS?.J-d2HDPE,#^ݴYc`_%{fKkb;GAMmυ>?ɚ^HIDv$${I:嫴pND*|Rdx2<nKÖDz˘#R}XXݴfh5;}'4^2
+~ǆ9Y0Ro!&@|w|`ZdlK̥
+XZN@KJxmhsYo7=g4~
+.\]T3#+k.c2TY*U	f':/笝eüi\j)qVܷ}'D4Hi~cI[,C>/=:j?z=Gy25e`4k8oY5+b"P$o#Ҫ;\"N˽<;!߆lYV|(n.M[8Sa,L-B+Cl3|BDkSrBipahzL1A0+2I"(b/3g=GpFAqe;r;S#竖HхƲDBf`u}Yb.+<̼	nzsufH~>= y&mԜԹEgICkKD-KTAy3B="=V=4,>K<ˇQ0c5 "A.'ܢ`6&>EOvt̛mКYus/Spcdz3jPPg \{g0t/E(!3Fu^"[XU-)&A~5V
+?)q`>S}͌J>;z͏\,C-,p/FZbzi#Y1L1:ɕIYWS7nPC	ޚh1˄{ާԝayѕ]jϘ\zr<x1.
+($
+V)B=}	Hԕ)nGzeY^bi7]٬Iyړj֧BӗJyΘ#~)YV:ye	mqn-$P+G~(ԾEVPT\WC\{v& bÌ1&[K'e3a.n30!!-"Z`f7y/ӮKPmD2cIWhTX=!XaSXmmrd܏J^Պ@h<0qӡ~gۮx\[kwWM[vs4ʽMq->b!#X%6)(jXGZ$#>v:2@ tU;yO9I\Iz!8{qa,p"	՗Mw)ұorsetǏײZE7l1ԏ|pdZ.#,Oצv.D_A=r=8z8PZVqJ8gv~eRSƶKtVn[#gz<OM&O`߮{_p%h'Ȅ]\'=?\AģĖee
+؋)suBx9uZЊHSK3JUlMҰ0AjXuWٳDhXXƈ렫Al!\!]k}Kܝ@K\ߴK0lR?T},7SgvrC՞/CƝ_S~+7](U6dT|82Њa UoqmNPC5Kt0{,6XR>[;ѦE0{1)$=7 WdI<K03yro-J1+ƨTq0&HrȨ-a@kxcL@|j	RrdyШ%,لU
+:'K/BM0Zsc2`HTpIrjцƷ"LȄ0|(q(Joa'X"o&BybtǪ	%3Z'*RH;_&gb{gO	ݰ5jRn&7E}~-,uoZ>
+B{h)D,duZ	B*۪^Ę'(UDd~9ho2]:CTbq^)@
+v
+>!"f|ӗa/۽)r0+9t<@..m+ew׃ZMyԯEPdKvl̧{06܏΀:oaB
+!{Q4IقpMՌ\A&%5ҟD{Z-G*&#Ea
\ No newline at end of file
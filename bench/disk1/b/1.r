@@ -0,0 +1,18 @@
+LtYowY뜷uoG!$&0ǂ[k.`(0<P*60Hq'Qs1.>ͮ9?l9щ>xYUe?IzjqG?n|/HQ@O$A~lȈo-ɢ-׾/j4,ݷJڶ}qX)&&"2I~3 !;5xWZl UFZVU>HRQ]ILU1-ޫ.\E8HmsI=Kf#TQN44'P)ݶЛ#tI8-\!L:ihѼGe#hX,1?)MۆsK8ӚtY94%T<@M7@M	cJ.7{Ɲ.h6hb1n*iS3el23F4O*fZRm)ތ*FP`op3`00ׇưyhcڡBb`$׏#13HCw+J.InޏQO[rj}DZqW3nBJUvp)z=V7jKAxÏL+Yy3ZpS#U;aYlԋJ^eeFd6!J'<M`jgUCjҲ~h.cùf^M6G߰3P:GSߞF';e~Z!mW%G׈%<zgC9:oQ
+
+D4!\u$窦dRe%S7nǽzp'4;K܁<rQ߲Q@6Zؙ4 (D
+7XoHɺGA8.rwPR7P\Z_M.ЅF
+v}%33ˠ^9TpF&=蓅$.pYV(uy܃$c#^XE(=i-"tuOKN"o)fee17cک_sN7HYfV"Emoaڊۜ$
+rػ`tP_Gc|GMGʙ\Џ鿯\z@\ƗaOlDfÆ65jڛ}Or5o;r}df)[S"W=PP;+/)B@?	c*Иɰ<,܂8(0ʫ̿u%lg"׵pѭe2|2g9#0/q/_M|eć!3u=5'@tN`36?#]7R72JBX%턷A
+.yPv%Xf[vސ\Z]
+ةF{5W5^|:e80n묇
+v.Qv't4%[a[rrɓr{-`:SMngΤS)du5~yR9~(r|25k?y>'UhHɎ~qVVZL8`p|)0-NnL-lku4|9e6{`[GAfzrM#rM?"YvtqyP}āD{.,g!z+K
+fƇ)N|A7b_YPeP|PZe؊৤8\}m!qWI[_-ٙ7{Qo(\)x)q\J$RkodWw8PqEc,W3FfygJv	|U7$|y
+k^L(BUM+彆ZX@v]ވD_ogK&%D8HGߠlYv__M^(ᬔ;ݹUO		-ЋW8b!HwiM~4]Tz~|L
+p(sǏ.cya6oKmy,VRJS-*ǆ=񙹧>Rڎ[T,5nSNf"G"E7{8>3r=<+Oß1[9f|"9~`Q^ [MP;˩Ep)GD-t32'Y&{qC*!![:qK覴dE4p:v<ţ5E5tx-9ԽFM005jz7BCc9>1US$4c`FUqg!`f
+(yGICvW<jbY O1wI	5q]'ǿ@=7\{{1~ÊLJ)-ݱmUg'y3}(	]:D5"Ipf2+e_ڜ}u
++@ρ~&sh
+1G&R>)܌mU9y##mx`q{l!/|K꽨qĳ\K Չ򄼆fFNr)Z~p.pMi}IByb0 Sv^iv";,l-WjƲ;-7e18?\ns}70ڄV5:t?(a^~^I)IR.^q,Hp(-%+k[QUu,LQkR_BO4f=ȱZbSRݱ䡓pnL0Y7Wh*cA#Ռ82]DI^pൽgfxјp#+2]>'W
+oHVqQZ<+"%¤i
+DN5Q̼я^8K33IcؐDP.`[[
+kD窗M0sݡʤRR?'<H4sx>guO"N[BADյiɽ|3C#f=.t%Nk7ga}@uA}ũܟeTكnoM"NI<r`_,'R[SS6(2׌/[s'^1>'h1EHY_)\\5leQ|SzAC4.<IŚ/O}^RIzGf6sQLӢTdǏ4]S|c&v!/+.r2U۲(E/w<
\ No newline at end of file
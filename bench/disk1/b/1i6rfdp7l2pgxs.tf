@@ -0,0 +1,13 @@
+$nĸ2(*'e]#lx󵜨۝~PȰLPzs]UW=^
+uB#ȍ!{qr3{b~w5{)6m0|Z_OXd>!xc}	h#9Q
+s"0z"h_&u%dL?.TU^Vfiˍ,vJm3,;"azu
+;H$APgp,"gPǊ HOhOJ+M!gSE&2`"򌟛asgaHW7Z6CD?_um02;ZM ^7ބ8~XyVe݄йU,))Wr\Y3 C	USVQG"Hͪ-L<0f7
+HA1`bOȵK(W "220A?סhF>YHdc`$s7tw<wcIĠNn\WҁKT.Lxg{b0/@AZ0;3>A$
+@lN75OA78<uzJ	r/%_D]&A2ق>w(ablexvM#BShҌQ	̒"#WzGu	NHE'EGlF,F5܇wtVGP5L`m0{u?x.3eC)h/[oڰ *@gMNQ=1uň}ɜ睂=lq;Ӷc`dŕyCa#̷*4Du&S_P^I&LjHkO&£(=y2}#>Mo\>V_;ڨY̪yƢUG=,}MB8XJXy8^A(>.'ے@38o-磖ɑ̈́|}#^Jf= k̒TCN.U0%$ys5-a5E&+$-Ο=\ی%	=9gv%~yS\ۓRXNsB==㗠do{["kc^/}GݬRCI2<QBTIcStHRݞGACS`weO.1~D2zO*ǕnSڰQXK߮>8+ΛqVHQ̼A_WNx+QV:1Ef\tLyNQRϮu(!&6ZtKO&.t?M+Ģu@cX˶αoBCzk~=ug>a&i{6po;i]!ᗨh+pQ_Ja*0ht(YRGPQ?Y1RvTUb"kM4$KXb{13 :w}
+[|fz\0>JnE5cQ;?Dq9{&Py3`Sڬ[:W\3PKn0I)QQLr<9hek]G|S#=wFL=NFUѧյH	 ;f=51A<6)j1bHưX)cxw5^zΥ#)<.pJi=sKn3g!4G2M{Cp%ΝW?}G!J
+5ުgAByLQxx
+A҈
+\wp,:h췝_֌U$PPwE;d?H}KRA~"9gI`}TC>Dׄ/V$|%.UZjJKŋT!#OrIL %9iVZXVGdRNz'^߂mշyI(q	>+ԵCaY5wl:-@6b@*;',qy^R9'n0!W6ܸNaOA
+xAkT@]^q-#ҳd5VzǨHP=TWrW!?	v^VA ^-Vm7 w`qCP;і;r\TRCJ˱KcE<x:2^9O?Rȃ3Pڻ7%fMNe][鱧8ڕ
+13n%G'=9[u}4*{x-dPt܏K@fY|Gk}Ԗ!~O=q]t߲iR-0毨4;:tL^鯔قormhބdaLΈ
+;σ۽p%oL;Qx͠JiS4zfÕ@ae?`jtRDCZǝ[ح^t6ͤ!	10ˋڴa$~UejRowI;D6a8c~mWέ
\ No newline at end of file
@@ -0,0 +1,9 @@
+;>xʯzxA~jVu&|wwv/iAL]OO.+d1%:q{nJ_ζOy7}H4i.sqT6vf/%}jR
+j?n})(	߸x%Y;2_:v-x`.PgMsZ3'ى2\uc{&~M)aDLAZjcXm;	߆',6I6pl(+NRv'%NCmYD`2>N",;?@Vg&Ǿ,Tbbv20b<-ݚYH!Y*
+ H/Fߏ}syry ~:}X{/t;'Fs3`[N#RWдO瑕cǾ<Ts=mXsR.oZ1ZIؚޟ/h)n9e{[/RQlI[aHBIJqi|%X{'g@TR=/=PnAà+wrg?Jmׄl\ܮJ@.OIK'x%yڕkAGF:z+ 4N*E?~Rbvv%csN
+(}Ijy3Py>uac8j.wmC{dyy|'{{e!tfSFr~&n+A2Fas,F6z}r/U[O"wsq=zroШa>Ϩ`OZM,kx:	SZH2_=8EDA +N=mMۨHE|^!Znj΂~i&6A#ijΆW(R:׭%ϧp6j|M}]J8R|g8%_ON^,ʯ98
+.(TWvYnGI=j0OUX\~||J-e>{H%Q\~7j\.*LX@^sGv|@jAmKֶZ/\y8-J֧A;WBAC
+YL\٨]yN"<c{X{GSh_DcFK ZkBHY'at5j1y(Li.g'6̩kϯXM?(H6|m5XcPj5
+Q0o48	uQ]$P/]Rlɼ:m$ƭ#'$i`=Udo_WkU3H82<:@!t=Ĺn!VHq|y9{YW+F7[M,@NPD#Fۼ6e3΀?QJ;3y/ެT*^q?Stz<>GmǥPq!U8=%2a2Z4;5C7;{z108pϕ؅va
+ɲdSF߅B{_Y	e9.4F*]G'mq76."VF5uj3UzUxKX30mu=,dlڢs/[3o!K.f[jȒ]:j`ƮkK`[|WxD{ʦί3 Gt xg- `6D߀3I?sX<x>$iJ7sL|&G-\>)`no"nB78wD1M7cJ3Wf~۪j*Fa<@CvQ/Y	['7]_J%_Q+ҭj0QߡS
+i!9$.e#g{蟜Y:ggJ&zO-/Bc(|*1Or$r[bϹqi
\ No newline at end of file
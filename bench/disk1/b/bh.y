@@ -0,0 +1,9 @@
+XhmQ儇<BӒN,؂?ijί4~ѠK
++2k'f[8:cV%
+
+kBlrp_zxC!鲱
+d?(|b~5Ȥ%[(҈>hxSJ/ASƂcTj@<D	ҬN&$s=]VxNJ^
+"ƷBQF||z<ɻxb8.Dme6rL4[^/:n"r]qB1GA]>2?uo&_*6)pkvLIj$p(kTҜ'4rnxw6?X#eHbC_Ob~⼄ق	v{<7J295SvH^m6Gw:fuQ[ᙩX}oMWAc[+~3p`.ᾗRe$ߊByzeE5UZ폟71OKY9&?wARNLװ=a1<]Qk}Sd2}D=йܤO>vIfT4fa&H'vk=i*QzAlYO'U9piϘf2'*hS|*E~u^_#[n#d>snၲ]rΦ2PxQ2P$@-<D<uWZw)''3D-$8;FPݕUb'{j?j+D3,FUfɳ*P{zO''uܔ7 _4{
+?mMi*+IHg9&fk#,yGIsi-OW:قHem%SR8@62gzӭfT:wr-sIZL!(dbk@/"`wqD'%!cCuh:"1BkWh'mw*l+9X7ꩿ\ꓩ[Ӏe{RzveZ4JxPe@|9+^))'bJ]ꗙ>{7z<͸ҖM7rzb0[NA9+sZɴbzX܏1PmG(Ck'PZ9^[d]pB 
+@u2<,(PAh4  &Wp;^6cg()s3i9y$Po$Xf:w%/g%FfB}:y^c!W˼	=_S;/8B^c  ٺ[A(Kee>7푋"]O&m#9/lo\'%QJq%1aQOX8ntwW!	\r)KɆ#vk`Ө	 7g?.lSqhIWQh?$e۔2IvZ#x'ҒnN؀!%Ҵ_[%a	fΐ"xUFF֘}쪌:1hA;lq_tVaJ櫧/^cE¹a#4,jއn;aȨv9gTJ~FV:}z&NK㌦F>3BX|5.;@2$@zQ9y092q7݂o&$CNv3?'zbVu5ሀh9v/PR~mϭTDykD8Wit~p(H558j/qә\B/{m8"[̨u6v|wٟɤ+Zz4F_c1D>/DX=OO,AʫTؖT(a$@q<җ,LeqrM|d{bW,\y&lX[J12,=;`ٌ[Fwq]8H[Ghrʼb7Qx1I}|ɽ2s}P}h[+Z颗{I%:Oن
+C]);uq-ҥmL"r``Jpm?M+&&/L,
\ No newline at end of file
@@ -0,0 +1,13 @@
+2{_V-KD]\uRPi]јhu[VX2 ̐zLdFkJpl.D$&t9ՒD|Ǧjƭ-WXTU?nX?OOKl;<'djrUy۷hM]w{ȖwiRUwHL+;ryy8d}S3>u	(H5TAZǫSMalsA9>_.k,9~XQyFzSx~D+/?Q mxn=B H@F-rswm~I}_-[i<<$O^S
+g+LrMrhǒؘa+Zu@= 2w|G^\_ˇz?P/v|CUI
+ǊvdP0FMf_4}KX-@LGM;,U}H$pq_=KΩ0ot	Z,o@9KTi2XUUZFTsħe~"[2+d\`8)Q:ԛe}ZEB_;<2Fp?!䘇({f,(h,H13pٲ	7zDPˤ*#)Zdn;RFb*ѿ>CsN8~-Ӑ`H35·d\ g=0t,֢u:+}RY6[Ͽ㥑QO E0k;y,ZU21tw"Srl<BhktB
+<2;;Zm쪪L3|wǻ$	MB,Yѿ^h@(A]:}Q]%Ƒ-χ4a@qY#	'v
+3|
+KCȥGQ:Cf3L<g8q@;^TKI<?]&8{^ԁNx/d6'8%t)[?oAnYFcb'ŢAYV .5ǻ#lզ_@7{K 3M8d O9SV0=N\~yuLo=AVbA!,tn_5	Bԛϊɥn=-Pax#W$ش.2C4^g'~]\33''xrނU+{J4ǃ#)y}Ͳ$WU_ORxgNԍUJdNm7Ov\iUF+]1)8O1hJ tYj_q|`䀛Jzd_oޕ[BZՆ8|ʂ];%&dA7G
+#DEu-KUgi%u0xsg,Ƽ/BL*.L=*d3uq	%(
+PHS[ye`OB:;>!bҚS7ŉ,.y*8_[PooV	iYbm4xUSp]k53,*6`ŽOŖJWYPup|	"{u6~|/"
+`"+X@2ǹ>6{=2 [U1/W|m8>QԭR/}SCB+dѫՙa}|x"R^amh7h>oYP*esns>2^ҫ0`,ۑԋI'KXBLÎZGIVʯE6}1u(A95; ެ'zCuZw.ϓRkiS=6;0譱Vke De~tX)}snzw+dBծQ!ɝ"uuvܲ|#\ωf`;,nq|]V'<~P*hCvbYKV4b)螗MwOѳ@BA>.6]JKi1lPdg~#p1>cƍd1ܩ͏<\nQ"kn.ȶq= <z!_5sÛ-i	ɳ%n2t"̱W˛G$ı(Zb;QP:TYlWNǓ&{S-=Z
+W9o$D$=-ۻ
+ķ嵱̓WTgr%​5V!yMUmu{1T{N"y5EpQ3?wӥF/0z]SAcgFm?RLQ>?)[IwqOC9d{fT?Z_C8D6df$;yz&Bϝa?+5y7JP.(ClAcXz>~un$w{%;l/OX*NF-|g"EabJW[͡w"{/*9J(A[B5{UV'9`ۊs4vkY<:GZ(rͥws~<u)6\DpB}NH}rl簝s7!X!@֎LtK-`UkXΨ쉠YP7>
+D>k2	tFz[W,t:Li^7@1@w.7M-\͸JM{dN*w0(|*H<$B+ǎXc~7]W60(5sNyB% 2B$e!vjCި"v@udY$VY<ٮB"|K+r	_U@2Nuub8em{:<8v\m,O1'\C2I)I_߹ː٩pϤ,~	B%YRuf],঑7A1NE`yeN2ַip|npXŗy/Ě]]!<YɃ?R͊f$GrLI|`S~07PT\rG($_04N(ybc=տSGNjLǠ2Igd0̹Y#r+[OcֿH3zl<7i;+
+M*v##'#tW-2ducDS&Yt`jotx=Lԛ.q[a<^.
\ No newline at end of file
@@ -0,0 +1,15 @@
+!N90_,S˿(	.>̙8~R̃_վ6GE`{Mr@
+iGX
+?j.E3a?Tk63oQq2Wk.&IUJǌS6;xj]5m| Sel0swvd@0DI[UV340=p?+p41pjSU^y.(sP:	ZХySKeb A,"{C_UQ"HwFړޢ{;+;ɑfNj.`?[ؗc&1n}qj(Q%TYF
+xykIT&0~Հm7_#=_Ss`eߌSEx8S2;V3YkO"^=C	X$	ܶqgoS2_u;B}?rwbe`"DY]7oA,ca{YuRdyf"'8k"{<zyn~ׯ,EBy[IWwIvV\]\L@aO!e$Ƣ|,=z[5t	b`
+R^yskEK47W.zC(=.$I]PnkWÓ; tc0	ӿeUsBBJa"9}h
+'ț6.s}	?Z+Du`-"ƚ2{L\?:]xCH`4kDeaSwk3ok<x[RU<PQ2JeF2n[I[Y3_K}쟠_zy7*$i?fgT~6*W"K?-
+tleyf{ʆCx,YcQNIgG_9_\a䪄&S-_yi?q+Py)jB̞n35?dW_~'(>L|wda)5XZԇsE:/b(K_9㾈,T2LܡFg;jbJ9bAF9ŶsRܦDeSdD#RqwRj"I9.l7KS_yI(-'hu^x8IvHn@p
+؛߲)mpx	!'B 
+2D(oi1aR]9.-?ׯesZUY7Y84s,zhA&AˬX`Ӂ췅*8+=<h_]3Ĺ}o3EPM7jĠui&t4Լp	8%هF%mj.I]zz 4k[ PfPGN &Mvi O=GPtꥰFF 9	]'	t`ʦ)ŏCVկfwsj=2[89irw6s"1ZZQ;zD^Jae_VVm}OH=߭g2	u/5(ւ5Ӂ4'#ƹ5ڣ'/xKSQfurwH:~B#tĬ
+7z}oLs4kϗj|+T"lڅӸ	M*6	E~h&6{,9p3b$Cc\۱Lzr&ÍF-P8aؽ6Vr:IdzS@$%Wc&*4\\$ֱ/m{ʑKT7e!WINIڄ3ϟ3g'ndI)H>iwAp!*iSbܓ*jv4>mלW
+\vE6xHe`{r94vLwfO9em&t"ag7D0Ex.#D:FQ[de-~R=Q~9N{')&.4.!ch*:HUG`C)AcistDۅD8^hds5
+3d1xY t+o
+4
+)5:ybVKUZd
+L{f8~ӲO/k!>ron`2BtZjÏZR=(l	D%М/YotF?{ߠ'pb))H+Le
\ No newline at end of file
@@ -0,0 +1 @@
+PW}mo`?ړW3ETHTղ'[DQ!hp{$OG@<`MqS8/f[
\ No newline at end of file
@@ -0,0 +1 @@
+(>dt(*EQ,1l[_T\$E{"ΕlNyn>(s*i
\ No newline at end of file
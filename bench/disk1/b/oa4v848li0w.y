@@ -0,0 +1,11 @@
+@--HUOMe,z)h˧u."CgqU{LH{2X>U>GZsm<:+7da}DD~X¥ZM`lkG<Y'nǇ9>Tsl< VXJzٲ,
+	MGvkIa bbFM
+D	GCQ[fOA6Fa5gEDpɨ:?O1lwо6C&Ac
+}ۦn-D!gF?5`e}Dd/%APl-ky4{A<NEY2&:՞]pEÇk(LA+{$T q£@զ%	)PV./KS
+%AݓIJ&aϛ֞G4}w{KǠ-_R:9/.E%$+o9PBjʯTG8B*="R&z)H״S$.N(qF@':Mȹ)BrjjK61Q28ҵK a;i8uPρNsn*RHdГj؆u34POp^+~L-Ŵ؟	eN
+5:cx/%+5<(矾Pvçmj\l!	oOҝu$VNHQxF.TnJ[!_l=5R02^ܷe^[zPkZ9fRXȭF7n^v32l:+K=ydIWcⅷuΝ`y8xp+I΀4X&$unP)5f-cVܸ)֐FY͚]7zjVcZؘ<(y#|;{7t xNgFQt"97.KXg_c!_i[=?}F8a %Os7ǿP.4^SP%4)jO`~o%tu:^B%P&xms>dk\S1)`*1_K\<OJ.d5Q}ief>N7Djl>I^ C?qs;݋R=Н"Rm$B=K8a C'g9n}R}hc޷JfS%e>6)TQJG]		-ThM)̐bwtͼЉg&ha_][{P-*M
+yÀ7;1Y|vXOz{fcfÝ@qyF:+iKФ%ܙɐlISew8NQ@7mY+-}e61<R}P'Sj ܏Xe#o4vRKpαeq%7-KՖ%Qx^n+EX"G(Z=S9߿)ʹp,
+,Z$)ܝʺ"aYIwE˗duFv\d^(+!(/ރ9	|G
+RhxB2PC~1ݽ%C+^,wG<~y/ЬaC']~ЩdկVjYՎ&-!T=|a7/01i2f)8/
+?˘a5V+0!"LrCFݫYA~UF5Ft1sa):,؉3:%(vȔ!p98_j0ԧZd^;:wV(>mԋVӱiykHS< <,}\()_}`!inCD?x)+m+ހ+LB w:M]EϟTkƼ8v	ot&+6p&3d[DΚcVndI!fWlu>偿uEϳ<?P^!8Q/T<g`<	_"m_].+DrՕgQⓁRnB8VwmԬ:>~ESvdL_A77<9Xd~zGђdrW3Ct"m:st^c`-*&dVu̓>0d5A9oyϫytH2}1bЈiwHMhK@|'͎D׬跓:%=+
+\.+>nXV17:/Ot\K7`#k WrZg@Z!pLXy4dlih"8I[TSܿu<(y~`ؙhs0|y3PX9rJ[?'(@,\eʛx>i:j'0/4N{r3ՐW	0]l{dx=#;܈⢇fN+^73թ%'q?5oaN--Bvoj@J}[la;jJSacCw󌫫	R]
\ No newline at end of file
@@ -0,0 +1,5 @@
+Fp"ظ|S$7:VaA|l#k5oPEJ&8"%wΑ9?LTle%7u!ѩP}4^)S3zX?^f13D;M{oq?`-N/(B-ǶD7y\brr֑b &'yGU,}|&XI@B@66_\1ͷ+i0I[^6,oX+6pnXiC;/O{٦_Bг98([H|+`"17JϠ?62Wa3cMۂvn8Cw=reIH7E*dOzKtdf:@V1f`}`x*NZ_@?J}0Ž(P|p[ثK7Q+Ejt&'vW[mGlw[.AiCbk-`c{~C\E/\Ӻɲ?tTRp}^Vdk}QcK[h_VޙP4bgU\(ȧbmK殻Ƿ.qw5k(f""G&{J꽡NXf1:.#>UJifMjYl+Im&	rp4i_qXħ%b(N),EQm
+fRGRtUxGV=7{R/fS?yT+%^."kk]=*nQN/5N$:S+L(	i;t>Zʓзuٞ'xĊw2Ͽk>Tf>ĥQ}aS(`ϗ>=|"@4n2$8s0^ї8GA?:S߭s
+FշëkTJdUf'7y=J;VE56hlWnEEUV.C-ŲGtLWk+)LSim3豩.C\"Y<91agPޱ~7m|7bT]]yD3WM)㯄,-_wG)!y],AOgAf,	Mt&vU3͂LQNnLH4#EL_zl"=jE:&a&plfl,\͗u5h$42ug8/0d98:{/e_)'iö$U]k%@̹[Ɩ5y@Q[@Hw)6V;p?mh7)Ykj0df&{9(ߞ?ԇ>+i!ʣDa5K
+Dx1++
+|=QRz!a]^eZ,=<x܂viQJL5+9S`,޻4(PjR2Y=P] QXn'O-m}Q)-,p1#0;V??>Sj
\ No newline at end of file
@@ -0,0 +1,13 @@
+Eޢ1ejI%MlcwYiGT1\nHǙˢl+o8L-E NJt{_Ӛ7cz2Qz3!vCwl|2ھ9+
+guN2,$WJn춛F2K/B0Њ	44+ͶĜ+x=<j䥲d"܌gb!PZ#-]R^0coF6]J-?@íJÓ`k91-X.8=U$Z_ǿTFFwm)!:{Mzv/xkuM8ssJ0\2mմV^ʵJ_ |oySOP3.fx$EndffL_"RV8Dp#`tq)wZ-d 0 Q׶hOoQ=ό`=tfx&M܅RER <8g6${s{l%vU;Y.aZ)m]%q)kbL񹛜`agi:h[Pc12,D`!i.ؠ<Ohye}Ii-ov^mS\[y5gUvlu"`?׷be>zCg')=rZP1{_}db|l']%qOO'X[Np!8A^d|rąop>s!1BȈ//NT6NSY!X_c-R
+K48Q,
++P־]ivmsܠ%"N"۰jR}4t~9ǖVes37[ܳAݥYO>Eh~c?SPL;Oep
+Ž9ٟ_YM-Q
+B6dU}<1U4?b_擯$T|&2% xfC֕lgF캷ggUl֢.(P/v)F݆}ä+rR/{*"[DNW\k&?M@
+S@<ZujXGUINo-圻;^b4~tQD)'^L15ξd74Hiϐc	+C?H!nn!v.FuZZyc9#\>lnܔx(ySg"pƵ25ɦNzVv 4㈥IYCF<7@GlehPX^>=abQn~NJsXLEHbIgdÐjhgQn7wVU:+8<u1uB@2䟩#%(U~&du#rϴ)GmrM,B.m'٦@MXleNb#xkjimvQ([U>_zߨ& +/2N<4~hln{#O؈&CpBr/׌W~j]?bEܟJŞ+?9TvWğ&aǮN]?Dnh+G yko2UUӳ
+ʸ~	>}VUgiP'}@TD$?yma).qxu(oi*_Xr}\?	fR:-'Op2s4@}/%W1N431zg:7?M.`@cU")h?&hX
++H4pUk<8]
+]u=LW6jqfh9bxJ5'i&@ҧv9YDrQz-d'4BXDƯ%WUjtw|l(^VtRUÀ'WְhPVY,Ԯ0	UuS2V9R\		uhVЩ1JvtwQ0?@0BiC+?ғ{SAetfZJa1@@xr2O~]4=e$plǪqDAwNd~LJlF$k:roBuT4XQdApQ/K0FsۻrY|GTi0ni߸;\87)8a+jϗu.CUKUٲ7Hkx/L")VE+V\խRHPJ[D)@=&;7KKe=u:CCU`[	Cpip@]_?7.&R3!]pV'}\.N˄vh&
+^ɢ}Y<M-h$_1ϕ9SـS)x"SbgTU_9Xʧ+<ӽ}?XilcT3{X?{q^*ev[.Z[d}{+3&E`{SktY i y2pNOlt1}He鸎T0=@Aa҈C	AǈH#1FŞM`G."ݠgNI|8ɋɇڑ!+o	Ev|orщ8mA
+Xh^"{/VV_mvWթ^ʾ7B-Lkx#N:wv{`̋Ih$4E;:We?k^ś7D}!8@.äj9C2q	B^_2a1"|.:Duԟ6(R=zY|֩`&6=jIPp8i[_+xX<.eClVGfD_2B{B+{j1T'uv[w0epnd\Ɩ):5uy~41uLP;Ղ87
+<$6-v[ݺ[^R!ޓITI抜49 Ֆ׌9NssEpK.8yPS஧f}lvg=t	J/Z:8بFnse"-7U{[0EL<z;C#PP9"DʮGY/3Җ{YlL3qRd,/{=P8rl
\ No newline at end of file
@@ -0,0 +1,15 @@
+JFMxsXpGڡwѠ~7K嚊Wo-qt
+LV38z0'!L)*T't<BrVTpdRh˻>HE$ZIV|NoDl]t4lQĢ1*(J-4FGuaCв[OL;T?zI)]7;lDM=TYAzS/~AV,
+`2ht:g-B
+DHs	~Rǩ&ts5S؋LX,[<#?zzs6,<WfR
+@v/l4wּltE$lt??<ʃf_R+6/ϼ(%.x2^v^uӽbWxL3ȂCv@zH3*K@ES^2Q/xύDw6ɾN*h5ݤ/'10Otzp5N}d\'qOW~,>֏jg1^k;2ح1^$HT|˓wBLRNM[}edȢ5=Ӧ]qBCǲwXQ̅w&m`esn
+ W^X4[  )1Ey7!#~A]8P@GmcC#b%dbK@Clfw4@ksEC~aqjrlxmD!7zTGN^X{,KU=u%!Id|sCܑC/E)FgrIc`/"'G	٠x7wBS3rbE"D?9[ۤ6ǍzHDc譍{kL+$dV׌A4tY#	w_7](V"@Mw!$7|;Q%v!wT[kUPQ^\:tԲǺM7rRޞTmHDό]~ụ#vxp=Qh7,-$ak_|S$Dv\@xJAn٤צ撒`_.{Z\-aoNy[C{p&n#6QRUUs8nlWܮ=AZ&`(oFسy9}h1|卑K>aGe>hϥEGYsUa-bXfZHm\:L~/?sWc*f)7~u' /hwiW
+oG7҅IxEhr	j͓HiDFf\@L.LkL4P{5X@!3?_"	=-8
+|0;&/y|soBŔiv$Ձ~0I{
+Z"=-S7.Z[kd)5+ZFlᏚ3flJ7ܙ
+2bWlΩϦO`T:qI2yf~ԍ@@iϙg|WmZ0utp4>.UJ;?Kv|EKF"K4L5TG2A,;h;oZ[1B2CC<:qcl{kJa?97j!e\;.iÈw*k]غ6SΛjE,8ɫm
+VO×reI,=-^DpY$YUY,ō-Di+laUvY!&球9(a8}t0O{H&u|}mT`%nWoAu3UdԎba! D-Y1;ɖ?~}ｦ
+K.}65I~vA"lgg|w2X7b!/tn0?{f|6BVf&o2
+צql+(v$֧ؕ9XBPAjx]gIk f/}Ub߀[o!!l+Tw10yl#6Mtd1'~N3c<_CGJzK<zQbP!"N@8xDɞ\#|$bB[ע+."4ѿZT/JVW#
+&qUb+Jr$JNL!xƧDɈkspfKlPRkN\3a7}`/2D=oaGE?$nw^ig'z6Sm#,r#"Ů(n(`·- 6zʠ?$͞6.d/Ro9:׋-o䶘(h$V,;]j2j:yjx~pu6mQIVg|#TAE]l,d?6ywN?%l#jH4@ei^ju*#=FԚKuQEÙBIk7bWp eƂP]l~OW1ClgkbHIǌ"bP{D?7	O]o<*Su/
+ lP/))/ײ/ȝ<#	I:W=~oPk֒_IgyoPC<t0FMؗٓF\
\ No newline at end of file
@@ -0,0 +1,9 @@
+vznp|+mÇcǓ<Lr~(B'kt}!ÓnͰE0_lʼRГX[2-pUԶPH_	w
+"''p9=w!nBd?MNv~Xc*US:+s/C-kΩ?ܸ)«JWXBy&ŷ'3Y4u=_27d迈4Vh\Nv	f|pm|eޝۃ?fjyǓv0dzڰ'+3JFH
+lb௥;
+%	:Aw~4e)EKKQ_+`dmY~9HM)g.ݍ~/l6XxrbLɃp4LmPn6w&DoU8Ry? o&l͟U5=$}N'A\Uy`;k1;ou!UKuωhF6dTb	71&"G֒Plu.(a;c<⯆)uI.[/M~OpMFzIO.Kri-Ej>J
+/N1'L[.tIM0ܼ]ϠM?ZԜɴ	L;An0I`lt%RUof2b[پ۹D
+IiD]Ԙ-5z!bPk0`rY\S:4]m&GЦ׾77/%\ݚH8rķx6#+FE)U'Y1M_۸tj|y~ָ)0x]CO6T)h;:p$ т1x5В3/(6_xb@w>v`56SR$fg[4:~drT{d*7YԵ&6;U[[/M+0MASU.1G+4vKeͶpD)Y)rhZ:2rf+f#c06\+'-Gf56zd%>I"F6#oNWm~9ϋ܋lǲ_Kxn!ҵ85&7j꫟YHQ9gOfֵl΁O\W/w/=jDeVlbv=ylBcjэ$Ps3QO"}1N)oUa]Jd;|Y߯,⛖EWf^P(oKQw߀D&E7[F;*X;,E\:},Rl$%k",
+$|C78	C?n:3hS,l߂Ny, LV/	UD ohP4hf
+Aeg@cΪ"K?~}͉ '>QQp&*SPJ4<i>;
+~8d=H`gW!1^=AM}~x3vρߣo >[NXх5slMѮCboE!c2n/[ L)XJJpwQN1.ڬqd5MPOPzٳ%W3/ߦ#2PU?>ӢSKֹb\Tÿu8'"hq*=
\ No newline at end of file
@@ -0,0 +1,3 @@
+?:>oc=6ʤ2	8*D"ğcx\Ψe.~2}Lws>	㒼w}8Aih'_+JFօr=rѳAѡHms;#[.9`omiFلe4.?`Uô#$i#^ԒARy0Lz'NErgNf٪}eRSQ+dL[hoSoD8SITg(ZLlQ=D8Ze<.g;h%6t߀YQn~HX5
+0{L	Vg(M+⋁^B<4r` /H'0LEuM#R$`嬳{A=weXZ=kѤBx3r5,'9,4~9mϛ3hSCV)ۤ2i0V	*a7	~7/Xi꺩\g\6om	L2xzݒ	/w`NGrS3d.&<u01Saf{y-;`TwEtCZhNJzdc]@-+	3 %:#yu\7ܹA|^^BX(ɬʒwTnEmu\(D KN7|59p&0[@L$UIrUILM]lY5iȼE):XXvmVAk[*I,}BFSs`}~0t;rpM@ύ@tz?uFu̇ ̮GNz; %Ip6rj}sC?NZD>KR
+)қ%栀sWOR({\CR7O=<#!_	g!9}bCSKpD[@ecQKɛfs Zx48?S߀|yO]Ha~mutNɳA{!2oJAGϪK;T6yjMM',oq{Ⱥ);Ѐq#q@4rZ<U[@T!`$5Q hY$.5mpZ-JI7 ۤOst5W4p$O>$
\ No newline at end of file
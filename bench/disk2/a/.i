@@ -0,0 +1,22 @@
+G[m'َNV)2$:l8J!J@aL$Fr+,j unojr);rH ҰHlS;.n	Eu\#7'`㵸Sfg	b_zpUoFA˚CJBp؏V
+~:k6&8={b0SKXި7pojz9W$TcU%լϸ_~[39Put0pO{4QQ"8`2?{u]#FG%idlf{T"*vt9y}zyÉst\<W<D4њMn=.K*ä5(-ʅh"%ZPTfhB5dpe	 \hAc+ C{ĿKdd7=}&/ќQEU	.=5f [Մ&H2VÎxtj+$*E6$gZCͬϼW[nR<גoy+hS#C,Gۊ7(b	);$WŗoiC!O,eF+<#uGfpCګx?[CCڧ5uК?(A[2̅-8AsHHU_/	
+)d8 ԭ3S@}ТۢoHpEU058djeJxMO7p$u#Ln'.C|TH$C7 ooĬg'|hD3}ɚ_io-Ёg}Ⱥ5^ahv{T)F>ٚyNMwg.zEs|ЋW9Co8H2 2_0bh+z>eGrR=-.?ij#2
+'*郓/#6\ 6JHe|^I[|qqcM.sY	YA(
+yTE$AwC?mJyJ	\UB+ pE8^?M!`>.DXk@1|4}"0o#~C)}._x5AgS^	º=
+X$?}љ!/ue$ڊ"H{KL)BT<$ta+v LJ&i/J'53?|Ys&i|.h,ǀjk%ۄ5Q+9OYEPS(c:τ>x%	dWl^0p>%ޖp>f-Z(JK5o2&$|R a_>X_p$]!$ʇ0OfRQah۹@QU{3@~1m)9TTN>l.Js#2Ⱦ]OfkL5c:y _"1\d:1KGګ,'YPbYw|Ț@f,͉h>:nbXj`ͷ6j<JyݝJbwx
+=^|A̓$]UɑDu
+1X^N2j*9Zi59xל)'ZqRQK^?LW=Ĩg~9h=[B
+a
+,p"xW~j;}
+?;`T؎֬)c~iIgX8ul<
+./4+|m+L-}*Jp6kD
+]#0BrXt'P0pшrؔ3G.v4tFIh.# MVxӨcGA.Ow^T
+dTd*[,Ki{(*$:74\`v7r)a6OM%rs4`/:-$6VXu$!ZlGy?&hE&X0RC\FBD"Ф|іiPMwr^
+X&(4ꁂCWtb+@%q3[igӬWpJ5Ot%;~ۛ.p8\@P0//gֱ<iS^9Z7^9b7Q4R{խX:;xdaMW.86LH)UY#6[h*Lx(E~COte'bmhX`VSry]`UR!_bjȝUJn|l
+Z)+MEMq]3$tK^r'f
+t4+,Au#Đ#SCl)0e}D&S}YL_3!/N|	~Y OQg ҏ*唔MMNcӲzUp(3izikw"Lfҽ8,XZ/,@9;tBj1p/KYַB=cT	rm4R̽p؀7uJ%pq7i'bLVMV?eW@TM!'+usX#gkox>W/>۶%~gqڞK~zv*y59>/sۚ\kg]+L hI@TIGv1fot	=$e}P'*;sfiOWXdR=$A_Vm@r8:Fv+6 *~cpG#o:&?AZYh(֔DdK[ (CiLqZmr@/.3>KX6~x'3\Kh,Eg /nu>C[JtQh
+	.nE}xgxLm=	1ec_̌ˊ!<3Tԯ-kGZPLw*#nU8&2!iTBIm
+SM/ӑo1|[@bm v$Y}2K WD{p6%#1Y<ٷ">:Ҿ΍"7Ѹ
+gv8:+j#ilY~,mu4RwL|T_"̥2vNBnH3䱦yTu;˹@Ō#O9%sJƘ#qMd~Nbp
+)Bv7An/YͧC,6a[_?SAZ*!2XVXeˍz
++fjHBV:Xh0$7D\h/h2+>gw>|s5웃x歿6"+gOFЮ<,+06$Ho[kek	~z+y_P[փpp#-+TzF*ڍLpH 3蒠UK t[3yhX
\ No newline at end of file
@@ -0,0 +1,7 @@
+;N	G/j/K>F\lqhҜ	T<LVcEA`)!b>XlUc\?Y+eN2ZydL2+]v6v8_R|7HM:7ٻ[$j>zїϺ^؋q
+iR&~|(MɆ݊QͿk*Bh,W))Na`53.|ю~mSG,ES-2Hn(ޝGO#XG;\5sVт&_IYtxeZK`gu0|!.OܘU(Îŗ|ow3pNFķ˔{<H.PHQ UtU{J,ukkЙZcz\]ԑFD73m׆>L@xs-f)?·r87ϦVh+<EW.m6)ކb&ͣvݱCsvùTT;k;Tq]:\CZjǍxm9	H~G[i~'Їvm2&uGAL=W}
+aά;C8Z(TTz+yyV=rJ*gHæbBLˏ{=83EWgK'.4)nGsw9L#{6ZZG}}^p84p6bP*N4~^A̦%L|P>)}",(5cx3bn:B:h֘y`oKW!vk9[BfJ!.raCK~kg!ܵ<81z.@F!SG̶btwSjPXezazSKJ:[oyE|t)cJw$bj9S윾%c)| Й0Vk<R'#
+>Ü{2ARex9V뻢	]=ˡ0[ӧ#0Pe>c7I#I+D p0"I^"J8gkT}Cg/t'ڴk;XpR|DāmIi@ۗgLXY6j,@rkZo:xw"	$/9ۯLM;B#'G
+ٛ>P+2dcJrv8l]-?`/JqvOy,5h1,q*>_7oK܄e(/Ln:^O0BխO/(7~YkeSCi0oy|	﷞Ze3ǖ02ʽ8&4߱E-|5LFvKC]e0rKzv;@}1 oZu*+YUBĤfg;=RX9l
+Zlf=fK{#ep.F(`Fpޞ4 mz$eWr!n
+q!%RlAMDEdy͵^c7 ev`B1,I]xiE?qGӊŉ/!tΊJ-;nNz"G{fet1Xe<Jdʷ2.+#I#ޯ'ow6e/Jt~ygMIse,Kٽ2&%|oĞ'ښvFZGsnE
\ No newline at end of file
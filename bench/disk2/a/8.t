@@ -0,0 +1,10 @@
++	bz5x/|k8
+=Y\
+(%D&D{lv\{D$o?)0jKTChAV/EuЙ0 t@azk`P.$Gl	bq:~PnT:*BCo+K8'dx8\(yp0213h`@d$u~9Id@\ß<gQ*0>6Wِ|#Un#7b>\ZhM[oYnW
+!	Ȧi"L"Vk+(FY#'?i@HټX7|灏%*ٱ)Sғx]{qUWJp#ecU%.L1x#fU0g?bIBj<+p-'Bu	OArX9cU.ro}zGX@Cߘ
+RQ3b(mPCR[D#z6,1B;$h=/VPRKT5Xޮڗ
+uvEĝ66$r(7竺見۸$w'!mх3F+Ђő_BJ^9'}eßDX¸a,g{$ţ潤7Fh6D\hf<6"ʁZC=v!Xfx"mf286 dn#r>EUĴΙ69K:vX`Q?^K8yg16&bޯa*@/`MAsxfm(/r#מB1hr%4&
+w3O$syΧo~rnqJ)3SRbA.AE
+'$2i;& 6\PM].Fެq/dͭ3S*|aٽV=RDMCeh}%j@2׹9JVa5PԝĉG.BۥP^>MQ/t`O:[%peR9L0ܶ1Jog_56Pb87b~S;;4(Ekwk?Y׺.D@׊m/UBnx9qY?L9	_Y۱}7!ByiJǧRvTUt 70%Q/`6iaaJA*QOef_l}8bz
+tAx}Ltޮ"<]PL@sŐ,E?mP*N%GMy?5xZxŅߘ.eeZh}Y՛`*;xF9rU@9Tt|1<cQEmCZ~c+{}2CcLݨ67jTnP9B0umu!^Ԫ`39&+dy-{cim&Tc3"C*,X=nQsGrK~^s+AwLCM㰕#ϼYG!o|T;*ǽ6Fêth\_Hr8Z󫳷6)d t	NbHL>rIXCGѰٿJZ~nIko>Z!)#JQSgp-%3Y-9e=kJke,kfDSW@֏pU99DM\An}-9kC[2ʙ߆:mI9S!L1
+1NڏDGFE^)=)XMQʜ\R0^v.jPGo#0TWDcG+Wwl|ICYvRIcO .5XǪ|R""vo"ιat}$JQhz0}e	eV@_?f\*r
\ No newline at end of file
@@ -0,0 +1,25 @@
+V)uEBma,܈@)
+TUe
+_uLI)9lj>oI9u,JG!ʧ}	\čdYں@=:O;ĖZe,r.k?Atp~>Xm3nJSe`N9߾n:^z`ZċRa|!10e#TZ)gp%8l	x_.k+p;bWb%f<<Gߍe*CВkjhJfgx!5ȸP
+2wAq@<	T"72X#Ȍֲ`b]Xjm:9goxڢ6و+^s>tk.tQ9<>ɸV2,3<I㡿>p#½oM	v>
+ZQ/k,0`uoH@3K/jZn\=cS$M^f-;UEgsAa[4Qb6u[B5~eԁ8 $B2c:]?IQ4pȫ?"gw?خT{	#'XqZt#M+l/+RΉ:i8F77lU<9пuJ{uc#Q4ǽ}z旴+nIqOh#t]'X1(µQ%}&-%{
+en	Jż
+=NGwۦ12:nxkMSoI"
+2Yb04INz9@_<@j"ڏy33qYXH-PS-yL
+
+L
+8Nټ\ʕin$\{᎚?rFgZbEzz):gĹ *ݺSE´e<(EWPChKfQA*;#Ov~>le5\2/ƃ"IPk>E\1l(n(.x.1wXgac;V49.suİ>nae}|NH4*$='[s|Wx|Wu񲫲x%b=-$3$-J[ot؜$wtjP+m d""]UÚ:(;tU՞URA.V׃z.\<;	.e#E}kXAeGC(!l1`Nt7N'<:LQtrDsOh !KǂZ#Tf7
+~۵եv/poL6Rhc^$K]r
+,C]W+b)[Qq&>8?|b9awl%\ou5OyPW;#&"\`e(#1[BmpYc(xx)pCQ0(zW۰w7wS-`OYĖ=gS{6`
+ɡՂS(jf3a{M{ߺ%"ϕ?be&87@dq{}v6C£>=Z"uwVfr#;4S<>)>'-m/
+-O'%avffWC 4x웟M<t-%)<UlHFԫT})T$8qNKʇ3gx5_gHW(W0k( czO8=`^%nqHQ$OdX*|-4zPɖdb'leXgb~HЙ|?0dB*b_)BHFu0̕Z'X]p:-`ai
+cr,]Sp?'wv]2Ro/O24$shE,$=ovw~XY@IぼhVL>YPߩǿg}uw5֏+xqq½=\.<r,N]?,Nh(J13M7V+iѠ9%xԽ̡jz]0.f#C$.ZzΛXFV%LFcNK?by.YE	}!$āU/Q!{.fBskL ႿpȶlnD
+Q{x}WڜX+j⏛i}ܻU^޿oHM6y8Vh/~t|!Ϫ&3'`]TSXƱB9,YPE#<
+9	Z}&zu4Zr9:$i @p|zEUh$X1'j5vNVm7wTDTH~ 	׃:pRGv7^oSH=22'LuB*(#GW*K)7KoMJmF}gM;G>\y9x`1Ü{:ad@1΄9Rص%B@/!qaֺNN/KvAջ& N7	c[4Fq63njngU@b&\@k &;IM<<CkɃsYExP}Pʶ,3Tvq|#L[k%V#׊,
+MҩUѰޢZWzP{3F
+"<Fwp)ܳe߽NoF/KΡlÖB	
+N'Ag֒GTݾו0BI ;kЖ
+
+>w`#9䙳а#\^9$I}#WzQ[1H>L5GX4+u]\ϒaYI -E2rp#6Y;KsiYhU)~z*:¥^[ֵ>1ŲZ}R}GxSb(eIeaekspT/7:lEvW#)za{-\}f>	"MO*pЊAАoԎ4zbIbfnvQuY5"<(?NF0'݉	m@)/Kv_oϛBk]Wkrd 5ۼK{{hP~xk` bFU3U\=#Pp֜^ת}t|5Xm;Fr+3T/6EYyFnȐd|6`G<~BY	HJ-G$;){U~kNk#P 78)Zb(;ϋ#*ȽcʼO!GfىyhMR|>l"AztۍK@q^UyN5BQue(rnX/N)UUjQ2T]Q|fADWzX8-W!V5OMҿmlA>
+TO[{A@:H\(BYfr(ߒ?mE╉a$
+h/|Ro9Ұ
\ No newline at end of file
@@ -0,0 +1,12 @@
+E
+O4&=5A?M_&
+j?郬#"i)Q}A6Hz,MaZc/yрJ?epٚwkz5d̜O~7ks߷eNɫaw.PJ7]=dռ{[<:i9}75FfJxJ#/'RZC^ѡ&9^|ɔ7Y3)k{*ZCZj1ZTluס/a,7Ơ-<cuZϏ3qz fѡ)=xUSC,wAֲɉrNgaB,/QcLqZQwp@npqB<y:+հ:ȑkw^o
+j9=.{;goX'j\-Pp[-k6w.k%4a@T1UZkN5d\kqA8
+~g_݉7/Y?$]HBP 7<JdpǪ'cah E)x(@/cpqODxTO~
+!NQ!Cس{
+񈑳g"P9)Cau3I=wZw>9DAͱdV`W
+%\CP/NHR{j$).Dxf{z7?<k$)bL"H	˂=5+DBk^{ਫ਼T{Z|fЯB$,&ïe{ƞ[]ȆTt/yY b64qr}"1=N˗1yݱlQF}:_1֘Akqa|7|TNlՠ,l힅qa\xs$?qL$COT[ap6p 6<vtL+1h}8ZYfB=J2
+t_?hT>/(Psp#'Ӡ./7ql.17'ꣳFɹ^ha11ՇD=6gV"}Ѫ1/hLK]eo%mu
+ㄑMy=\򶒜݇Y-4/3a
+q)÷ij6OP)A+ld1vqe9B*QĂP1+6snڸ9T<.D\@*ǝ4딙@fݼ;Ů)C sXWCLF]	ƹZ<bkUs9KV?=#6kfhd$P>𧷒 Kh,,)BǶ! #vb7>r{薐RB@cYǃponXcLmxGVv8ZrP?`
+-MA0:S%?z= OD5{ZJM[OD-Rd*&y+Kf=
\ No newline at end of file
@@ -0,0 +1 @@
+[rs8K&czo<yJQ&3[itw-0,{~>"m)DU\x`GUW#xB}0S=`<zt O+YRO)GN"8zARʊF0'WI `Z\OY/J%؉rԝ,E&Q.
\ No newline at end of file
@@ -0,0 +1 @@
+w9ogzxbzf
\ No newline at end of file
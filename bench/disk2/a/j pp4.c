@@ -0,0 +1 @@
+#2&eaٍr?fH()WRʹo[fǕ_UjcĒLP$yA[C2S%S@2az'#KD ic9lOڂ5St|mkQa.eI"4<{/KdڊD[Yk	#J*&M@^ r=OsVVԈ_Z?:mi2f:?,*uW_ŊYR|,Yu%"OyYHGŨϤIӬx%l*4b߬$N+IrΤ
\ No newline at end of file
@@ -0,0 +1,7 @@
+nܧ̘`AsS\B[Hs6OX^
+vsqR΋ًC*('#&8S]\R);H?Ukb\0cM KKsfs?<rC|SGÑ7js'ه"5R}Uy++-8RqD`%Trt5PGFެujZGUTv&3Wɶ׀.$&qr"w[7r,ïGr0
+_`o8HU$(6@5R~3]rx\q\\7Ẽ{ln}J`+U.Bz3{7($1[kC:'w3O3VE~c΋Vzߦ~>f5.c/X`kLi4g)=*`:1sŒD޺KƑ+9Y]/}%/IVUvF30>:7s؇<PudU-Ԅ+:W+cetYRrΨoi43%yr
+E/,i$q8Q) *'P^1..6BYzhqGr1VTr;,NaOuy|O뼨kjHsY>*-hD]/k@E?n_cZ,ϸS3ej(dh:eךʽ6SS~N{(G9ȉer&)ؿ¾RWKl:OΘ"ϞW50z
+l#ku@|/7(D7]a#JJ|JlWGymM_;q5K~DǔBse"gx>Dk)&.euV4XQWNtwjM۩GJz0Hɵņn;_clmZM|Zh^q_0SpD!cQIZwW8FtH@roK)`{ey-9ƳU'0z0v{P:"zi4ya"ijd&}Uӫg#nI"3y\viMHBƏ*7B3O2dD/ls]]?_)r2&YU%vXܬ_\mu8P7?_;][<k)tIO;sVizGo>P1D[_?₂(eݛ?R$İ$W'RYz=h%ůRctQN;$>R<k4髨)Np9;0=Ul	"]&/!T> 3}Ef0[4]0gl俸*:bG=<oDkvcE"媻/1~R,_%<4u[uҼ@Y?-o৒?߳杲d|	nZi Q4b񻨮fr
+A!myɁJΛD{4񢆕({_Uy)=jiެ~	D@r{n5(%*%q3oAHP71lg=H9*y~ޝMRF@pag2[~
+n!oa3|oZ](\I@Ǵ#`#1!#>1A9r(H;|[V
\ No newline at end of file
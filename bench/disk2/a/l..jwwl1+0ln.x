@@ -0,0 +1,7 @@
+IM]5YXwaAAT|g)vxIi?S3^3O}j wӣu4x1&E?(__gIvN4}w"&'@[	0.";_y/
+z5Rge	2$'[@fN˿i}}=Ƃ5yv$PmIM)V[Gq&侎MvgRa&JrKg66I$şۊ_<@mڝ.R̀vXQehϧɫW,0''i&MY}~osn*V~&#BSD|v0ofi\;OA}pU/p~=!hR?raFѹuai|9!S8a2k"ĬW!
+dP~JVYIBKk!	7$H+O6)
+!ca)a|y[3d'4qF	|Px%u0zraIx{I)l2YJ˿othHCSޮGNAiX`)s(oT_=҃sD+6t`ZeZ`7¬bSzL4j2f\PozO$.\u[	Ybͻ*
+'SG`(AjƊ_mCY]tW<:&st0,&cߊJoj=y;eG8_&
+dUtPڭ3X_&eS6JJ6|\'Iب6gBbݜ#uv}W8ŰImsVds)ٙA;c6IӾy.8)Lqa3Ap#T+ҸI<4~oY~vW]V):6_%Pm_Qk[tH{YJ˩ *ţ4^W_O'z~;e1txٖ!mP~NЀ8,O{
+^Ru/Pv_2`T1cݳrCآ?XA[v%Ӧm
\ No newline at end of file
@@ -0,0 +1,10 @@
+{"r''maa>]7aԟ{#$"SCx5Ca	_LBC5ikJ8my<0)^x9ڱ
+<1$=5ЭfL'#ƹ2Y(~Wsbk&h;_MBLN	Aܠ\6C8U;YGN|*OjRӬ
+qCe<vӠ^NN}x_x_'
+)Al/֞Ж<D`M!oQzVv<=>D9Tc&6Rb3(#l-_%wR:0@.K1(+^x~"#KdkzfE(I^!-0X8UַU%$#̞MLE-
+Cl,\apLV>!ZၝNzdbs<P ~|&Wcr~xV4c<&RSR#}(>ARU&M7lVp	/.`kvsw٪ֱNeW+Vۧb}0~l	=<#`|DvG9URe?(5Nϊ|X0>yOF<ݨR4õh55mC,?JRLVGy''<={-^lr(}$
+qoc֚}we84SYG
+TI#`]݉9p
+.XoiRvx*u!
+x*`/u8ð[&PpPn|NnjqW	K>PװUAUk)Hg
+rus0mȾv7Qnɗp+FĔ͚~P=Ew{מ@)iVcJ!7T-K<#QV?I	˺B6gpTcBMS	l4qT%ykjhD0bsѸ/<jȾtmS0fvE=aK:`BըD٘Z0kN˙q]=Y"< +Lr06r][I*p1iX;=sҜߨƞ_2fkٶ6Dm7*o;5|ڰ s+OEO0{iC/s
\ No newline at end of file
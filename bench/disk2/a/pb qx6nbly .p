@@ -0,0 +1,7 @@
+ϺIsºo)nV[+	c\{z&{zi)=mr9
+dߵĂ3{Few&D8gaEۀ-2d<ZD~agE"6{+`d$@47c3NjƆǕmv3dH8\e	Dk~{Ǉ^j!v|_u/Gs.8@-(SOˣ㓊owL"uoyxOy(hq^LnXwLzqNUF4ցz$].ՕӰ(NJj{ԞW0zpa jBeq6[tE騛-(ovwWܑ[Њ 8i镢j%X(C8n(jhKd&B_*C&Wb¨Y9M[U`:#؞yqròf,}ώfx~@f^$>@}A||f`4k,0P?a~|0X[C)J4~Pҟv34*u5x
+?us'aw}.Glb|ʡkpקHVrE55rCu)-2A&lg}[`kw*m>W>36|2d9߇$Q~/.~lX(W܈'{,K?mBi+&(PR|M^tE6ȸ֮+{2hGL1ӄ鏓5ABq]bDYΫڄ$b.f0+U=
+EXPZb.$`*RZUBDc%©'/[6 ӊзuGƒYt_I`_3](&a%ɞ;]hۦģ"bڒP\q2	B-Wj,*n?tI7)1!삡5̖O~٧pHcª1bژZ$WHM
+M !a	[suS.3;?Q}oXՕWR\ā !fD`tu0	Hw6;mqC]6g&M.-1KT*>K<FFҮ"[U _O,%ɨ7e^`)檍~k%g훰&;atFV{KCZAѓ8eg(9sU[a[+3θu4l|qF>^q(Zab"c	͡s[8>d~XaRYM6uɸ0SN0C>NF/c^/;'$6M=֠J$gṮep3&KRQf䡡)޴Ƿne*IB4,VgR܎7Ƒ'A5!1>6;%@irl0YQzV˒+6SJM^,-ç]<
+W:t
+G^I4qA'i֔ɩok9+zdlڲs?q&![U%yGӉXų%A%W٪ijfmқpV5Aka6(ONǩˠV*G1Qz[֬IݐVAsLY}߾HF0".x_2?YD~IEJq6wS~"t#/tv׳@!{XGWzBY3ĕk[Ok7ȱvJ	a1_EPM%ge6fL{gр$i:V钱T~V>oAkr0+!KFHPzoD8;"y:tѣ9d,/3&FH਴R8shf=wrW^AW|%c}`\ޡ?_`x
\ No newline at end of file
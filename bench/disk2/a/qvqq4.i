@@ -0,0 +1,3 @@
+L0wḨ1ZqtPvID[Zm)E>}#Weғ7\Q0R£i@EwۈK`CȖ.vDᕰ>:(doUJTT&a_H,&*!o:_F|txGv5 ,vNݬ9s	1L5psf(C!(2bVvNN6Xﷴ?{;,kdy?wr_q=f؂C}[ңHUS:ϟVvkǸ(`䗇~l8s(cCQ^%-|&>xo|R I{+ʒ`^`x|>y!05 0rv-;`I&Kj]7ƠJLgyF	dM=`7\&[V+2qߘi:+0YtGDb/0q-n>h5m{
+>gj@Wh;m
+.$T1xţFp[AtQw!&,W\,NI2=oF\a/:5v#Q<dzۀnZ<Sregvlpbޞ:JeWB"|xۜ),nR8|c:
\ No newline at end of file
@@ -0,0 +1,4 @@
+L#>U˕w5@%0G$<B<M0AE|<;Iӷe`d߻סCߓ*\vI|L!dh	ߑ=&]VN=/s'Ka
+J;[Q\`$&AvE1r+|NL%*Z*.__(@GOrнzFnFREgl#9sh8]W-}6Co+0k(t6^/3|9?Rb DǎMsɘ5/5+x:Ȓ
+ړ(.x]Ag+rj3R,+1au1K/oIp!s6e@ޕez\8EGe_iZ@|`BOIA!P	qNdrm_d.aqKӥH=k,:$Jdj`%Hfa,/ش+t
+u|Af	H(jaja)N7*7W>.~aADN+HUhx38
\ No newline at end of file
@@ -0,0 +1,10 @@
+@^e]'7£
+eףCb/1@5:4Ư^SfRBYAPG
+D_8~fCߑb7C<ZaW#?B^uҏ炻{5Yq#Jf6BxX86#]lK'TŁQ<}<xIw~jJKOcJBp$DӍn7M|D?Z_cR`&9;Hhcm4nJ~քvXQW+=6Gnd!q^NpwR ARa3OmI{e|NVʝ"#,jNwv&m(sm?#&m+ON>m0n<O6$s:Uɍ}
+Tŵxd'w2[%f1.z	@j
+iN醫o:yM]RΘyRBw7dKA$%pEoR\*~ -ZT֟Q#9>ѩ'T_Mc|tAMXSRtzwS?(Sp&9CXGӪ!$q0O[gC򡾟-)hzZQw!%"O0_H +aMQB.y,֭Wqx2%׻lX'T(_livǖY6YAt!(%29tG#zRuGyVl]Y}sٞ޹.5,d/q8~KnŝtqPotScMG`r_yn5AHr;)A|n7c<s[,D*u@ʕ`0ů''{\(N۲p^{|oѢn@!ѷ\07v#1yxaE[LY_+`inM$]ٰTB"WxDPߤut_Cr:v&VYMD>Ok45?$Χ-By`[7ځ䎊cb)Dwwsa$_ӘlÞa9*ȌkuN
+P*;xn]{<m?O!DW=<YK܅ڐThqZ^qu:u{Ӧ7ZHX~g<G`
+/f7͆#d<֬QGN~Yfo\A],;8/6`Sn1QʭK1U${[ 񓆡Ѣsz2X@I{LMLL"Vp!v;KH;bk٬AGiBSWd9xr	Ouݨ&e[cT9_#<s䖰i|q:+C!<R5AqxW~ŕ?!qJe5E0Zvl8jV f`AYp*#{|_)F>0rׄJz6n^;Δ9Xf@)^bT|yxd
+rg伯E	˫窌*m-i~@jaF[3ym.\]8E%뺙PVby"3a
+e+O\;e1ބ̒&q'⩫&q^Y߳{I&ٜq~F7xBnZJzݦhĒNƞ6,.m)[2ngAؤ^BMU-qnJ_ū	Vٝ.jWj}2ƸR[Gfj*jI;+qDy>ؐ[UӺ9۫ PZ4&$Or"=KUhЀp1/RQzT)4k"wVGf~؅<r]_(!϶ѵ3K5b>l3GWe,qHUEep.>;܈C5{fqbHn(#?`^ėXF!$̶P^,8O2G"ю MC^AT["1Ϳp..8[i&y\@Z`9V
+u@e)d2})_mc=֜^a,aHnaCg$LLzVt:S뙈 <.]3)gL8$XɼuEN
\ No newline at end of file
@@ -0,0 +1,16 @@
+kMKL	BFDNd/aL <gU;/ʺY;_ORm`MMnt$Y\x?zA$}TOX~tD8mG*EyrDSް7)_8/S'MH	e׉[8$}2$R
+zW!㟔x{n8M+7$ۨΏOM"ZqWV/-ys58&L''h$aAjE;?Ƙ;F@%~Gu)B
+deSXJv0XU걭9l!xVul;'4(XKp;v'?|dD{S:dߎ#AU3[uq4X3)jx4`J$6K7mgD)5߬7	+@q|}r)Ts1\'7wF%Uf^xvrG'!tdEȌy2Mn9^&'/O!anj
+͜jbec3e~Z:
+ {]$Ű>nڊ).5lN7c:FD!3ؑT1T
+p'AYmfBn3Rv}H
+}=:d#WIQfw4lGNs	%!-~<KgBRҀ̿XXf]}gc>vum(([.Fe&j9Ύ8Y,m695ҤWK7lVҦjݐ=~z;~J܃"Y/r^UZ(ޅpv}Ig_獬o>EFV%Bd9ˡpz֑#8dz;RܮRFrETODd0/xކD̗(Svd0J$*+$DҨe@9~dRk+$SoX/NXF2'hҝѝ6\LMǭ	.*[k"hN&t[[],>vx}3_Zq0aLYkuQsGDZocbTho86x0~ĘН#ZryKycy:w*"W#9n5:互Zm'q|D
+IUVUF^s6Q:P֍#5yL?`~S!wzPyQO	D@B'-A_j/eŧ)Bk_,`txCT]r-%I<pHb}tZ{:"Vtmw/1=>hH7YzB*	z\!qqhndlʌ>i,;735NQk[DUZڝTۓR!ALծ+h=er]"[ћ}V-7sW'qĹe28t>MV8P($5Գ{pl4Rw 7;&>u#50Yg٫Te-J/UŖȏбҫ9ǀHUF"G455dh1r?!ܣL#",cwtڳ+vny9JPXQ2kr)x`o#SrBKZY+lBV!x-
+6 ?3]!
+h|G9ǆs@S/n.TNdDaP蓑RɎ(i0|0kI^\F_SYD1M*;u	4Yj>m"?:)qN]ƈLf*z9ݲ.;Ic\ܢ6W#:4"qXz
+dGY	}oSMoZ&^5?ˤjLl\,Wλ\?7o}s-'EJLe}(s]<Oq{a&TFvf`|lhdAyYG	"3fgʹu
+Jh:`3mɫ+T~7AcV2wYwM|MmK	#Auv<Ȇ)0s7G`W,ڊ<7vBo:^t]iz`"BKRfBPU0MZa4`t>ԿLZD/WXԪ+s}C٨*	yh
+ku^x]X@qEݽusXCa?^ԍI^^&Jb\3h{̟m{ xD1ߓTpaV~P,T8
+p|Fkm+U
+{onO<'⻿B"MByVwklqLl6
+׊ '3F[ޫf2UYkOTU(%yr'oY1XÂCyki4΁LTW*|R@:490}R/UF.L$/0rrz}onQR2YƛWե:MRt [nV>PJxa"/Nâ0)M鱎ӝD6El7\I@Mxe70pPج2:$ڑEO/j㗫d#_Ws1Ls!ٔoG/'wӼyBFgHkx~
\ No newline at end of file
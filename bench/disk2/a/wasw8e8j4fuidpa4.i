@@ -0,0 +1,7 @@
+AS1$^zҺw5"!7X$n^.yp@1A1zbəu֥%g3QHGUGRe01)XHNƭRIw[qE=K^ >"4虜]nb^u_̮z|(SՏOGZxx蜬vv9r4qjTd"6EF3ǤtƖ*sZWBa$ Q&"\)<=OW-bCxd]0'Buuܣe)g@(X,mt+|d4_tO&yTF	gNRRNZB[z;L%-UP	n]%aLPaȞ9矟ϻ6jZn,&"]Qdrv<1GNjbۿQqXHq]GEIgk8^uEJ>JkBBmt`FG1J+.E"C?)kʣ >]6k5'.
+%Lh{"xA}1{}h_R<w"=\2ҨKeؕgJ~\أD.{:Yw[;aQӹdw)3$Ie{p*/h-,5`?Tb*G7crJ-A8\He.#nwdBHA	:ªWLOXl+JUUI<4&C)@x.;#4:2tg}x<e3*l0V^}'|#9t`L]sTiyIRyq&J5Ru?KXdʥ)Fbag|]/7b!g}~K1<C
+`RvCmIo_7#iaXT~OctfjO3F&ywE$(z\1ćߒ~w! !aD7ֱ	ᯀ5V.Mwluljjꚾ[Fvu ut*H6pkư+!㑡cI|>$$*w)"x"ĳF>0ֺF1x/߹H{'1eرWr1Ӂ&=6;Z:x-+avg@Pdv.LpP8$O݋x!iYȐSCz}gUց؞CYz.0N).EloN؀?;#?iQt~Gt4(C&sK?aLc?mR,dTA`$͕xW3;5oI[o\yRQVd;_fi4߳CzͳzAXs\ń? uhT_;ޕJN2raEANуR>6ux](@~^7n$	1{1C+F}w76'£|cͤxs.q~?}|^,
+U%Xi+q°\ymD^ČqIp!J0E͏H0fG0սNe(k#0s?{pus2%CΙv,8
+LOΘ=%=gD>Ufb'k5aM'dv68L#<ͷӉ4#u_ש;B<E)L8K3͆w˼#iG`
+Nr'*ȋ.?`J&Lw=0ReGYTe@ߡ_^ԓ1\~L,!}ݜ
+LjT8\D+Xl99"b79CPd-ϗR`MBLe}&UC)OmS^D-Tg[CVN@]0$>bh:~Υa"d<Xh^	m@E\q7?&7MYIi~rlfG702͎:>b}D<Ρ*3\`gk]jp5e	;X-CH~mYw-6Hp d	7uct+,
\ No newline at end of file
@@ -0,0 +1,9 @@
+kl%|v9Ũ+ՙEijԌԺ|̿b
+@}v%ͶV!EV%׀ϟ$m%CbVG"~K(XMOKUDeGNSV/J;7޵Ū?ϒP:+1.ѼZ5}N{R@C%/J
+hupm"ʐ	2EgS３w[mY4o>?!DJYV&-C9~"_jz#*{b/fm]=aIؔKW7uF`e=}=67nSnes #Rc޳+oc
+{+jp+^rh:|x)#]iK؆*m
+!o幌h<Ѫ{I%`ce7vQD7R,ts2cE'^Q鉛_*}{x턀OMmKO#T~vRb~"k+řp[[?
+(yt[ͤ=wd	JaV1erRIy/]#ȺZsWs6u9!aɫP;uj|GėM}leBSQ$깦Im쓷Dd9@E73fK?'|B(V꼸Kntn@1Xm۠|L^=of5P{A".hyFe#^ByR'_q{6Eu1٬9ȸ$pZ0nrOWL.oH͊ ʂwOozfs,[mhjߜ58ݞc#kUg(VO~aw9zZY 71Z2}c/=tBqx=V>F{Fe~?$ <f"Ug3_VF|Zg AwpVNH'oAs9(.x<7Ɲ^[]{zX1,8^uA\$zi!Cl0s|K21_BQyƑWA`iu#KS	xfLH x")O:̵ٛu虜Kt5sAgQ2*J[EL࢝Y8;v"$y6DMQIp|ULN A^@*J6[s̷T+`	7JeVNPFKJAU5Y
+S=m3MQ.
+@Z[jb=/"f&'}jŶ;/G(Q=&5G=0W'3,
+84/D3wlyu횛m@H!c}]SY$`	uZHGJ|2v'me:6%;\$R%	yi.E+˹fVrHTKЮM	XښA7'T?k\O7[,gu(ԙRbF4FYo6Zv">d-O"2Q26j&u1u8'rl$X-fIjձLR'R RSrk_'$5paUy4ޙnq]~P-t{v~{hK</Z4'h!VD~+):kG rWD!gA6I4؝(9@Bs_&6=k>3}lt1ow/U]gťZ@Q4"~APZl31|\50.b-u~X"G`o|rﷲf^ V32e/|ِdmfUO֌$>e3T_/ׯ,@4qY7)GVY5f".uQDx&%y :LFu!KVG@V1Y(@Z(;VI<qD{5[ 㡋`	N]=SɕTW[jj&v{Pnu;{VxV]fZn@:Sh{_m;1<1BBEb}?m:SDY'AIϏbۗÑ6ri"rw$6Cp87k'7Oi`PthQqޱHg4յZ)KHpijZqY>+m15LKa̧ՃPqzKG>km	6Ӽd}(8.Ea4Q&z|m(TMYpQ|?	pmqVI0ȸJzۖDF&nߴb	!3FVr}1)mSZbI=XcԜ99H&A7sh.(T	5ɷJD1X߀9,$<c4jϹrА?!.%IokN!:p~H:K=@mdޡj	\BFtP~MU)8
\ No newline at end of file
@@ -0,0 +1,12 @@
+
+}qs77wو\N<D/O&f3x?>BMmW[z1o6\Ʌ7*,ʡgP8yf"S<=
+ۣ_$7`Z7]!o'd^h`|Ctҫڀ-NS,3-qo9}p0q h![ߋonD߬o	׏iJ @a']01:1MG7<=ǦPIU|PV>Vs-^~ݜxJyUWA1MɠF6ࢍ{Kr.k?c v~[e:RH-C1"#.QY2V->܏Ѓ^kNM[޷ZZ;m?ƆV[F|$Gj҅Vن3C┓.HiߍwHDR+}S1&q̐"2݃r?Q_Οfk-FlZ"H3ڞs$N(bTWǦl,O7ׁQGR1
+\_~>3O߼zYɏ>[[!z~18ӷgV?F_BOi+}:=́{*zYKdHl`#J4*MSNkS"V~N.4rb#C(\W0z/.:2JbM|X\%ɡ	S^0C= %w7ӇZ3KFvԉg}+]jTLw\Or?-&-sr47@5rmaO%ZW2gJR8[\s~	q;ǁȪnTMdn0W^OƠg0EOmqB,8A
+'0=̊,Ӟq}{^ԓLaS)SXBpho)aza&M/j5N]8,5M·5)j:#t"InΥ#HFfaCTuI:1Q9mXNw$'bv-OAxg3,s$vԼ=u!~?Wxݿym8y#nn#gƩOLƇ;eoK"b)meXYVgZcUNe>>!fqn.5(*R%\~<[ӯtt7&lCS&akHc;eQOWsyBuff-H`Բod>hUu-V#W	Cg:E[BUvF="42mh]ŃIlr6㧪Mߠ)kxzp-aVbtab{g}#B$K};P>
+0Ӎ?Ψ)W+l%?Y֔P4ߧF[oB	as݂M}T
+ge17#t'lMFYJ.hQL9I5֙)XT6N|}FP4&
+ٻΞ8h_:X#siôEJɳ^^+55_@܍xO߱YR.͗mNZHAX ¶8%g8rtDX"nM]L[HopÁUZI@N#@7XRb	MV:8ZfmR_q/-ySGj8'tPL-QϓWE bܮqGT~υ89BJ 0ϘyahFm@9x&6ggo'ak%%+Xm6,ဨV|숚͊g64MWHPAc22J43eY?拜~l	 u:m|#:f(ml泚oUUrYxXUN@1cF-ܸSJtbwx.>YV]v$W,/-P}=3Rӈ{&n*]hiX.lmZ3VSb']/ű]ff"S5<-,nseAXT=vXdB~[c/"&ǝm:Qol\5ay]U@U!{2Zv2Khu;n5Xt/JQq]@@e?vߗiWcڝ>[`t~HR+HUTl*n08<>%URgq=ЭRٞ=OJEhS`Y)7hS/5vE3c]"GjmkMAhv*	.=H}6%@Ӭֵ[Ğaa#;a=Sl̹W	Ck:h|@޽}+:p<CeDis6b:& I< ii[!KU)P4U;OOd=^N5dʡz4QPWG8g$j|Mi%ISt2|`y7M!畫GB=]K	"IG+$3qӂˉ;>G,>$Fb9yv%qP"&@=эQj|J|,dWg\~\%nW$31Sr	uTN,aȼfn(b{[!Ocfr:j`4{}XLg?̀QqACF#n&/+SUE#rl}.OU$<*ί܉|ҌI{!L! 鰦OU$Œ4j롷#lCi0x5Bb:A;qq^>znZ̈́Ι0"(;IQJÂ,װl0U{y!t7A)a`^XԇBW]gV\8)`DM,a۽
+'K/X(J@U3o/b%SigUFyi'ӥ7QTh#6f'[􊹨4z%ف7
+Jj@=$ggOQ>sq-Ƹ^rCs0uOolRe4Ox;
+ߵq^j0vHe[eħem6=EV
+f]L|7<ZAM9kmâM+汊dbb Q{KvA&ES%/?D34zw#欈͑P♙	H~ LtTP(*)	#.x3E>xɽdYeJxNKމV;:G|dvz?}Oe荸,_dY]·X!.Ű(e`Y>Ak{ܠQ/8$/1GK8gHǔg-#ɰ-7[,'ȍ*Y;33[2iF=?Ɂryh"e&"5z62UWG?zs+@N/tRڣ3a>V[Z?;IVΟx~Wg&'1Iaּ̆~tru_TTQ|/v-	>fEz1!@֣eK
\ No newline at end of file
@@ -0,0 +1,11 @@
+?={wLrjAw@DCǊUy!jD[4oˤ0F܃bNJj8ԜcgL$4̑^"|j$Ro_bz:=Ae"k?nGjϊ^a44jMJ|Z!q}4م_C'W5)J$؁JQGpsuyҢLz^qI94x702T<b%>?Pc
+Z2zPOmǪ4}ʐMD1Y-]4lpX'R:`5fcob0߼uS<틺siJim3]C|W~,ZD2ԹYulyA~pEmf$Coqf0+FPs{'X;,
+a:!ϳ#|	8K9
+OgbqBȗx,-k_o$T{BD8=pHKQ6>p$9_eeCc	LxrM[X)va5-kLI/O!2E  <;!yVBKk |6XH߬FQrv?}I>Ϫ-R:ƌgźr3uΜP=2,kPLQN	LyHmAl_ȧÊGM*I'ʥnJᏀNe~u5K$	< 4]3/(xL:9G=FL1"̾.Ob9q0ڕE%W>eRfhϕ<}FdY0n0n
+:yLh.]oĩ,3kU!: b/!+:rRfyt-PR9n$JUŷ#餯~[Ic,u1#0]VI.EƕVjEZ\_l|<QlE0W"afTDXpk"V.HaQLI,/0M.FIfwxr*Bn r/YA˲9|kZ%A#Oa'|m_0a	KTZ{3lv:ש7_~yԿcYe5yv?N1n׈ux.g&ܢ:Mv"?ݕXXЎ	)>u!̂0wPSKav/S
+ld3\ū%=`bЎq>Mާo}Q0ϋ+ow|yYO}pnvu@BrҞ"U<h`Nhd*͋~f%<x&8MA=}^bN}#h9p\C},}qI}#n
+EScԊ8!.tZo,2wYXc"m5|;jlM:xĀ*saKa
+<P&	k~M5UE:y+$[Osr9Qi8up	m#ĽeoCN ~!ӵZ	e1\(JU vo%|Oݮԟ'EΞQ62G[DJ-|#@zc1OV?8 oݟ[TrM)ItkpпASXc	ofj8:k6}iz1vλ_X$z9eiPKPXǛ-{_;>ܣ&=X6e#B"oUZ_ܶ	ML	@mhg3UU>̎~󴔒TWWdiDu;сؔQYxýxX! ƭKMH56=>,]|ێYbi}/Wo:!C}gavl*,`\e{yG=||C+oe4Yʮqio\bT/)	Np(hQ)xƢg0pi$?m,N'pk*ܻH NLo.O N&.5$(>u.|)(Hg:M)D<L`ҌUim$F
++͏.
+0rUJ3Xڟjo53{o_Ĥ#[|d$\oaCN!$?h2琶=Yj`#=ϻ@b{zioD\t% Fq^:\&<p֝/9ju$L9$O*K=;\Ȑr}94"so/k:I>_t#AD?kwU!ȓ_eL~y:n"ѵLήAG-imwfn5.=pt9g9ar1yoy(LwC2؟	WT)@}0 bӕJB1OH?5bg? Șd*@TaŌkY&1E,aB֐*:3ۛ9b\f҂7.&BnsA)fU#{(h>JQfLƳ){RMB3jXE=Y]IJP~jg/mCuL ,יwЊX61ҎJe#~嫞,"-shrml@ykcĥ8FmlG;U n#poTTK1YPl!)*G΄x>Cr@`ʸm@e}ۮSKFףn{^"aHavBxb$f(zP+(l2]F
+]Z"A$p#-o¾^Til\ aƂT4h; BCLlj93cHj;jtz5&f.;xve4sjLC %:HAGAanÝmaUDP*$ϡ(c6_⫥Z9^]\,01DPnGk GnmHj>t3o$@悮ᾏkmنQ=[+M?gRh;mM68'bH,N˘*@Ҝy-Kޒ,?KII"=de:$kk~\{Xvv0!w}My#c?ܻq<hcuim9k_6C,sLH#̫^~?eZ)f;V>.Zj8FR}Y_KQ@kY!D'GHB~cݭ+$z(JHm>,=m /	%xI5is*Il(^\m;ke~fwc(f3E9~o	)XpS=6YGϔ5Ţm"RP$`rFE)!%Ѐ=T͛)d-5>dskÎ$X젻^-,U0}4>e7J{w",#+SeOXȖKFc4r_ܴclD$vN e*jtT:	Qz;гDۀ-bs\ӱCEň`!'~%ZށѫbnL$!Ÿq
\ No newline at end of file
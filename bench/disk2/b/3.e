@@ -0,0 +1,14 @@
+	;`/3j"
+GXpgT,oz\(͏Sۃ5
+ԕxBgb≽4Azaj(
+K7;!-®wT(ww<;]Ⱦ
+o~]70+,gvN!VVqvWFuG)'Լd0Fv3&H1|9̓x]flS~	R4bGSǒ^aBO?h})rs?TD[TBIyV}14qu(CAzvM7 #;v	G=p)c^lk6x=]IeP,uS`c }͎6))W%ZWFU:xmƟf'jGHӊoB7z=ԋsiqb<X]3ϭݞ&Pm<Вf@n;H,:}rݛDlxnp
+o*sQi9aA֢Ws$3b(4NHxjx}o1ۻfrE4ly0*yVwZ-Ej
+ 5<E8!.++VkWPC_J@3rW.Oy( VX!HUqKcx=.RS)(1eզ|tʔx:yfne B[`oktFKjZoZ芁шMpZhW9@&zi
+/+d9V$V~ky0|?hƀ3H<<*qģ6C(4*2bIo&Got( +ܠ̖ƀD{o)Ey+o	޽BE]kPn(ܩMm)2$+LL&Ԩ%m/ůTA<s8<$Шs>]BFV_#3woKVC^PEY@uN42S
+jV|oPcS3]
+uf>݈gfzk;G+V|Yfax(G#L;jAI	͜{X*L飖ߺU40u.BkeDAY٢_UH=_2qʰEB&?zkS6>9yTLޫ֗.Gt[_z3@c׃3i[%}~wJ fi'z;~RpcR2Z^/cx=Dk/k),
+H|`	̆9)p)5GPTE}eoYRvDh>fu
+<owװ$\#NI;-Fɫ{X?)jܐ~T
+k!i*>$?M8#BFr}PRC[T_TS-gUT"!z-SM%N69!s">PIg>YSdkJ+}Z̶/iN_}/&>GrS~^7^!;@Gn{>$[ίvsqajL%QH'MF2dhA	6)78ĩ*XKC;>?GcD;Y%AkqWMݦb- ]/~(tUیmD[ԅ)xfm{h6)ZgGެ8
+EfX+ti78,V 2n[ORJֶZ"P)~^Պm<H>ͫ	B?¯
\ No newline at end of file
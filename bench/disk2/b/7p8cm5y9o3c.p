@@ -0,0 +1,9 @@
+e_F'ao#p[nifc	ˆgtl83g(d@'dm-
+ծ~{[Bo8a.9B%hr!)'0AEnEo*oHq=>s_K`beI~Շ *6xuFsS}~:mEĖp_o	1lM:O&|77S\|#٥PV\X91/V?҆G!wjF$	l[
+uw~b=atP/gxI"iִdZ"'G({XEZ)`HYsz*Lׄr`Z2`	J}7r%;lX<G/&'n~٤,Q1n&Tz%.hp<Êʶ\jB+Tl%()sbu6$sCH-]X"GأP JxcCw)-ԠS
+${$,cpj,VdDYIC"oz:B#u0V~=Hq"ӏ_,=8X	cHD`ӷ&$,+=᧻u~k`h厍NU@옭KF<n5ӨЖC]AABxFş$#Sh2sێ &w>ѭ{y};WVN(u`8G<p
+lyq׎36oB 3vTmy_sEo\5>uo'"䢕
+mI0=."pkzc4bdvbC?5w1Au,N{,
+X*ݹoq`,!owf80j)cyU`?4:fZ<I !Mj/L]൘^pKo
+Ж
+Xcvΰ8
\ No newline at end of file
@@ -0,0 +1,4 @@
+cPȮ`/8
+cm
+vj3IidW	f9_)qXmHe:^hv$`Ĩǣߑ/E.iGG|JQi7^$t!*??#Ay@m3	"a>c#y,Fנ/&RK6+OVNLi.@TWXZ&|KAPXj	$8'v`oE|{dJ;9y{៓38E6}tB/ִhqEq?FAIݚ+fAQj_MK4L`Ņ&_*[P*`{Lk
+3I3En/bl8X?Hx@, UYaD\3=`hq_,X#j%*pgF犬.F`b坐'axfwDg$r.X'ב<Yr-CSSЎ)(֊S)h=+v}ht4xM~`'9z*lU5{];0Sya\*DQ"-+U{aQLjj|xl[[;"S-*ʖ)O/'$C̎B`HLlo	#|y8 jڐo1v71lWBEńc}aJcAR9mbՇR|}19p4˂A 
\ No newline at end of file
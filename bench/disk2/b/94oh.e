@@ -0,0 +1,9 @@
+$'H@1U^z!;;%u
+wT`̉A8x	hԻm݋0hR퓿$>3!sLGRLf$mb|(	jRgzo|92ƬɆWVe(P׀꙳PO;Tuڙ)M8,hƴK8?NGZ)*uW\xYLʗUeGbO̮587r"	uݸu=~A	q`sҭ{;gLyP*VmHob>hdv?khTkCڊaW
+PޮLuc'uOoz>*6M_ʷ|wR%N<#YtƠ:
+@p({C/M,Lm?8+͓sdPY?s)S*
+/ϿylWxu
+	T
+35_ F]{DGGEא ?/"NnBުms6*GR@ȍbF@<ZJqRc❺ͣT?OuCѭ2MY1тlU߫\.6}qkߑ\cA[A4|e].@,|2B	bM,3w-Y%#s^^J~K{"oBZҡ#Pu=G&Lrn2z>tnӒɌӢJJ%,BP`Yɩ|xYGOV%}4{s"Cz;Gιp*HRg'ϑc@{Q7CߪJV/nͭ)
+;z.YC"`m8 FWӲ(Y7AiONYoڟ$<[9IEӶl*+Gn7Raϔkո%[9p.+*ҴDAkM~j殷Ozz?P||mmX'hJEZ=8L77HkBrA@#o
+E7eZNv
\ No newline at end of file
@@ -0,0 +1,10 @@
+~R:DYM;k;)B2Oz0~XObpV
+Zӗl-sl~K/)E;q#-ojRNx1(q,	sk:E@-3L3U'j@'t/&hk{<>Q
+
+Զ9i2̰[)?Pm9Qϕ)o;
+u$[-L=9QPa[	`Rm
+ <Ȇ׮o<>}*QUaѲȧ[;C
+`Rʓq:m2k,`DOp
+X\MK~-3ŀ/pUnC *^z'ÁMUFiJE<Aqt:@-5-2}l4ZrgmX$+t&eU, *wTn0
+xHٺMA38UwW<ꔳNFJTkn`VBƪk"6\С9WlrdeI41nkyI2GxQ&3k)"C-$îjhQ΀ᦈrbjDi8SĺKvxPYIW,sd/g
+l,G02'B6B$/ !MJpyLtO1GFgߊ+K{tijuzK>DӔ{!iJQCsȄTjtz:hvfX]zq{@03^@0tlErF.,)9z-Ð	QE
\ No newline at end of file
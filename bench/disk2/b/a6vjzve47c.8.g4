@@ -0,0 +1,14 @@
+R_--*$A>ixl?oqP3f?X6ϛ(F˄RԷ칁_O,vR]>d7{I`bv-cea-jA~x^[8*ʎ^\-#ʈNOqE';LV/fJv,H
+$Tӱ,!T%y(W)_xyAn8("_+مh@g!"lюf8֢wM'%Ю-dQM/@DW	s_2e4)7[$[wO'!zS$jxa!l4HW<`~g;3f`G'xcCYy^cr`x8(QXaHXή
+賸˨p"IR,#
+2[!l9f>IhK2KA:rPVfm'FZk;/Dtw )>.[f =] HqpW	#bĈtFShx{;i V7%Qq,30twnsG\zx}Q_%c:"mP=pcn'`߲p%W5ѷxU%^zM"dHѶ'bkP4k!CZ­8-ZHܞdge{q~ЋdQTʊ|d?lD0
+yWcٛZoS5S`30bO!K}?TJX?I
+RqsU]p8rM%%#02;
+*a1F	 ϯ`GLuMS%O)u5>U5$jw/'􄦪/iI͏`)W7/c^sƦ~X3GJŻEWA-ZN`\ILB׉T8]W1W0|pQqRjBU;7XH?d!PbKFb_nj}^Zso둳Vg?b1Gң&E^)xV dEHf;A2~OczPuI
+TwFy&:A0lU@_yih7-_S:z<(p@^0̳f$G+eЎm wU^Ykٮ'konOج).f5I'վ;_3tF?|$)
+2T}`cʚIgq&2CPɂyh4~Dː|iH:_qC;ݿMeV}\~Yl eZc˧ǄuiaOJ8ְ^ä`BDeo0{teg?o#Ǧb3L±"3dVׄE7:R ]z
+&f6#*nQz;)i|Lː;iΊѫ%1ve32Ѯe9\Ǆ䘰?&Z
+ JM`L(צƆ
+~1e(7iql:\&Hy>M<p2Ok:G[L)pLw7]3˗KPuЃAt'-U#;Yq5jlf
+\<=E1TKSZ[ܱvhOIƽy*6Unc-kn
+cA=>8Ҟf2
\ No newline at end of file
@@ -0,0 +1,9 @@
+f빨fht%Ry3x[Xc8p
+A%԰f\D҅\΁'vz0ƍjA{^g9pZjԃ]v9sdeۣ{
+9rմ~rZFO!uN5CmEC=W܂pdި_b<S)r=+'Wo*z$U@}aK-\lNz&^pYUz[_3ٷ
+~7q!i7c0%NGo卓QՅnÝJ%aYmlYSn\XhFZ}֡Rra7 
+98|V+tFŜP{&"<97r\h:h.\^PAf1zKa\ˢfR2zFSTA=bђ? xLmQK2ؕ>'$#K=yyΑf;\xw^`1C<0|9|]^4WCǓbF*8542|r}X0=#7u{
+y_˫g633Խm߰<5IJ
+J	V -U<7+5[Ep0RϙluUzW?w,cKFQ詉Ο͛Wԏ0i6hgKZ mr$&~yT1
+1ij*Kչ;zUI_)1RlNoע_(pdMl&cvm#73NVr8~+Mhq /u+LvH8hFtW0G3Yj({	RK<eߖcɠV}q9<]z2+ެxImMB$5i^U]q$nB5ԡ	;bpHG>ڶof>	7R<%tzV0-nQJ>4	w2ߗd҄0%RۄT_.ˎ/^02*RٝF<bk峝`pMsk$*C<YO04yjp؞7*Z3JԮIʲ%J++ 2(&3!8xMAD3^8F+EB5GUwZl}~wrߪ9|`P'G	>PɄPcFA~.(qyF65jMI=)@hr#EE(|yT(Qz+0SU7fۢGX,N.o8켅y!޷7pvIR8dsUKQҦHpSR3>&ziLw(3G9a@T>6Pߧ4i]@#`p>ǵ7%ڐ c	O]g>^je&_h
+:&8#E;h";wQ0'5s?)X/>A.49M/]eM[Lģd5y?>*a10?ƬC].G඿2h6I1jxW.6'[Hi{|_<(a
\ No newline at end of file
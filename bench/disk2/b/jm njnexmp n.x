@@ -0,0 +1,14 @@
+Z.aJīLxNtʆ~yvv{-Gbَ}T~j׶4G2U4\}uۥ|U{lU6r(ꀓ`WY]pCN]@YnY֐ATtNPrLXs1MkKoT5Ro?D<J@\TY_4(E80B3Ҽ;#oV~OzlP8(|DõFyӽܲ}Ɓb,ou`ՔW@4܅d6YWR0WZ9ie4i=of덶X}|IϙUc`t^1,UpNB{4*@PzߊqtV.>A+qOJ?y`ڶL(|~Uo܀s+1= Q[K%TF/^W*aZ#Er$E	ZԔf/po5Ʋɍ%+0+y{V>b]ˇ{;?ک8vNM$<|)$U9=ŝܰn\C<-݃5#kFgWY,ROqe\ց\9Mޔgc|~i)RCOI%,r*
+&̋9:f"7> Jp),qqt|3OeK0ixh 68M oG!q+Ct^JA[@*I;jA쳽kHRseDi9|D`vT6&Ӎist~L\aa~1KP(+9S tJ8l /ܩe'_ZgHT
+No2{=?+DW'9#F{\NWtO&OFmQ'^
+ JtMHUdFd<b=@ۣrN`d%sauƃ/uH-/+c}A-e.zz!(4Niteߗ햚6Y͙pX鬤%k>P6M7bEIlx<^X$;T$>kzsğvNjKs#& 7nS4pb_كfS\t .o*k_5!s{\!qv&]x$=;!y/
+	V~(àDԱk#mEQ0dsbR<Ǌ0.XJ/rd/_6,ÍdYu/pPfܰ)]ËPE.K]KX&S
+TG8HP4CŦE4Сvuv@&	KQ0Y׋!^bo^۔ie;ZĘ&Bd,!:joݗ=EKU; em?࿭hEsˏV+BĻ*C]D}?KnX
++8.H;юTu"DxvӪEF{EYsKD/СzO#2G&r;+3Ajt4yL׍7D
+ꑂS 2a@P\pډmnXq&`	ܜlBP7oyQkB>~86b^"JeQ֘<={	<o#;0k#bc#׈r	qpCZi_\؆1c=@	3NhV]_;^7>2
+K>yK\!A-Q{_NDnf@m7X*%ryotM!YMemZS D{Rm#.IF1޷XZ{ҋBu`:dgV1sx,4uYYbLl	amCk]q~S'=j>wQݢwҵQtէ	ͬXzU|L\wDwEK0K#xWR]]%2u"kzLL96Ŋ?;H9#ONGR0eÌL?rs<EAC.]ud4=dQ=tdev!y
+SaA)ߙw5EYXҧ|AN+)(7oKqqejere
+"${O\J=]LCMruymDKњHOW2Ϳ̯@*ApAH܁3Z|	J2>a$[ {e'q)͟әԕe){ c~Z>%x?ִCE	/_Mm$G6\2$Q",>t'W;$WA+`5Ɵ45N.G߇b?m/1Pz<vC6o9-}#[?Y>duOΚS[Aӝ}.uՍ7h&`F-?><[WclQ`0ąVlNŅ[!Vc0~7Ī25$SA^{ ZwHcGśL؉a[r`tl%@7ܪp=zMɢ_.lsAr	)K/1yVr</h+l1~P	A_5M&j+S|I1ͨ~zf5F$9rlx?ߤQtЦdlމ
+*Fdԡwu"Gl|AsN09/CCM=E
+8H8[1$O0#SUzaQ	w%dX'!",WD)]w4m'iΓsg6e
+k!wɥZq1ochnH\KRDd	SwOch=;cI!MUKcw6]>' kذKɁp$э6si_h0nݼH&D0DЅP?ʫR_c1L<)n/̕n*C>c륍i`>  ̛Hr ә"-ٱBFohcBcgr]>}֊>g6bAES6ʝAY)>m~:WM1No"BE*fMnCIZOm8xM/4A3{-gX޽PR-SĚKչ1X8Z-0;u0~0/,xKY}Ly˟#ǅX9҅7Tĳ%qdԄbOTrYђܥ^!8`p~"ceDjaƎ-b]LE!ݰg1>$h_6<B%frݑU`Uzuy蔊0Տns6uogrۜaX-X:MAD`*btu/ffO04[ݬR?w(`ֆ6a캥5aޙ;y8Lw#\(Yj :ޗRw +Q=J,&CpGO,5U "b;)3:S6ֽ81N$gV	3{EV&KJ*\V?lUh33hh*AܾQe
\ No newline at end of file
@@ -0,0 +1,11 @@
+w=vE n;827pKP4H߈\G,f3a7^#l9"o^h\xvW?-c<i~p#ρ+q@c体@Mg|^l_I4+S
+h)70*%*R!E!zFҍ}9~N+'^xl7,A<I!I"ϺkȽND"L#T(r3B( 7|I2C4'>ʰxߐU}r$)<=l,sDW(W}-<k?1Dr)V*X
+~
+/xk~ttWwvBֻO?[$=W/Ǌ	Lz(Lg]JPL@C,kFP^wE@Xl7aDgULd]Sr6ht9 n,v;T;=8R`z@C1cl>tתڙ4 ިe@K}jcn0	̥VzyhdKd+׳|:D; &*lu>bmi@2Фc9ҹ"__b`5	CGsҦ*8w,یwDqCb2|@G2^ H^#?6=渌Mu~3	܆웹՟&Yшkg̀vo,
+	{[УnFXķU[;U䄛DZKsܞ|,Dvf$A3L*)1q]2m,f>ϥ=CWh4zGc`Q=(CC	*也^}@L*}\Z少n9Ңz-w]j]pHEQ%Qx\.#3*8!!JEL
+h>6^{ʧd^<hXHpێ^.
+Y]hOuQesUmɑYD%:@6+,͇-}dؿlE\>M:7bc	0j@ۨC0sI	Tll4.ÿ3ܗ(;mo&K68#ꖪzhu\W> +(+luyג7 tBe!$)k@2hɁalbh?Az#Y&26ċZLãz9żC@c69Z
+_H,EBm.0y k77&FZ`޾/O(;?Tp遫I/oDN%p|>&"['S"B	 ec3=qaڲ1}-ts%P*en.{ҊW(hX}EnmgPV[?>Ck}F,fό(HKF69(NЀ[@ꪆ͙UH&0eAC*tvn)~/ġhd?~kkIHocZqElˉc#^];_jҵ[@,1I`g)F\f;sQ}HX^H-|ʯEקk	ӑ=yk"7m>ag\Wae[;xd:V48Hcv]*H:1	jGܝxUR#<_(7TC:-?XG,L8!|(/?_WpT	}8 tyRЉ\!DpB֦fҪUhɵ؏Jx[;7	҅`zo$(]m`?ZU#~eI@n!FZyefG%m$Q_s
+[@3%xPv.v<P)`~q8+Yo?)X]s.oш"7i[VBLSsD>8}pE(,Bu^[ӧ*ogAJ 9YfsG!ykswlOx04afD~6"4Bv
+Έtvrם os<>kʧ	{ꗉ'ס,t4*"T)2߿5?%ny?L3#	RyNWj>pXm(&9~ۚ7,?cKEj
+ ]PTZո:o=o=iRۚMR)o6bSC5]Yo3:+JbMZĜ@DFw:4uGuH8E)j3u~%ܷ/9,8<?:t@Gs"_Q2֠bBk`|8>2_sVX_EaBP랙-Jlt7\6BRZ>[ŶyiL`[A9C[/$~uF(#NnRH'Y	p°J	|[_j֊O}ɁFzE(o~OM
\ No newline at end of file
@@ -0,0 +1,21 @@
+3꿴;t{#];׼}vҧwԤ#lH%oxg_ajY;T"l_mkkJyπNAK9v}`溌pTJ*iT:^{gmW/XhK,Ć\e>9
+H!#ڬmDS Nr8|b 02/q&+yul$?B80igjx#?]f!\/F.Nw4`a_vfbEy<Ys8>C{0Zc6ִ.K9xuܐu6Nw="T4%#®e"hgѧFnDTnK3iwC"yF16GB)ԩ5GWJz
+Q[Gd,'Q}Yx!zS-A>1o
+q>5
+dCx8>6E<fZZ	kQmsz5,cfȕuͫL'c({3Zڔ=#HPӥȖk4\j7苖U6FjGxhY8cVyUϻ`y냽}y]/ƋŦb`Tj?zpm=['o?4p7hLL=091sRnsR8NFzˊDjRsP9՝dÎC_bzZ|y62<hK*,`$QiU7|ǆm&))k+ݬVN:Sę{::NN7K*1"a?Q1{ty֏G*()ZG#5:y2^>oDcq֫l`Fwqkؑ7Y8#.p*1,vznrbjknY^d;Ox.;2z!X"h bIP[0/xeL/#Ŀ柩':	Gf$Jߗ	b䰎p%e `1FǳgY1˛I-量4+ y7*;qሜT׃6C"R7O˅_^NEðOmk禐ٜ9~˫	vgb0kAyBr%mb5uoNȁk9s!n٘UZ`J7	6_cn]l1ǝm&&rqf=\$aRkPLEMB5taP#L0|Z6Τ#@7p(	@lf9mXo8Hb>~̣<ĩ]RJphA\q$ʦ?I!lY)IEc#<Q529W9(:|XG=̱\)μ,Cʝ	,E=kvY;`k7"F\5>jr62Rn׏>a@ߒarXS0~!˪[NL7o
+<hZ(P@\-aQ}?;
+)뎲{~`'4=af!@5aًﵦUqGKTzWD(zl=Ҏ:ٜٮU o*Hh=5av
+
+%{֪ZmB.*rt0'@eS3[+6\Ս:fm4ӳQyWO,ZelX
+17JM'[퍴״3jink"t.Y}2#K]87eCS'Fx:|Wo čNMkQPT1̈́7)\\Jw)U
+&u96Vu&~M&z'x`	[ړ
+$m:S8^dp,w)6%%LS*Kl0Mir+G-`qŭ.5e^,0ЇfBt<C`l<SiP;}V73dd	F%	
+Pw)L m6=7E#pBbzsܐkEjO|7lz6cyh&Zk[ax8'ö		NH*B:7e̩1|oxR+zf1ގχg
+4rIR|1+)O'8&@񮃩ʪ?yJʞyVWnm6b{4?wG"}OZӅT3S701J
+JIxZ|tbV*\%ɍE
+(CLϊ,WvN|jMnD$5}hݘ*JA{%{h
+baYps/@225u*x&rnʮn-nDMd)hښJ',ћ>*kc\BWvJ}'k(-\8>Ll+7H_ab1uaۺy82iG
+.q#
+E0Xr;~.riz(XN,R~9 AS a(1r{T>o>KP?E$5Ћ%&!<O5w(uo!vh:6ook#inhr4,։܎ə#] yGR[ݢm[F|P*E0;73v_K'҈23X7Mw1PMHGNw?1'̳MO- CM,37L70?ĘCDzr=faC	7gE/JX8y@"F_D
+2z#)mA*E3=Y_oc܃AHq1!~Dg)Mi{u$Y>\%lγ["|f6Ne{k|tS)7^
+]HZ{׈Be	V>;G6\5>ֹX&&նhdƏ4%qdV'Z:mC e:8sN~,\.^Mk95#<Zy~h»'֪epv3@@0|,bi0Ly(E t2';u_K|$]:B^x,m8x18.bYGbF_sXtk4Zc,xggG(zEBgUb&PWLI?LGBȳ+ݜ2S
\ No newline at end of file
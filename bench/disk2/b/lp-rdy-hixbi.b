@@ -0,0 +1,7 @@
+~$	
+x*ur1zFzQ96?/Js}H.#nV
+ ^4oi*5?NHn;?~k/8l0"&6l+sMB6T,GJUͭGobFт]Wͷ`=rSTN	scEg,#~	cY2y39p_$ON/81la|I_CL]qR{#Y9A0ɿkU_^٬_
+ހda(T%ReP4^h}JZ'Yd6@4JuY)#.Z{
+%gr5R]q^նnAggnqMxl
+аz%
++mR%"uS&Z(Vć}U"Apf>z_gw6
\ No newline at end of file
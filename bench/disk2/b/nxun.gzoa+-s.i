@@ -0,0 +1,12 @@
+Gv6^݆Ĭ3MrP4|2˧6FKX%rؽح0g.lW8H]zT&Hm%^-k|kƖ[e.L}xms?6,9>drGN㲤o87`a@iYUR(NFXj+oA%HCgo'N2.'<g4sCѣU,XRw<H{6֖Aqqp=_#Xa'|עyH*ʿoSu0h6vnzm(eN`ͅ<97݁xOQ>	N: Azؠz%oU@ܘqDH-mg;4X+קc>quD([:	M#(eiXcf
+f7]dT2"ɧ׺Y1l	֠0;f	e*Mh0m):L1)im77"ݣ۬nhrhLCp2M^xuN)yæSV@M/MDfǍ=g:LgXޝA5`>%Tg,6h[mkZH)W8sKhJ[ᅾlgz:#5ԇͦ4ӣ{qG䭲QhMymzCqc
+$@
+Y$	0<Gp,(IJ6ǉ>p{Fv>EP++%nm2,@3:[	K(w>L;|(-#˱=i(%oU7vƢhK/OPg*S|tr6xtYkǽB Bxl-DF,yȹo$)P٫$^lN},	+#4!$u\Mc"J($5{Ed7ǯ%kʋ%׮yi$E-ʕK 
+%v`ڛͶu^"l{^Lex}Q-i#8ko6러L,qHʪ/bL]7F:$ @זSUܷa~KJ]'+jF'8t 2@ثfko8JUZz֢sTz$ɭRXhb.0DZUP+ݩC|NEa(AC%@ڿ=4H TڲԳe9QF>xh.Zv.xD륃hYaWy.8._Y'q'ANу%1{+$=)Tix2Bbn+aZK܉HoMQ7Wf+GŒiU%c[綾Ҕ|ԗbX%ϺoٯdХ֯RS	^Þc]9Q8܀4 dq0_'u^q̙Rω		3>b+nbH[oJ*U;I;F3:ǜÍK#*P(RYI?iB72P+Z_eNJ"?Pթ:׶I6
+%_igoN|"#>8]hLcݪ%fĮBbW焘=Y175EwƸj>%wϦ:JŴ<NsB%SM58Ԫ0f@³ff?͕"`8	m,vRifh[ʸ uO9xx	_|?Dg)%us5.	Bs9`HF*Hkci7^]vHAA	jsbzWB5u$^5 NDұgv"ᘷ)pz&jAܡҺ&ц)mKNBw"Hv+-GǞ~='p\AFn5?0|M܎G3*
+O	L4(\p|c%~N/8`z'|	XȈghHˀt}
+NL8h!Ǒ(#<RfK	!d74EruE5rW4-Ƌd<FG<Vjv
+5L'QfNf}	ϔJ?Uz4)'FFw)e}=жalk<(`@G,b鵫̈́iӺٍ˔`y9F%\o4atqnr`NnRc\h1I+jR/á-}TRBX#󚠷XVX>;HRc᱓&sk}KOqXuJ9.],<l`OPT0<jNחvB6e4To{"%"Pg87?"eBA`Qq<z<hh=e]=RaDT475`$U__'v.{&7:Ϋy[T#O@($b_-ݿlRriL]ܖIՁTL's\6O3MJ(mˌy폽m0|3a?>L
+)Rm
+y޽lsPGKh,$'yh^Kk?ss>|s1z[77O0`	
+5ELwdv?⪷Dj/M>;*We]\5]Y۹U1=LWIz;AQtDjcw^.'Z!Ā8-E}WR䋒	ܴNsu[^pZpUZ"=e~_BoED8I<]_D)?xy
\ No newline at end of file
@@ -0,0 +1,6 @@
+HWu.2߷]i2 "oLFF:\ POyB0Ǉy;FCSz@v*
+q?MIKr Ω˥}L[=7W#b/h]5C	;k4V!^=O#J]'1W\4.uPv݊~GI-q'Er1QM܀""Vz-UPpF`Ȩ\>ga=o6H3aovξo-oͯWqk(+W*AC'FI!IBnۤtD8y(qV>@1cl0fvjw+(0Mbz?G?hW2t-{Ei&t>kr'FPmѐ4IC5|m
+e_\kUEvH-7@yqwڍGy%o+P<0ħ@<T?q#P8e~- L"@FݻCIe=Tn0Q7p-	B>.2,-Y5naz:5++g0G<z6bIW_淳_~Pdsi]m$2Z|Ǵ;3Xa72=YKԲ#_\hmп%lT$`贋"[!QV\ٮ\ڕƦ15&.RuDxWX6O1{\Z[eznN=.!0៍.mCP-{`/xQ3Pv@/[TEGKn3{iofWUϰo9Y7~:ĻWu0'	Nu+u)23c.enXjY",,^(2{`omݫi8NAJ6VQ&@?:拰U:ÃB=g:J_#_!-0N:$z
+Օ-q´z))c
+ܬis'+O/ҏ&
+LGWPa0劆no1'm#]TO(fHͻy6Pw={:F}H(4|m'rO1yoTFFRbX*̔C|ƆQy$>qMw!6`|tcmu{U[lg}/}.~gR8DZO'^[<8Q,SySgJ-	1Bm:xnH͑4UiwIp|3)q\+U!c48)i`G_-43zc2AHjR:=PЍbd~̺Qv)eLpiIfm̌PbMg	Grt*!ʫ~EɢLN"Zy!Ozɞi7(Y.)FuP+=#O^j+щ*&-?U떳y\==i&s%slAR fk6sATғGI%W8Tgn83w"gZ;نߐy4kHe0Qk.1U*ix[p!BT@^O֣d^|T)?<-C8'Ma׸[tnTg:띫IOQ۹fwpj?XoeBE{Їe&DdAVS(KnPZZjUYxI{W/Gɣ4SHlMf#g~АEm+	;dx)mU&c٥];n<|Ƙ'z+E7?$;h$ԁ2B7;;n⢷JE~I0=J +`1#?e`LW*pxvUBL9itPa<<`?!u-qoAbhh+K_U6T)*݁A԰(x0k.X3PsX.6T#)#`s&		BSU]3|iǭB5xM
\ No newline at end of file
@@ -0,0 +1,8 @@
+K_K8Opū^ULp,ߊ+wL@t/c('cfó!KltQJXKeSZO}-҂{IP$Ȥy}n6>Yto9']b׷a#X_Vfi[V^Knl^VbO6dD(lpFYU
+
+ܤ~/
+9?٬,w7p>Ý*º9U3՜kAnF gTDi3*2EK.e#_Uj]|OҾ+T\<$|-+ʆE2BwoP9ID'2z'H:iU0Kͽ3UAbM*WY	b뤹|ݠ#|tH~5obqhg/{g4	B?2h/MHu*zq,aUK?Ƣ;mEku0얻r5DޙW] ~v`GO)âYT<$axz13M64cynz(1}eWvqͣWJiK-EtŦ/wOBS57:i}M(P5N];1Zur9V=`|Oˌx"Tt0xs9|xW}xK{2	q8*wC7O;k5V#3?cHyd/ճQDmAc֎0胪eS(&@=BT<
+S	'b&xŋ:eZRm>{0JװOa,jo!Kkd쵢ZVJgi }*y>&w1aF]tWQBK- >TvE)/=L}Iʞaw탖Y=h85B5,K!њ]=Oy_ԝP%"-ArmD(T1G۞]r!3N@W(؉ٻOt~`>aTz0BB<9?11h*21Y1[:'JUIR	IN	|ufK~YHe.E%sbDs-eT']䀣hJ`j]	IF.׳~7ΐTs	J r~-c"@($Ji}`NZT}Q>JMŤEqJx5
+OMyw>BX(1̡I΂TMߡO5$RکQ1­!hv{~/U獨Lg%e;Z 0ǒ,l([ku5Ч*1A(R7'wx-1ɥa&ioxrFwW^#@Së7ڐ-YP{ymh'ȹNWIBePS7IYB^]}2w>HUjlU۪:l?8
+'ܐ	[bX}I1a	1B6pCѠ[pTG;ɻ?aP^(u\-w(ugjxm*vce$	#ΧFʽ"}x9Fn%+E#Yy2u_[<e>/'hf\`LM p
+]	#%ZQ|ͿKv7^aS 8YxagNOf]&NWAM!BJ~eK4TgvϽԮa'2o+vu8WUp_ǲAfTv+pfH_Ru酌*Mn:d|IpR\#=.\L˹'xx<ڌq̦#1K4A-G0	r$%9l`dJ={AIaN^iSb9ͫY[n]f	,b/Ӕ\А#ƮVbN=@ Z%ziMTA P{sΣC˩+{jGG(KV"ay=æm3p#]M<%B"鮩VK8kG2xSiYaT
\ No newline at end of file
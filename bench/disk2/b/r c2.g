@@ -0,0 +1,5 @@
+xx1(~'td4Y*ݸ][i^#hUfxi c~MzzS[X,
+X2kxJ(fzW㮝T>>#DH#=	nwiSS#D;ZW<-ʟXoSvFB2hYꗹƝ'Jegje(+t8L-ydچlGb[_|:'\{Wkno\ODς󜙻VJ~4ՙO	}5M@ Z$c׫Vn?%ej~)IoR_L9@NI_Mo|o"?h	|j/Z,
+B844N괁cC=*w
+tjI=Bg
+&kMl?1yT?=yvs}gW4╆Dq+VflJiEfܺ5#gSԬVG|ٙ<QH5
\ No newline at end of file
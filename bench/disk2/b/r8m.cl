@@ -0,0 +1,11 @@
+U,J$
+we[ϵGp`CFB!fg]:0?I|hK1R~6FO	o.r363LA:sRQ'z7W]u>T:MwR6l L0>Ul߿p_W&cXFqԁנ:|YvF-،9W3n*cJt_jڙ>Oj+dQfYq>0c*$>~z%pOĹQrQE	c[6^t oB.*;6䗲UVϫ~8?5`Q;FH;duGm8υdKH#>?ׂGx3{Zo/&JmƲǠyNPѕŽsv㺙}[Gg2!>e8N5WkVLŮN~vhY_g@7K?<-0Erv{,و-'I-w-Fڋ29):srK2ͨꟙ>WY0HK$-gQ!|5+y6Ƥ}%mU<DLRVL,In"gkM˨^§$mh7	寮a]^Ğ둲MӞtwPyY	"DbX{6vAjtQ0ZiIjŦ处$LSLBw_FS=	/hs-c)DQ^,b^(2Mmcl mUOdPAoo=d4XO7cD=t޺!H`}o䯅,+Yg)Z(N{S$vn3l7ZsΦ8
+
+׃&pirjDmnq)_=>)vk07k$D.#밝oG]S%#N5SZ?4h
+̱P/sCF&*$F[֛h5s
+/ky>>f#39Z"1̅&u߫gbCSѥ`6Ap9uF&q_tE(tV%X޽ҼwӶa<5_Xu>\cK^歽.Ng4ŷp]\%=+w5WF͒0}+-c
+C3-ié>5ܑl"≳g L6?t{E=qЬL`u}h05hjMy~l	Q)9Ɔnͫa5)+q-IYPOhd|y/5@jY6yAD~i;Ȍ<w} ޶U%NsR~y-{|X.	.M.Kdb0nU2\0155uʰmQ*/Ӏ\vY2JvgԎmM J&*iSث%Og}aB6>zuEj	ǐ&>pfCT#Y"gabѴ'/f+LQCNQų7E
+4lwL8|t~tZDrMAak^\6N~JʢJΝWr\[	$fA>W)mV4MyTs5I=BM7QHԻQ^<&NFANrCSWM)`ܒVɻ`]H4mn~@ueA~5m5_|VOo#=]hዣWX1TgމDV}`yq^bm=HS,M.NP2ہE܌Sq&T"_iY}g]{?mt Er'p]*C3mg&Үb9ƺ
+N{uٛf8q(i/zGw
+74:݈Ϲ5]g(`~!9)@P	Jj<Bpw?zzǟܨ!Ypf[M/g-?e3
+lC$":"]C}#/үYR>%|p	b{gf`[Ls*4v
\ No newline at end of file
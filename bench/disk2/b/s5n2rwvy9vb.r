@@ -0,0 +1,9 @@
+{AlLk#Ss?gp@OiZ1{g<D]{>+.]ES.6K:
+qn_]YlEfMm/,4aC	\aPuǓB>l-bN!;XKAXݲUꂮ>{.+Y<4Q
+Etn8b\I1Wt^~tҌs/
+B?aR/u݊Tr6Y(&	DF[k][)Ni<dm<CFHN+J;=tgv8/Ǜku޺h'_Zvڅl[IɪS8g+zw^ڃ=zQdYiF<f%xҁsgg;wm׻بWZS3r0
+?8FJĦV0;0ZF}˵#(#iR(U'Bjs׭ߴfmIW؀[bijv̧!	[t՚~,wkQ'fK&1IPRL/OomŷC*ivq&x3WS+:NRa]DcxLԋA@ҳI3`2ePeA8?D?F5d1`w9?h>+.Zw:3zќbCWpUSWM4"s1zyǏنƠ|Q#HؿA0I{'C]1qP|b)vAA,|9ЉH=RA-L|v<S&#>fgRsvdƜ}6OttGV΍pтXہu.d~z)
+J.n ~P'5SxU|BD4~&C>,fJ,e{?+q*=Hոfݟ>ogؾ8%/C	nRSf2GrB{L_@2_w2n*W&(ATe:Tqc`^E"Z`;Ryꮂ@ӮXeDWorʑg}!5\i|ZvObYRyJ1aiԖ:%h d &<xh7|131},(DQu)깨S_'3KKuGrj9[ ݈im!˖}:sdHd"0=q㋬=Iuܪrn1VuH2T;^v	J0˥3;KL(6>Bȇv]؋0Cxl|}16 va~"O\C!Ƨ|Qmŷ|dimFvSzlxt1AY+ovI(¸XŧtNUk5Q	pX\i\.<{WTeߌN:IKM],fWy{_a;v{%]=	7-,[*ɘP뵊)BMp3za+SRJw]6J8~T?6MBCӪ.6<Ƭk=@<tMY)]q)4s#ڬW:k%͈0)`ĎbѮw7POYGY7>
+eZf.1B_*~BZhVZ,Pi)reb5Mo;Pm"3o[u!g5ܳx˵L# 9׼~JR!o;F8]ЪȌ5k)!/6=t~ffٞl(%m~_!VgPe{ 3!\PϥE3BkĠv>:>ğf5	Q®=ыk-Me:	g$jrDME\s݆y60nBS?mޮzv,Ƶ͠r>*zgmcJ&Ui#HVsf/l>jݪ5Bg?j~Iɔjw&y<41sوh3_4q⸉O~U-M\p[r_ MuR!%$]R renD!Ϻ*Ttf U
+)ۡY=`71cqo Y:]_w[T$@\EbaAKT#g܎9	H<CO>]Ā$	_n-۫T܏I­8;JNݞ|Ra!JN%rYRXЃ7bC4ؾ[D5RI3'z"juGBCSOy=AAd~oSzUoJ;h,M-eu/f?Rzw=^d¸mc2xVG2s<%]Ih}21AbY4XZfOrrӷF8u+2d6Mk:"<Տ	GɫVx:3YxC޷~:hMoQ:h!}Ю_֌Ȇof1M}]W;gsk4$0N$qJcׯ	i<Hc)B.a/@:HV:չ{&mZLB>Z?'g !@q9n(xȩ?Qvя2%]U~OB`n];Ʉ&xxo9UBR65+Q~[jأZc"`Qsk:8R"TΒBlSH2%MzY\͠vw{Ls?5Q>@HbO1ËC8i\3=asD~Un=Mm"hҴN:+V1f0IS.7c.\#~$S]R|щU1'TLA	1QU$@e.ZV9FՑ"؃VNhGY:w&uHEG%W8ǧi݁](t/GžYz,dP.W/17Oґ7WR183h9kêuC#2,EmV .v}JjkޣrvCK:fO=Mdz"Rev@בz9\yɬ@`:hNF'Xu:I` !	}(6o*5y>al6g"D>d+jҭ3ԉ͌py93I	ݢ%@Qo*cK#g!}6TYnM|wB1a"7PYhX׾'hd۰© 9XK\2"ء֎@pLiu>Ց9#0$.	d$k̻4$[R?GP`WY;\  }WL+bV()gi_[_|T]^e,9=C@|ĺS.[JO#i{it[zxM%-H{>/u>]bs,n]Y0'F5nzc
+|Tz")D׎hF(pzUbKs.|Nm!x.GQ0D ԫۧČlZlgLlbH'h[Z7[iOɰ/"bCD=(p"mMb*ΉA
\ No newline at end of file
@@ -0,0 +1,13 @@
+lz5-i4^`#-?^=Q6~V"/>{<[H9[WR5~l62߳TYY;&$ŨSڧUЀ*')"l~b4p3r%Q)3v$ݧګª}F@$O4?~1hb@Jdi0;ic5%~W;\FR3AC`
+3s`){E^eD, +޻ӫsóbD.Q-x2)
+hIJ_aJnq|[Kv@A")Dڸ[<ewof]<o4xR):YZ:|oMa(ЉWX 2ܷ@\D92
+!(--o@P4<hfb'Pj$<RV]R:K@TWV`IQu9os9x2߮41"0D0`~~tEbj~L)1Qx5̐A:/LcG*IfLjlWxxݪYa]88P;$opfD[!޶\z{h.dMn#
+|1'HRԉq@o=_#e"zt}@JvElXgJYaRi+O.xOߌEaN
+e*ύ!҉տ+qVbUOU>Nu䥙>&g@R`j@ktouK]iXr"%y̜nz\,~H%>`qDjT:LR</6R{x+A6d^;(.3W6p\r\Y	f+GSy]iʌעfYVpUE=x1#Qnh0mMgBq}jB>?@܌9'C8FrRoZ^tASHZ8+Mxbi7yy;767]*[s@^]ÀZokEiT`3W덳C~|Eh8 sz[_PWW옵=䧙^"˗tm#8pй0\96`WTEmhvi!NC1UK?0>I? ɓɌ/wvDRHk2?~q4:sh0*&|!_?aׯ:3..XmOwZ?Mrv<};lDOa9,8lz^4R6e-\}ٸAs+"`CB}R<RJyx'm%8pL-{.grɏVn"zD5k+,X6),ܺ-`FQedbv8k
+BLܖEgRf&[Ts?#b8l$">$qIm;AN'36瑒n`٠6S[;k&Q}hļhߌ+?N,+ufA"ֲVzN$,"qły$kH ]a([kܘ6p/Țc애1Bñ.U9d/'\",|OuޖcQֳ--hlboV4j7 p
+'f?=4xdǺs4X'M+ޔv([F"Ņ7@sqw/s~K/z~ExFm?KذC&qk.w
+r`.lT[̯XqM@f!0.HxȞu8lM\|0еgۥTFbA,VOnJ
+r3v1'W}nlLɣ8m^*FlG$jGabyDy4|K!-pg䑼NL8q0`N{]	j'1@X9pbr}ޥ1b6cܢVOPoN哊Et6}#X vlH+PVr\mdNe>GJ3HyoŚ:kOIC	nPzbF[.CM"O^7w8N1&h;C2"4a
+1ߧ!!Lљ\YF(z-GF ye>>.JڐUѶ$-yz
+#3t>JP~&Z#nm$FK#|Z)Ɂ:f2n3ipy}ݎy/s;[m8\5zt@J-V3ޒb7٪Dp-Xj.*C?*LNބlgcc7>>\-DlͰg+8ppKm9FB>+➭]C`Y-QЩ2dR7;8Զ	qR*6'q.efts#]EHx88!q
+5]b1X`I/2lXķ2)<^:.IO1٣e>]lF6ZQ4_uolOx	IS	N5*kDfdx%	q_vr +YI߃-dV$A"7nOOK"v	K~X3z>a Ab_ЦMnh~@c$vKF2T>&^V0|F}3*%oƌO?&MYקXCj@~eK!;E.	r& UOʔ*eӎTD?=r
\ No newline at end of file
@@ -0,0 +1,20 @@
+24K*e||l|̰+mhJ<j>',_ό)P9"}4IA1|[`#oJ=UԮKIzq\8e**d\;
+M}{[<9֒۝k =_V)Z+7F-	=д,+V:9k_Ce'ŦW߬gGz:6	E4@U&
+XqiGP]МQͲDS\RiV^T!p×ƦzυeƝ<5wrK	V#HCUm6QIPz1Emw\Ir|}@\@#IΔwz\JǙu5c+'@N>bA&s\o0q0rGcjXYZUs6#beg6*MmV%V\u)[:gmH'Y;CQՒvA"
+6Hh^Uzџng:"?oAtGgތX6*>v8
+`nlkvt:Qg9:bzqʂB0\(]l-S7.xFAq:z;bj2#zo[nc
+[wr.VYkaM%2IÓ/X̔.<IK{=hC"ߚ8uX'j:Rw&N#n~Gc{9PN)&?dX?l#Swj4CH,R
+6hgb;k!ӂ:zuH?@ǁ(۰Q!n
+[`;oAj q(q)`a;'䭻8 Ql~DՏb|S1uh=iέ&~4_G)Zttx9ըqPHLuDe
+\BN[&I7&V;]	t߻{&Z	$R79R^.:#xU5/#OJYԳj,	7I韅x՘B=iN_6"zU#6γj>6H7m젆1INf5<WoA;TOg?wz)YPPB{ɲl0v$S\3mH#;x:9DO`30h-H#5Qi@fpRuRYjUYF@m[
+a2m+)GI$N-!uChye"B1I;B+o,W~S~p~^nK_QTzdK%׹2ZU8U^fxw=M/|#6T:b[yEPȜ*_:
+S]7+' b7%G'SӜJyP-7̢5Wp&u	6/-㨝7G+U&|2oey72
+^4̶Qߤ":Ŗ8/?lme=
+E{,QY.|9vjEinuPA]&r"ǛS_eYUdBiұwMiP$/kU (ES[A;ŉX@wlͨ&/ӇRȣ`\GL%^^euFKV~`.mg"ʥI$znˎ$^@_r6:O"Ǡ1/K9gY	P-%σ}FLxEZt>oArQ?y5cL^fb2ATz*_WhGjV pN&yD`})!u".A;5ɋ,~U'gLׅ3M8s</nzaφ8,yQtE[2dŨ-j
+P!*!?Zb~l=0WJo&"_үp⧩ĊW=[=ֲ2}K n^f,59d[rByX1@8$u(14<}=^ĩ0*rvTאbeg1@/GB7*+sB#ruޓ!!Iפ{pO=sblx^r9t	HJ
+0kĻ^[WZ
+ݖD'FRzoEG$QKǆ:?KkUP':{+r(Fi܋;bbfqs×=\r7{:-
+O/C^v4(ky]
+IO*<dKL2c8*J3'RMmD#v0vbs$?lKP{جA9Y*])˱nZ[nͪTlԐg];SB)mPDJCNS\l	7
+p<P`)}:@.sNx2UD,a2q{I|doci^Iy	s1QnMGh?U!j@/--J}k@|̇r^ʉ?!xzA{'d~BS.}s=	OQPȯTxaT->\E+g)emԷe$)T8[Q~k^LC"cd[7S$.`0"/Q́⼑&fd
+w2-n۲ȑU8H|I2\lrK/χ~'릜oe6M A9n^	ojry\k"V\z(?vuLj_U\	krYcvYWqkಅo3^Xvk^A~";*鐭60icSJ({|Ǯ}T	^,784̧ɮkya{pD3οiLO
\ No newline at end of file
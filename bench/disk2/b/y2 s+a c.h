@@ -0,0 +1,12 @@
+9?e*(09@ǎUR	ud>b
+uN)ݪXj?]Cع
+;n|/@,P>+{V$R9ZH5Hm"aOm>jRP/`[=ϝrTc#ysMCdWd^4l%Kpl$Lf;E=+սԫw'^r{:`Zl &NG]({+4J0 40^eH'0q>$li}#sϡPyLq}Q҃1`TbyIaWVzK-VOvl	PΊ)%'Q%ކbd\'
+EV8l'x&
+R1eg?dު퐘 )Ƅ&	'X]HlR`ɋh2YPQ6xN3V0jD:X@fZ&$(~ b@aܗTB`ӋeL2e7<	t)r/{1A}^8b䈓ao?gI2H_y+(Gv!Ou(x's\9ՂI3hLԌR8$>?(I1,Y[J#vݠl/>wpGoͰ&QkRȰ+M㩉j70_ZBAeh,]jeؑN$0i/048e?iDE
+@15VI߉d`؛>	ӀLtGl!aq>sKn	c!o-l:<s/c~75Sٍ;+.yQX.\߇\86>%ʽyqڏT%R-кNp*Up6E3#kD)OhXW=/P"$#,5t)G['4Bt;b>Āe1=]DD1!rT5':#.TnsnW#Fr	]WhNyH/6=hQɢ6寚-, 0r~&̄TEf.Ub9 gzt8X%*nS8yj59`@"W Mvt\\ΌJ/N'[C19e2&C1Q 'PѢK-鳳rG3%#+rxT~G瞘
+
+ϒ6SAb팄|b|Л<[1V?	fC]ݷdkdN@-q5dwizVxuB]ؗesWoBSL-J}rMr2e,~YSyR
+S9@DCpOaEy>Y/F쬾:%"^^m̼{LZؚ`WӐ"tDy^ehsWF5yč?,*yXoaw{)E})!C*nz.ݩ,(Dj!uZfqj'CMgkO;*|пhqT4T]}ndO00l,u	d"t {A<<\MYa5O?|711vU67jeXuNKЁjP*F-pSUR6Хca/jP,TjzP?{pyJXDd:RKީ~D0Xz|LˁaXF0Qޒ/f.xPMp+oA	%N	fS;Rg27Eߖ!A2ܷ'ɇ	埂e	c􃕲erV9s{$dklbA#dOn'f+I.lӹ	M[6ìL)F1ϴ<jT~4Yֺߌz0'֭fLvR*ˀG^mry2Xoԩpy4"ݐ>]p0kK -v5=2n;{f(Ο Bg\ukfKZk͹nt'FW!k+gO2g<JhB;6.VQ=2Ι|.ᱽ!c>.#2<\`e̩Tl
+Nj? k`Ǆcʗ֒Q8SwTzȟ*BhzP+'L`:#z!MD5 clqh#uNylFFf[&B9cZUs6\ꪏpد**yZzk?IAj|e?mH%߃xiUXB	n8e2qֆ<МH']yp#=[|LC`"dIG1wS^MSaĘle,Qdgtu{Xgrվբ#Yu|͖^o(ܲm#BЬZs,p["O0-Wh_4n3ޚ*EJ鶌W$m30;]:_Mӵ	z+2/'!cvFz]=j\1~{UI-!Oo?Y2DNҵI,MMb׆Q'Ġ\/52Bz=!n<|n壩]rM?镆y+ǒ4@j1T-%8"I)Hht{Wljt#'5Fhts><<a음:?b3_1,֕N܍9.xv{sलFz ga'-k[1enZq#qL*a(gKϦ~@2k\^Aŝ$#$S_g)))jbXz>v#w=Pva]I>%t4R=l22Y'HQ6SEtWoi-H-uHBZ'@@
+2=J'<<,N.cUwAQd՗2k3[n'	XӯAKX^kƎ#;8gD}Uܼ͊=JM4i@gqrcA$Vqr`vK#?ZĪ-ןvoWLwNPU{fe.N]Nb}H.7FC
+%eG
\ No newline at end of file
@@ -0,0 +1,15 @@
+*2!+7;ukUK(~-3rsXDE*	WEfH$A'=_r;pT+#-%o
+t-bo1a0#Wh{Pj;J$1)s/y9uXU[MM҈WҗujA4g@I+O%{i(x^`8%!W*Sa1HR3^AMaz쾆)ֿ6PRl΢̯	&DT<_Դe=FTkS].m7L 9\Jܔ"/,SHחiG0G@\.Nx|Q
+AX]y̦
+)Ooܸwu:}IJ$518i6TY=
+<&FH3Ĺt-_k+,Odҕxql4ye|=H&,Ejv0s!F(ъ&̢՘HeLf[d Een&es/< CӇYUk3+/@%SDpfHAɁBxVrH|<SnB蠼Gϑc .Ǚj(H1yAөbݨm۹|f9u"O/0l|/UUk|^`V=LE_+1^wC*~hۣ){6p+\Qumќ/7:83(0+йDl,`x1msxqGNJ+] Un=: ֌!Q-zw
+Vm1bsa9N8<,:&<T¼KEm4"8cr"JYƨc/]emg}
+%Adx:%*ŬJ}6K\8ޛՍpڄRHﵺ :f><WGe;>NpQ0}̇K¡4Jh,AB+1KSw2Uf8O^D.%Y_SUUQcǯF<C>X\,cIHuyDtYj72Eo+Kuy	'm ![nh2+ܣz'E5+%S13u,Σxd_0[P.Vc=ߗ7"ȸՅW0ulFB=@496b/ k	ŬQ4[MS^n~/-h.ՕWx7y^]㻶b$&zEOLOz*yn2XڱKj߲C:G18o/oι_+yЯȝN=	=Ohs%!;-EUN	|$Xqq+̘lJmk@(!*ǰUjO،eY=r!
+Z%BP+'x{;($F,Ey3VKh3notz-h_kR;68ֽO
+;PʄbF0cEt7Yp'NdDŪP~YG?0~e@D_xƲhv$J>WEӋiQ9]II*\( VaN-Y@bi8 <&pm}4,eDθM%֌8{;aNbmZ?@uSp|f/i	S_FBg=j4I[goM#V%>pix-dӨ=:q
+vggym^	;G[:2݆_?"L+䔛U'۟˗w8e{Xq2EmΔRGXۏ*ΰp>XW#$wBj̓3V_9r׽H:w1XoA;nMH},ÙYeT*hBLDv6vH'TxςKGCj8bw` S:\sEH'Y^ß01DU?"q{CH鮢3r	k~B7?ď[r~`mƹ?\6&.ɴ8G)
+zSIpd?as`<1:Ȉ#`РVmQإkst8C2f7pr
+?'|۲ULFE`!nv4Nn*>,Wpwj.A0M֖WJ!0yRyz4+oTx/fcA=o_S-#w>tk9.1g0wVC<Z7rDqX)Jkɥ~Q45~u(q\wrÿ*|N@`$6v.]	oʌ*OPk_r**`s,ܠ6}?+cA3ZяNJjn	/\!L?bܙ4.V;(WlzacLՙ!vN-j=Bq`L44nRK*@dKϵ^2KlkՓHJ3;9TΓ;SZJl>d202BRA9JUܶ/|J	%¤*t@)#BnUlEUC5(Ϝ>9uRYp]	@({&4 >/BFRޤS7QaȰ,mtw-xe"HJ󞔶aӻ{VrF-vSeByVT
+PJyJ.!eF@ $h=3J]t¡}oYLR9d]sp"*]ȽliαX4 R8hk(|vUu9ZdӔ,+(-^?1'Jm"%.=%7=/h6 }WzE>~bGp)m2C *I{3ěm
+{kݘF?`v4'UP0MnuԐKP֜?VE~xߛsᔋp\]ܠo?;T&_(Rzm0?KJ }mXP4vٕF~o,>Fpnfo;hoM
+Y&ae/mC>xIB]aseAe^Dv)ToHmƑ{Bco+,QV8rx5GYFGjJoqaXغDt're6?o*8.r:DQɳAsE)!: {*u/W
\ No newline at end of file
@@ -0,0 +1,3 @@
+=	CEH,C(h.w0|Mщ^]+VZ{7Oƪ,%li>C :KШUeSiuJ8jc8_𙧠n(RmK.5BQ=L>̵T2=*-j?lx4	,wK[+ &u#3VWrGq1_iV\W0_JpY5rjw<RzeֿHpn]i=kNcG{nʌ{©	H	-R[bm.W.HucCc,/f~^:<V:rI{"V߉<(Z$s,q?wV8<^UekO^߂Au٥-m6LlΫf1Ŀ;*C[<R)]8e?GANVTK`3/;uϠHcw^|ۇ9~{$}DK4E?n%*C\fy{fJZ_ώCj'I;D[A8zxR V})];LmeN*٣nB'k`MZ9Y{rRC͖3 Ibxih17P 1LZY'3jPòsr0bIÐ/ѸX۪<,kmnLkSSFbM>s;Xm-C%un_vxIRh ȰJ^^E\+{nP>La
+SRJvF2F*0֭&#sɄQpqmU䫬3Nwڌ*u)sۯ~}jE^ĐֳʬxKm8`ٽ$]?Uz2+p`,1)ٵc_z/xxvz+zL..kEGzI-S>!"xdUu0P>
+ ?p{:MbމL
\ No newline at end of file
@@ -0,0 +1,5 @@
+4nY|ͽb(T:ƈ|Y~9':3C0XK쨫J.^Z
+]N%qs)2wLI8QWge
+9bG镳l)]Dx~W'l"?{ Kw"}ڑSNġ:m˥#.bFp%Mot=(x3i{G	fb&|8AVˠڧ$N.>'b!=	)VSRS:orizltQa֭V|X_+G!
+a4fKI_}S5\Β6$XkEo#Ȗ{TԌl
+Lt,&ёhWm鑮*d\W`LBvhS	͛-K.*1u",;cSٯ؀/jTzZO"?Jmۤ_5-0S.¢v}qFYDeCzO)B>&0z3Ζw0mU͈P45#	;2onǞZQx>X O>Ez5#쩽[B"5f%V=U'f^Î1_:J'B5Ok5LSE`óìRGʓP7(=/U&pת`aCHZF5&ʊ֩6>r6Tẻ3K>K%/H><HPMFlA@^PPkJ:#KSuゆ(:$.YC`gkfCivcb.*sj;PR?~jLRhIUw}S(xSN;ck0>رvڬ)ԠR,!B%6n)gj|bҪ*y|˰"F)܀
\ No newline at end of file
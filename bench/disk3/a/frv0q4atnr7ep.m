@@ -0,0 +1,6 @@
+Ƅt` rtn8jW
+|ޯqOeXH;x9cUT!RQ[Yaywv6nbS2aq%ق?,$ǡɉūn[f40mw1\vˣA3k!pQƕ}4e)oPP˵cUJ/rs-|Z
+vaZLs4k'+X2WnOR8u7	DhshAΈl(rd
+s
+&1x`^Zڐmh&,M*xOM,GH92-cvO)uvpKxH<$L?oZY#jy@ݰ=-drץ$aer@<.h 23qǒI), c@!D3;kHa>YȬ| Laى,.w Q2`VPe{Y'&U{hD~g?GL3G|j@Wߤǿkqߨ]v;I~`Ts-i	'?
+0-*˧]>؀:QU sm]	E`eX($k0u8щDpdekevʖʵ;}=oy7byK	(i\1~tCOuݒ+sN*
\ No newline at end of file
@@ -0,0 +1,9 @@
+
+xvYBT CP72.n<heOG6W(;0p~sCfR9HMY8GC(UEX!usCզUc@35/"O?Z*0O-7dtS``xmwAm"t f|8L<LznoGp-+~b5qCʑ8EUߎAFńdc|M"Kr
+86|q"yY`%ភr#ۑ3^r^1N*DEMSW!.zkࠌ}TY!Sw OfsK	1qA*ǝF/+ԽCHh\e	C	GcDb!NX\} XL-Γ0G%T+(Rr牁("<\ذ1	YJCK;[";+ޥsهu`k"aK 3#Du[GĖr,\h[Q?}%2Upm]տ슣	k(frs 6O*Φ (4-kUAEq&VXzCao6}
+$zK$7
+bRm"bfa'3yfbys?DjH3~d1uq`A:p:9)SJ3v?ެ''AЛ?OJvS,I@LOC2Wܔ/)S;ts.lc$yHpVpa&|6{`V6}s0cfF
+(-l	eB?ٙ׻*5|Fҟd_ɪܳt2DC`'@xv@m6L!hmgz]\X1YFuj͋}@b#K{!@im\	mr]$p)|^܋Mcd 8y$Iǧ-ȣ}HOc˜~LW?1akpw-H"`6wТK}
+is*" ^L&{M:~	fYp씒`"84ԿuB,aeXDq<[glAjbzIX1M[VG<k{NqHQc*bҗ}QoSP#@Ƙ0@Qݙ\E*97  Tak\o4c	`9hhǦnuu&D8 _LrJ>ˬ7sG]	n{XA>ЅQ6/4caId̖RETڵ8
+_噾~D3Nj|
+[+< {LLF,Yt	[t[q^Wl?Yd$bt/Ůa0JujS[8t+$Xp(ƪ_<z{X.?6*;'ɿg.j*;2Zq 3't׈X"ubl"zL_hA^Ip Hwh<O[	@:GB4K%L?E<kN_^}_AB!/dMQd*8K(fz YmefL|Go"=׫hW9o8=ߊtF?)IMCW(-}M͛>94Gj2_._OAc{d-뢋R#d:aRHE]eoL&z5k6x	=Oa;f|]`q-}W:,nm>J-f
\ No newline at end of file
@@ -0,0 +1 @@
+~XaL@Rfd\Xl8+3_"bKKdg??YRiBkKGm7T۬r_@4ƚIaoQ7XAto_Ɵ^nfB-</0_rQcW3\4=$n6$рt+s٨P)<,in	(|_	ﴆMzn<)n61lHoZ}EUxVNX(ySMGh#zJQ-f&۸_֤\O>	LV(B[^t0EM<v5``rǮwzbJ"ާI.l	0,dtK?? @[(`WF ZfP([I̾L`3:׺_3MtdZr
\ No newline at end of file
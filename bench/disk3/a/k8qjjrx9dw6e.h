@@ -0,0 +1,7 @@
+lGLjIU)#$#n~%Y%'o(aHRy~FGtJ+=v LT(+Hw,6sJMTE7 $<ovdp嶄&b)-v=G#&en'Nr!<fb]oM+}$̇pHZґR(&%ɌB?]e0K	CM'|a^kyX\%ZcyĽa^#Dw/'"?%ºSY,rz۝"gPhM/r?:ZJi(Į^q؅~q'K?װaAzj2u:N$9cbr37(	An@~oFƷs%*h`pxf^0w9	.ȝO4Y!GQi|
+!JMi4opHB.k"N!0Q$c!ϡGj36į2$֚)3S2n3,	~/XǣQQIV
+!Ouz-6$D61Y;ҴWM	ߥb/mܺ=c͛
+|sfrqUGAC%n`WU$VGsdhE|/è-]}~*TǮubd?(y;u6('zY7it&Y,s%b]zu˥4Rf$:l[i=
+.0	~֋2ΑR-b3#F} enl:y!g+N&&ޥ,rKo5}?㪮<n_XEd:jKNDȦi+MDJ2Nqs75MT9'se7V;[jb>m#zrCKFuoqO:㢂)FV'41Su_Gx'	uv[\7#/6(K.P̣DJ JBV\ɷCgwp^NfT"EI¸mq[6Q:xI^ZyftZ/!-=bRi~HUʇH>z֗~$?$VLqXLET,>,O%7lMNsL;s흱x@\'VC$tHa{P
+L]mTyG՛yR0,F[-i9>8@<	#t^.Z=rX*i$ 1B<H3yoï(n}7٤kZ!R&y\#S{KK5p4jP[@p?o^XۈqoC<s2DY5>!3ǅ(;1)?"y2U4]ڭ}ASFGT"j)o.#vLXu S5@2(|,xi!g;HbGYwdl%3:uJIWJa,פ~7:Gy<O2b[.钊j6%Ki+ 6Ba)~o>Bx#[f)MГ~?YYCUA"BpYu,OZ,6GJ=:UP&+EF>֊Q(4Tp^>M+i<ڹzA'9:X}Wd<ɳNy -p9Ҽ|׺sTTz[(:&ZgHM:i0/["Jh'Z@u}rSshqtQ-wlc7rU{zr{=n!i"B0Ya_U3Mes5F[L26N!{/WC<
+Fz"]~ml$1""J*VUEPL-`M<,h&TȒUrk6HUs	Ak[^UbƯeڠ/F@Szs\[RP9'!zkG?B
\ No newline at end of file
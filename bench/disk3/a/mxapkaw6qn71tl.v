@@ -0,0 +1,7 @@
+]gӬ*|nȡ=y0!av`:"ܚMasBj/>W
+rʋklnu>aNSD:,3l_NEj$
+D3K,zMb7pZB`JW9%*zjom5xyco{Ё%·5'1,Q4f!`x5|{M$y`k|_iz__rf?1<!/O]12+H̍`_hwoJK6fw%
+w!FȚtMGvax|1'#ف~G?{	JFQ'dcEfB`2dod7+Q*{N3|2fX$w>t<;ֱs`EJ}@
+:ңl哮{Vd&MF?Vpɼ=ڵYԈP{$&+;Q)#:@΅I)2!;O*n4PCL`OO#%mUDX,"<[rVgl0GS9Pyv;.
+L["AN76̱V&B홷5	+ng#YϹ.;mDLYvR{N?X1܌1+qCuᶩ^٧[˝W8)o_DK)%%_f"մad,q
+DU)i%|И{FGNaġVQJ8̥.ї>7f-sĠSI0 .~NW-¢3WHG9%I)wY]q\*G_f,ZS8ָBaFsULhÃ&vt&,m;-R?:6̰X1T{NxqRj.?`X6̸L)kYj$`)~F<JѰ3gҨfF=XMch#0@|gJ\F4%|A DbKSJE݇ÄUᣘ?[MwS"g:ŐacBrJ**X\cNr<4;,,6B,*XՁ`&7|ey׈
\ No newline at end of file
@@ -0,0 +1,6 @@
+letmwbwASW숃ʚ*lP-Bޙ^-QyNȶ~(1.h`ʢP>!wcOc#h Fm4?NDC"zva	͒xv;3GvE[cO^jd)} -BK{X-:]n\-W5sFHX!YZJBű-:K?}(2WmӠH?roo^b-fL#dk\}byU+AOav2RhJil@q@XO[<6St]x/# Q|ZCn.@%/Fa!mAQC=\$	0,OcUsw"Rg467u5mV-2aQ:)rĦV}9؂Z^\*HދW3ԋMV&Lh̿FRT[GqM (=Cz+\Ȧώh6H0؈<[2b.::QTcZ}dUhlRfWvap^]A#b׶mA3.D#]L(A$%K߬2@9(z_#0v003-+%s2Ą0EL%qW!sS|UH}HZQҎ,D
+hZQA?ܙg<.g	܆@|Swz'iH /C,-k[mT3ͺwrHSsdkMgZ@<XM5+.T鯶̠?s{Oz8ġ}giA$u^SYytrR֕rd|15epF_:_v-A>o.ks=4wR*?${;@<!ϡ{e2\X0~Q1\1_v&y8Is38tX/לv4o_vΑbBCԥV[|#VΪhLU<VR'䫘j^J:@hY!*MY'춏-UImG\n[ACwRoح]ۡQ1yGbIJ^FҬH2͛5,Y^ZrU`Zΰ-eSJ˽Ig_I/I.Ń<'<C^kĪ
+/T꽸bϙ?ŉg	HC2s݊&#[c?l$gY5⋡.9E)=hcN	f`@h!<jS#Oc&v|~T[3؇w
+!vJ#sMHΉZqd+#5LcۄbTc`j\n9FV$Z"R{FI!GU
+5@Y$ҲSUƝ&3! Oa&G)Lf_wC۸@8yލ:D%v!q,9sm<y?)iSg@w[j9:I/@!v5i$/GB⧪l;JafZ];.|Q*weе
+Q:6A$262.n&ZG>:.~O@
\ No newline at end of file
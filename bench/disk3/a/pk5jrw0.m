@@ -0,0 +1,7 @@
+DIJXLnVGF+V(j,8n %s!|b{vDqP$afB.\UG;-6/V@aU_=ާW"ƫG>1L%9L~s^678 $Xz9 bA@M\#Dռb?䟫Ciz2I%-'x%1ӫv8c'@|yEj_ZI9>"lo-nMNWbSX,{ecXA)Jr"ZdpB({@kXn|,[?td/W3PV_$YmKP*g	J]P]w4mepzPFp9܏u:hYÍsʢOV=_\.SZ݊X9(7\^tyjk/J1H fU3<)ۥE$_pa-Z;X*В$%*ZD^U[[PaA+IcKgIߩ&L	aA&#H,ڇ/Mhh\K"оȉȰɮ@twpO9Df'F bJL?uPMyڱ*5R}7չ-+_c[ޮE"[`I@TA$pRC(\I@:߹p۩]}Yed&j]~]QWD
+F!6͙Vʎ$Mc>c^2:4>-F?_4@7q{AaL,ƦrU ͧ:jXPZTbx,0uvRWO97Y
+Zo{&DZyELyEbdܶR"	skbI`\jLdWLJ8N>OaXQ]KWXN4)dpFZ"9qH,dDj	7NGoCJ7ZĨn%^+gD|Z_e0y%;_vQ`r'Țm'/&ZBx	KGDk
+VV{%N;'p5gЉi_*N٘0ܤċQ=x,rB-\԰B}V1)lmHwЪD`ky>`6R_-*N}1A5ٰ[e2s- )Br>ox!!(aQi*j-ZlSExB|$kh-rsLӍ$?0nM6Op>u ^n{~zQw]eyxN=ӓY6CkH%ԍ'GYd[ف=#G<yҲtX҅0P~~Wcf(SqA}쾵z$*b쳠&ro^車@`s8`\)8^&	b^֯}g$C</unzx0Etk-;)!Pg:q(
+6GV<6QLUbXw?o_VUPbo{G$봴M|$W`\Ó+|t@b|I֎/A:u#YX,%oVzoo905xvjS4KAk;߷(m]A/N?m>yWu5|BAZ`@2'Lx͸ҁ>Rhfe*o8JmFpT
+ZVʓvb7y8]ܴ~R1#~x=XUYv͇	BYQEѭ$fN}'q&cTJ5odfVW|<7k	]gظyjxf7AHqIP6dQzeBNCB~y<kOӣ.$4iCjQf92
+ЉlE(zaLa+vkSSl<Y3Y#Nȗݵ(Kxˮ>
\ No newline at end of file
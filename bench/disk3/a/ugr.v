@@ -0,0 +1,6 @@
+Z*f'?f}@5DQ8ɏΈ?Vi	tUT1pHQ[m^Fu@EAyJ\xGyz/}^`8;/f/Is H3hn6,DWoDT1ݓBFWxvΰ$½*͇#?""\o?I9m{z]h}W;ύ$8V
+G姺YNEܖ1 v罇ُQYA8-E62.^k}|b._Grv6	_s^EO 3p2\Zö2+ݎ(ڶ&K&z+NڒԧCV3B{sB3F7SJڧ
+&o	P$<\]0[ETj"s˒}$J\OkVv@:̵mz"&wQIy"gXe/ff[+)&S?[6M3*[F+aasK9Hg!)u&EJH1uYڶOSd_f#?NT[bm(Uf0xe+QC)AsT%>,az}"`!]a0`,(QN=fϰ'Gj-Q	.*Y6҈v!-O2K0K@󣬻ʥ`h[I=A^vFYȀ4RͶUsڥذ@t DBx||u?~v*ٷ!sE%;rJ拠QV	-pI}2zzD1f.&&'ZIWV舧npG5Ԣٕ/}_t-oddb?0v[/HqKjLo}~e ]i$0
+&Rɪ[%7,BkYyBFЕq1tu'%1!\l
+||C E\Ua}>fa['^3Eh]#	*ԋȗu_j}1,N˄&+#̸v2 Rp{rs_*;,IRRVJoڥM
+?-50Sϲ󯦔-x8Qۃp9}*,ò	YgDDn`	wu8!6DeJ#u)^So\,PM̙AuE[k	D+y}9EHu|h&ah|]tFH)sȫ9StkcŽշ򬕳0s)iN<XD;&Gf:"0l	ĩAl1Q;ʺr?4\/̽QIX%?WHխ=+dG0vf vQ/?:ND(#u%#J
\ No newline at end of file
@@ -0,0 +1,8 @@
+P4';}%u{P3L\=3oC7J~e-r@mԏ80Y&n:8OcM)	Kh复'!9%eCv~.^.Z7S
+LYc"rDƦRXGy*KdVYi=[%rc9r`WNG|.~J1֎[fl\W%@0fBC{<9=#&qbN<k͢ˎ:%p	W1zd̹Ic"N-J"v=߇!p'X"G'	 {3,%"}!O[g	?qfƣ$i.:6)Fr˝1ϜJ.^e9MR)φ{Y9r8:GE(yO&eOM5/CVGHΔ"
+91wtPin&l5M1E[7#Xf(?}gtZy{)K~mɕ'G=Zy\MG>@;CKI6&Pq5uF7nwk`k_]0΂~4ȣxC(Ҥȍ_W:"᫴0Me<fIn3D9ns\(~7*f$|Üx?|a@ENv	]A'OKIfg7&mo݋鎰"sU[j)mLWjR	IN#Pvbh;zMjFw_	Ze_O!z.QUQM1@y,M[(AP:\k7gdK5A8H}>")yA@+N$Ww]޲~x.C8t:c,wSllq\@#"g[ r'틑\A|S3)k?ې62褼nSrn89n
+-g7lC~ym/eeg_n*h^CʨrV-eNe#xJsS{} O\g?Bq}GA5l;3:`eK4>y	zbqTP'f&}@6Ng@# $/+B0}~PbJHi1HDsfn*.YK`½=	ubzצo`8UYg׶ټ|2~Q|^MlQXhR=n8W|X2dI7)SZ}*JeaU-ư{p$}zD'1*~]B?ѩUPr>Y-o;	{px!t	8vWnzdH4#*}-Vɟ7?~[$7DԶsXn+jyg^JɣF^z3LȤ7yJMTS8}PPV}"yuB^;˽\Gl[v/$uIr.+|0js|M!^,5e:l[sTd6&X8nV`j{p4Pz݀le`)( "&1_.B!l>2s,3CN,5{+ϡ,@h--J>I
+$2wq[!"A+)7t^77sa.KSh[Q+9pMXXncXouA)a͟;k0&@%8I+9YĒNϼEJdO7j,#\'60m7UoKR3c:# bw[{H^4w;)%;>sg94W$hJ1fǵu.uL&䑻dkhB{aW7|.~㤨>=~ۀt.˃){543;*9*-aKRసn&(۸n V[`d/bj[6Kym.68gzD8J7R4hFXRg;+ƢSx0nY-7XCuKfIk
+=2`RL_JЫeQSm%ܖ
+&3e/dŪQP8p@E_2R5@b\=d:I"S=]Қ1L,RUUռI;3h!Ww~SҸW;mH^d	>/$gΑ1rKp1}IvSJK!?ucX *<Ɨf~,;V[8H25we2+ܠT>szP^nFeuBIP8O~'jUۧOCBn.5Χ\ٞt(+7྿
+y(<{4qb6Vvq?tK{37N'Gs3I1op9xv$Vd!ݤn6X0wͰ*0^»dD\iFb`S[_N)ϓWbkd؜DՔGoXжX;1EQzX9X"Iͳo~TU-C܂jb]c/,jI{V>QT=\
\ No newline at end of file
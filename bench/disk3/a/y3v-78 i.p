@@ -0,0 +1,17 @@
+
+"OX0NW`Qsb2 .@+~]d0cq-dvQg#wThop4Tё7\WV~:HF7F30܆Ǉi8L˓I.Yݵw"be5&br4*WIg|¥jGǜt㖖]J?*4B#IR@Na	~Xu﹫"~4fG׏k QKw9fDL^2@t8ozl9{ft} A5r'W.
+)WήN扈 `f^֝Q̟Ω$sPRhQ,cl%]Nw#sc6
+恭hKkٍ_0H]GQEuԒdC;xO&~{3:M5s=7vuE@j9/!!D?A#(Y!uccIlO0_Ӂ=<mTxgkr{;cajLd<rT%PAvag	ZHH
+Z`^AKjU3vqR+g		듢˵9Z$yD͸HgkuOH5{Hͫ#6fx<ݱлm6Nxw?zFDMQ2F͉DGp зEsTTX
+q0WuQnx&4ϔ8ΨJO+2sahWAV¾Ɖ̣Cm +U}!$!\,UV
+bFn&>9%jᦦɼf׸r.-g}T̝cJRNCD;EŒ7cRE"sG8{+/FGqsolEU
+ w&+7B8SXIfXB:tn!'(>.X6{
+w䈹`it^/fh*9g!{aE,MXPeTT͈:NR"o0-Mj8Wda!:dtkLuwPs/Hd-D7ٴ'ݎ̛}`	PI̎#'Py\7p[Ӑ):P
+'pQv/_Я1]>@>GfŘ4ipwn_Ī*7(C-JaxTgAIǒ:
+[4{U5u]ZW&t,k'
+LOBȄk$; KeO;L:5(m`ԒFhDhp\pn=u	~aG3֊^`4jzZs^mU{2?\:gim	JQK헓WX'd~CPv0Ip8ϯ
+ue:nJ1١Ѥiny`EM.sL+]6Cc jJgFօ_#b[xۦnC;SnO4Ǩ2<wLͲ6P _ʘ4d_b|l?5!^3` G~s(5vVGJ-hMx=纄3	0Ws|:s3q<jxfq3r~q(qQ?bD^wN<PTEb=aaH̬fG826WvG,Ȱeߪ-ыo[|BU<N iG6BVXB/<Ga%m@펥苲3pBN;=lK6bQgo&d22zRF_^?$ͦulnstwe>e.fwĽ!ū_@c'>/_F+nどCw(|SZ&/&ٜ2%ɦ,j"GBh
+ɕyM#hOYRi\<:eIߥ1^_݂ڷ/AKn;$6g2idT4o#JJ FlG)z#Sgk%*F*`HcVٖF%	2S<X̠@~+'=Ղ1㜵D/yކ;\Ώɶҁ^u	y@"ٿu|Vfu8 i,%
+Yo*(+,-=ۅYQ0UUkmJ$[xғY	nzq?U|pIERu}%ǁDCʿ30!;3LS
+"TM2LΝC$Pۚu}AU\
+] 2>sā}=ϚN.
\ No newline at end of file
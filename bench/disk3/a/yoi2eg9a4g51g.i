@@ -0,0 +1,15 @@
+[i?X܎$xi96,g׌hǯ*_S/rbDCC$RcƗi2,	AMf~]Zʡ.U0 ~Ew*跀W(+s]XKX:|t]nCў8w="=H1T4SCmJgL!a!P^|Vt3"zdbylis#|Y*!KLzf+}H^8 RMX|$JMs~0FhlYk(Hf[UJ%S3fz~k&ԑ2Aj5ePτ,5ҫtWvаe7R~X+(t`c$	|u2b~۶~i=5zGTzV#eW/컗2HN[]-ρs@<&JzKv+swИ3z<5_K^*Sю"<^v%h|VWfjt~6kR$]FwޑǮ4q|VmL8n{ÑW@f05A	<R4]p-}Vc+dȄD;ωqg*ɸI$mbζ
+z{5Tp"xEv-Z}DZ`ȿL \q㡒'p$V|*9	*#ʳrTBK0׈A LV8kaŤ.Cc9~L`>?㠑hcVe~M}Z_޻4W"[*uLWݭX'jcu?ܾQwه%ԇ<i=d/Whp0nYH`Amf'{KBZ?O(ZEV2LDmm
+}ڿiε_mqlբ8bGmpw}6%;{aϫ1F^ކ}Ǩ67GI@yV&Hw!~HUp!z濼*vƿo)HBUOG-.Ja0P[x46OZ޸stLټLnH;9c3Ctn)C_}jF5&:8Ly:$za0ʲbixEzkݗefONC,=ָ%\-=g"m/w
+yrk>kP==YO!=Z0/)DL_+7W}]))oզؕ<؛CkASB7u8)%cgg,5h$
+`;
+<(JfhRZtFq4N:M+Lgn4a@'!(]|Kiʴ3k;!s`M\Wd%4]	MVLvum+L.)jYD.q\hHS5PΙ]@Rb;;oHr?wcl֏1aw`<#bSk3o}IG$~3`cf{+\xe](+#RQLOW]Y{]OhO{=)Q)gYb&fџd5uB#RHNrwwwnD!K5`V)^NMV5o)6M
+<w_&>i@+	bKg;6-\a#Ѕ*@⿮lCM>hFrd
+3vP0#oRq54@&[R]'>T_T7(,!7*eİKe?
+o46ͤtlp >'~6hlkW*I
+YЋr!yNEWL6²g~ho2$3٧_,VݳwI(ڂ{O|(]WiBy*,.4bzYhsICC/xjJ;y_#5+Ece06]n0I	|1##zx0zX1./v,j$&CKV Xo38CEd@cOق_ipm.k"MM#sp _,ͷ]+@6`Pc^9C?nC
+/q$6KXfwr'R~Mi.WW3V6/RnzΑ>s뛜E膮DFuć>Opy>ADgiVts:4NM0Xf]
+=G*@ϒ5]e7RZChnIi'!^@}ȁe̍3»XQ?$B1&Z{},#Sl+#O[檼qgzb8Q|#)|VD`ɒ@l^0v)$ShT+	ߋfu⠒aVUS♻+50z-f1aB5'H	uhݲ
+Fn{6.,Lghj#*P.LfJWʖD [8WX6-+;:kʯ'99h{ʿӻ۲>5){AN\LÈkFSG|^|,]!Bohߥ
+㫺sJ{u$KQD7rVFG8;f}xj?(j@@ªޮgKm/	}7F,֝<~=KVy{ Cq(*$WPF8!axJ ?sѱxEMį7]TaL-򶚯!W	^6Iޥ:DnOaAvм%J/O1a@9(m3)4:X|,kNjӧNl,s>fsH|#r"Z
+	8%0,t^*XsAvп669CЪZU8<a-m:m,;.$;hCy߫~5J<󡱠ǎ5E	=lH~_vf5֖~jGy`4BjKȜI:gxv\F-ORdKW-^d2+cNB; Eڤ/ )ǎEh2hˇ:Wa(NI-عHx֥pvz*gdM]@aU6J6rUZҧhV|®WcJ譧Ѯ	:'qgØRȸ٥pf)D^i7ktn{:UFMCN|C@:!,j`-rZ4k>_(\
\ No newline at end of file
@@ -0,0 +1,8 @@
+o[zxIJ\bLsIPG89B1̉b?onD`r,(0_2ͫ*5$w?H̤6Kl/q-E-ʖ#/Yʶa%xAN +\]YL+oiz\ 15+?7h^JK{gz}@z$W2CݍIs3߾$JJM$bxETiMIm^'@;i&lv'uSS\{/bXz}&\PX8v-*I e--ig(r,$ރ3Z0%xu.*.6q	J-,[찒À.>I#R0uHB)b%)\`ȹKWbμ]5<7e Q|紙0hdfɒ83!nq5_W,F7疅By*wf	I9б
+يəsݩNN$Y|l3<vũð>Mr5f:#Nধ_%n[H~IRhqއ?E<bjEʝJeo<~~h ݖ#u,z"'zZId7Twl}8x>PTSӢ:Y.`8tG꺁a8sSIWN,LǢ(R|k5rD3t1S`cj5
+(x.(N`%161̩
+8++RRL) [+ֻ@Fq!M?]Rp3^gS8w9Qr:ɶ-ݺ~cEl+މjM4L"#UcPnm`݆9̶+D&MO]p4Xq
+㞡`#˰V<1AB?0*H_nݖْ)gڌo1/feh2suƠt8&U61Ls)WEv7|6uHwR*"+&*ڼJY#|yf@e>7ZnDs%WXp.1miUxx4JQq
+C]8Nl_5Wqc{J.RxƜ:3kr,e[%q2>I`sY	n5(#9,Y%	d+\V+4ZUIq{5}/UlcB&%R])}sf_8͵#uzg5m89z4@Bf+5V%	tdQcVآr+@
+ (ʊguE`ey?ޥEvĐ	5KmhR,L,9ڥoq3\oE&84VĵUs/0DPRQf~?ބ_KxYw\t'\@pUH0a
+o-ûaB:|궩6[+L5pEF&w@PwUpAvZ	lMߌBY]Z75.LS	tP+x/ϴzr!M6|Q{9*f@OC\zZ[XBfy&My-w57(/Ĕ=-W9wC1e:9.!4P,OcRp:2;`Đ }iQML\ׄ=9QچP曆2LTQD0i*2ΉCrJfk(oz	x	OR+Ԉ'ֻ<Ê"&֕$*n㒊JD;d3/?ؐcs{/j%̵P/$XmC_sm	/2mmJj#^O[a5ū"]\r>wIM\I4rjE.*F>mmh(Y#W>'L	>nq!Ch4(>Ԕ@OmEāfOaR`7NNo?aph.-/dJz\Al_iKʫVTBp< (]u
\ No newline at end of file
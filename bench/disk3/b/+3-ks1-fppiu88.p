@@ -0,0 +1,22 @@
+qsC>j9N>sh8QF)ZFZ`{%Q&0~jD>!D;ԍiȵ^Eq1M'x?+: 
+YWq'#Db TNp&g74!V=A҂hxRcmp9_>֜QB|/]ǞWs:V5ܴ=8U7E>:P oj#vlMU3κ\:8)JN o`#Po'<lJ^;`vrhVʧo"O o>#\;TU'Z-bLKrZ洜Y
+K:CS)@Tf{SeT^c-b榆vc1as/#={8fܹm4GnRİA/>Zpʦ-L7 \K?Ͻi[g`U:~C6ȪQ%H=p[2%F0Icb$bVHг054lC=.&n\#wh󇮡AZtG?O|(o˼X%bUezzߢ9`FwJ=A1D<.aI@_K.;c?Ja*o6]ؽsMWf7].qc:2!
+T.B|#^d꘿訦'H}^iU+h̩C;i&t]``h38,,9d`]48ύAoWBδ3uW}A"gԬq5C!1ن?&Uݪbi;.8elS'0u|~9ע-!Gx[!#|!ǉ;,N	ڵ	d>hIq7ՠ)4Dfi-_[U!Πʨqa:0Jv]Aa&Pkp΢q)Lu/FS
+}kǛD/L2eS/m?X8X߆CF.fbqB'|,o,jb1l@pъx}$!"l(IIϣ΄(Y3dbC}+g;#qgDl_wg9	3ԚEr듇~&7a,!GVz\U3]댃@.sGdvq^}bmq$1ApsNdgֵ~L!㜚z]EnLoIrnUz`Z{uL	t2߾M	Y@l~,cIy8ɫuDuXXF=R&j|R11hmSQ7ĿQ*PcX"oeyܚ,Z(UL }?n<O^UdiG!	})GK"-ٖj}a5ȉFF7ȇCռۚkl 25%x6MVG@~,ԥ=EoF
+!.#䱪B򙱴B?ͨ{7Sef-\pdqRtv֝#e_"%4H>1w׫soZF!ņlxǒyqfKI"+^&/Vs\ϒ
+ƹձ,ڦ
+s]VR`Ywts9sdy0Q`f̝12Weࠝ0_CW|o4Pz)lI3K5F@<C5rCpR*jmH.x!j(";1lS?G_bVe
+vV.KaOe`o?,]gwbXKHBP4fݐ#i5Am{cKPɵ۰rJ`}YPbo
+4@ДTR-V!,ZkKDlJ,;[3@N0A7?K4H*\p#1it8·4HkGZڏBKhbq5
+iS4mѐVsm/en 䝆{h<IP3}]P+I}dlCics{p3.jQׇcM}yt>Q\Bs-DQ-Uf0޾کYAx#SJ1E{Kݷh֘M0t$&՝TJFØiS{U
+ȸGTv4hB$[/0}o٢9Q{
+.WVRbx
+1	Ge`LG$=˵Ja/Ga{ut#}pGrR[R5* ,;@%n/O}	;\u-5QmC^ncQ&q}?vlC(d_U <~
+YԕNE=QkPއ["3JOq6n``Bx:p|}
+UiWS̵urȀ|h	*[Hg9G5384릩?(W%\ACi$5dSP]dF	E*i-Me/4#gN})тqu+~̒M$mS O%5º93尴x#/MEF]Mلp[iv`qbiо|mrwOYȿ.FCzf̹?lj&8ՎT/f0ۮK> 0qea4Ķ01Е;xvY$%Iyڊx;]}:jJKSieYʢkOCBd?⍄I'vڑ,F<zh	vQ]l.F։]a!|	ΛOUT[`nl(Y̲NL=
+]pqݬV!Z'pT$cKȵ`A]ݎWtk~jrɤH80Lwܒ+<bl2'' ".4%"+L̓X y⟟[`Y]ܰ*o&ETʱ6 q&rV!*
+K}5o-NY{`&
+"͆lt(gZNW@`7Rvc.MR<|^88_aM=|]YyҰfz7a;mug`\*`:Jqxm<"A
+CaBq
+Cd@CFE){_=2Jc*-6%g-&t<klgvI!9](L|V5l=ql8ІU]yJ;zsj(HC7FwFBu/6Wwbe7qC(PlW?!UT1l/:߭J<'S"Af;IT>]p'%^QBs	XV"@Y4I:GZwhxGۖ'K{h"d栨i*,D'^k'Y+>$t<(ogfۛΒN
+և_2ҍGZ5Tk_4v1M`	kGc0p8Rl}J7'ىSv2{h)9}X'Wl\vku˸펌جNE<hM:-+`8-wS"tp7b5H,z<ou58_7v^,Y_`.peF3
\ No newline at end of file
@@ -0,0 +1,9 @@
+c{mm½]Lꨬ(qHe5T#?p ίMЧg|71¶Vɝ׉&=Q~=dMDrAL&=ݫʱA	5@Uɛ,<[S?4s \:Pi!*(}8/q0xvE̺E_;1en,RK?÷$1r"۳s2(crjq`Ŵ:I'CF3䝽72gd3D@,E&;yF Wg1̅ϴk`CJdt,"-mUsZʮBJ}|U0>8pO{1cK(ްX&rC>H@WHj(ZXQȌÐJf/O%!Rk}^m<%X߻U?-f6A*
+R`#p$]GA'jz/r]n{Ij۽z#i:2Ra	6vE.0B'	ji̍xnK?ƤbSrԊ?a#٭A<@;hT7	3$X{%:aDހbs(Mx!_c@/3Y})yniH$k}*{[lZ-߃ʥQ9~GnJKkwe<3"1f+W8'ǋ>}[Zp9qa	."0TC!;R>D[ܷK=]g1OܒNzhfEzAqesDyWZDUz|;(xpCfHцt|!#߳x2@Mm]Ya+.9'/ݯH~V9Df*LWFײ!|U-9@2jtk)|eրiۃR/;
+Z`pWaQl˾K¤@;sAr
+"|fd4WuZ4vqgV
+zEH!X,ICݾB\}?&aSy_|+Tۀɮ5?+c޸#0>9!(,}ݛ@eZv(6RqhGkol.g)NoGzpн!hb뾯2? 9R @N7D57ܒLa\_SejI@gKP6V] P媡0	#}apzruJ-j=;vG2$YwynCª]ߔA=PjrcG~#!b>xax3	.ݙ=z |
+0kKJuYUT&y#N*u>h}IK^q"yLa*\3Huw׃~j5x cX&fwu9gT2+Lr5`IXa\
+ϚY=vGxf@)RYEwgB<f	&ѭm2a/#;]eZ0Ó;;ZtTӾG:<9w:䮀]A1]CqJ^oJ6F3Xb+yCJ`R	\C6ziFzހ芰I*]hda۴REKi9X6*tdכSbςW2b6]#Ywoiբ$`XOc4)L
+]J]a]~	MDD&1q`"B5ݣxޟ;
+@yVR-|<m٦822ǝ>VP&\и.mۧ7BI"QGFț%Frnb/!q#C*(,ӻϲ~)HơL/9V-lBR.!4bEO?o?]-Zzo88:s(B?/)<Eb~!طE~V>cJ	f.@e۔M@V]GJ3E|^+1!@xM1xH7E@ؼ/VczfY!Fvz̠Iai
\ No newline at end of file
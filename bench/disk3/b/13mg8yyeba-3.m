@@ -0,0 +1,7 @@
+3Ny1ڼtdJ/0Qa#	fK<DA]ME9!KL~	%AkS:V>[ypb=iwqkO~^^RN)$'8+3T쟑Fϯ6B,*?TSBʢk.3}(TѺ&,(vufdU㉤fD`x!d\K+Lp[v39l&
+_\C_?pg31S:$CwW"j,1/Ko>>N3f "vSKJ!GY4h
+<!.yv}F4<WN^yOH'V	Xdϥ=2h^;đkC#ƔKDHҸ.BXCiB7Yo>MP-C:߇?튀TnIR.G3`8ODuɽOE:۠ϧ7Qg3F#(^rr&lfI<wʿn+<`R n|xѶElHlS'7"^65
+O(C4H2:S?bѶfP)l*/'VAˏ/'\E?T(	g6\.Vkr*-.EO\z=xo "8z0eklHH{8Ho>s`sa|JMδTmaҙߦ2aemw妵l\լ]Ы_HKWI~PvŚ	kȨ={dRiV#f!3UrLzy_Bwa#A|3syІ9So$ш1`-SS5Mx	Nbݕՙ8uoӱ_o_V{;+WBc!=	S{! ӏOe-]:\A5r]*j?Ne:C^hn\Fw1p$[+2Z];_`Rt>dY16z*1֤4d0H);mWd+K(oq"%UP"^_Jv
+(uh|f(s_Q1bEnCGǵ=k>Y'-0)FK͟J+xqs(7d]k̉fj,-~xO+NK2DaUُa(ji<Ҹߓα&Ѓb,' [{!'kHĂB!%8@T	wI!;26wl+;$bMopOO)J2dw40wKM(ƃS]pFi}҈qSbLZ^gQBj&vUe)''Extҙ6bsrrhiw@;&pr;}DF{	bu wϒN.Rd8T֝.
+5lvg_*{| IaKaƧbU\hr,`+λ頊V1~^L3`ftb$Ĵ%?dhӷIq6(VNT iF"b4cD]ܟrZkB+3#`b&4٥ZHIǅŧ)MWalm3B0N3Er&l=VD?wL/,Sk:Un2uUQwO<|c]140}]aq0[Uϖ'T}{?Knq_Ky]H}%%k޳:/,5Ʀ/jR3u5XxG1iwZLtpCsy)>^%@2)-kOY\c-x&J\ݢB3C;.%>֏5Wzsˊ|g3 3S]mK7W0.H.lox2D"o=mp-ߒ5"jqLHRvϽH~񤩵7vV}eSDHn'b8R9,ZUb.B1T,:_Gy`F5d
+;Tv\qˑ]zV.22*y(lsѵk2}׍
\ No newline at end of file
@@ -0,0 +1,5 @@
+h,9ƲU >&\c	UvA'/)F>fHl(E~ȏTrBAܻDHB; 6&wT=lzc~j1ZYpQ2?.a=-@w|5
+$ytp[uKo9),10"',+׈rpNtOb-uPPt٫ߊ8B!Dpz$LB}҆W`{*ͺYi[,:10Q'^h"o0r[HL],m~}PIHµhDtXjE;lС43zAJ uސn:mE2PX7ƥ{oeQ12~ƿ&@]B-W0乃W5ՇB8-xvLaY'T̡SBQgca\|xwːqқ1eC
+G$s@{fC	z{g%p2^yr}!1o{ݼO'ơkVUgTn(4[rj}$W3 K}>c2T|_JuA3		`эfr<S-ÁG+
+Q;Z\ôxʸE6
+Pi 兵2lF!
\ No newline at end of file
@@ -0,0 +1,13 @@
+SDduFykDpQƧǰц#G#ūN$Uv<)^mZNCA]=V_ă(YZXэ$z)-$-XƉm*TY6uxfU+|j¬A2}ZkWA7؍qVq-z||'A10qi_KׯEZ4ckvbZN4
+'v)%quޥ5طGO.Bz_$_xߚ&^@ڮ˲И$єL}Cq+fY1Ic\.@ilU.;SN5
+nofQ?wq	bV^p}~bjg<!#%ȮgZ%y;ȿP^j	x :iH{˭}]\ހ%ȊEy;Z$WPHrwm&L _Eva%:(54Á&qQ7ƔPa.&|:s[ k7WBz-y5{:VςRkȩhĤ0v:Hv*(̠buy'}v+
+Rɧ\:@EmP*CubMZ}ۻ0w#ct"`m-ߌj9,@[hhL.R~@k	%{|W	O?E\*Sȓ.-3=ݾROFtB;"G|g`2:mhSa	"O(?~"N{RpvY{UT"4yAB6lr]Ոxc=9Z֧݅+ެ撻* g8ar[eTRL8_`t)K~piڡ.Me}ml=x&n笞ކ+KVU
+"gFzMg[)8i[ObS<&XWDV	m M!#6VdՈƎ-z(B?5m`b[Xhf,[#lczzkjʥa(O{,X33)wh	IYгRmSHf'MLppu}
+%$!9Kk֊geM뽩qÕ`m9a]9mNK]M}»|5\Wzr|Dh3.T.MR1?r1Uߔ#}&vL1T!?~Q&JP&SHܕSy-/'?Tiuh >5ǯc80Yjn^l0fMI4W#}n0B0rmGU9X[4oxtetB]"M^dȲrݶKǅ	h_G,~*M43}kԮab"	G鯥#B/u<\I,VQK"4G+v
+Uki+PRHˣާT)|cR_c;a_?w5f>W98fѮ^`{!BꈗˏX˗TĀX%EKs"-%;NT!)4PXTL|<Pi2"O}ئHe}'\9H*\79IOU3굞އXηZqjN،3ǗYMnlchS]ysՁz'o"B:Qk´`Kd!|DMzJ0{M]D	omӯ3բ
+ Y8
+yfM1kǊXA0OjyqN'Y6`%ő߄iO
+6,sG^qٝsH폊}wv71il=nMơQ[-kwHh]Űo݂3kb)?71WCǎNZ{ϐ(Fu,v_)b=	ru)^AJz-c9gPZi\X-l_Dq&K=V
+_Ƒ$-UdIpmrn)i0JbuHSrXugr$c	@a0:FGݯwCfOOAvLi+CԪY&{
+6wR
+h]l^o8] hE ʿ;iaR_'˺7.JYNoxs.R-:agj?4|8iAMN82y N1#	Wvcjq/R\oP%pIgV}h4lr|H>D.D6 ㄚ&m-2wJ_qMVYGvKmA{r'H vlM2z-s;-2^9m8\.\FDI$s_YiqN@t^qV.KБLK'E^{Jܸ+A=,%ma('G~,SX]Gbʶ7V&(t.ƃj4)he)83.,Z?U<M1i|sR\>5(|8Swy#k"WV@3+Z9D>Oe"C{)}4K.aJzc䴆$$I꬛3w6=nY*(Xƫa68TA!#$cg.1*نəZ0;pC3cvc'WH}ZK7թM̇`/̜5gÒII<n8'{^M;:?>Z/rZJ׏ܥFziDz{8v­;X,`KjSxsv>KHNtZJVS)(5'5#>+5=7elPD)C}8^xHd rr:$MS&![4}w@ؾBFv0I迏.͗<w5\grDYl%g=gx'5(^ˏ:zfz\:{.amks'2~$	ҎêU@<'+{jjE3zB$"@-muUq&
\ No newline at end of file
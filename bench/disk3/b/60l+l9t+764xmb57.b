@@ -0,0 +1,17 @@
+4Hxq*ZD9d>lR~3@&<Csepo{S=/rs(t5=x!BiV|9XM>	,J,^ӋaJ=w{^GPpq5l<~X\6%D1{4A%F>+Skeׄrw)?j]i\QMhj$,p+qbn@"ܭD	x2&ɛiJguu}K2g/$*Ek_I!:Q,g8'ܜvG_T|`ٖb#jEz{)ObOnu1NKڥ"M}
+Au7s+a[7ΑǁWm8,+pl`yoht}f
+LxķfBy˭-E0S!"Օ1U%"YTgqf{W@m'AHOB{$۞?'æ">(N̽0v(@}!XxV7Y28yk^Iy~醁Wkpy<N_]MTA7;2*%g}Rf<莋=~2Ի70K/n(/tg@q'n̘'-+zO-Am`,.d%S}juD %-[V:q<-Ð*X2.RI/"%kufED+%\&n0Vۮ݃2F]"^MM`c-Vc	9g[`??Ջ4dȆ4D$ğ-1EgpDnSYuheӏ==iF6i`$":wL Jr!;vMo獌YJ@
+49|[Q_Yh/E:z[	6:˿~)_˟'30,Yͼr)}ocmfmww͒S<uR߈k[qq	xrjMvfH}xOIl."!/g(
+w(J&˂'Wzц 佫H[e0~23#NQ{ȋ͞PȋE6DDy66@#a!|8W>t㙀96fS`xo8:ƱS\MJ,lCr{b0D&xU&u-=wpjgoq頷gx	˱bpZ
+xxOF^azhN&>>U(\Kg7/iF*k^ub&PTGw1xG}Ϸb5Í`8x5Xlµ9-XO-AWYi%
+&o}?N{+kJ\ \k=4ݪ7-麠u\nrAgBv>k ġQ)eyUfL\=
+C^^i9dЁ]jJaAZvJj*m?8DvcHʌ$6&vwRSi~]DF#hEȮX}KP{WBB#DA2\V=rb"LϸX6L' 9iz;Mc~).Lj3v26!<.ޝVݠRTmiӬ:@J
++(n`\?PkH#¿>瑎P2զ#@角,-5"F|2\b(~gBBB$θ?˱is)h:C2rs+8IeHi3V`T*ug%1Tpv=m4+/տwkeC䜈zǊpYtT	,$t7b@Bܘ+	t(SpTĢkֶͶMh	rUa"mg[CeiR>|iqQrY!T.Ծ`*ۊ`:)qW\xqMbhj,ʦcqRNap*tXJȊvRAqYؔS>hX,ZI3+$⫃mJnjNsM[4a^(Ҕ<=$*  dRCUK֎5̄y2kp_e&o_0O^,yÀ`\Ҝ?1]7aO&<QIvThߊ7 o@lJ7V˂YF
+.oHs,TV]KaB]TmȽbw_Z^PSMİxu'J<!]JR?ǝxpJvt<:染Xh:;e'Jqn0֘czIp3@
+D(Ty+*isO$H+ؿ2>11hE*kswLv"!<=ӚI͂2A8m2.!0MW/Y3_Ìu6yřH_[tĠ@/&]:'䢦\TuN_[ש5GvI`ˮ֡):{kaIc
+Ut"pi!&ZV3b<>$=K%Zt*Rt
+
+NZ^0سfBq7-	Ms	aĻ8L!UB{z957BYj}.q-4DUX%P(D|jBW0{c#w/($U&(˷A"CGUWad+°YIa}Qϣ Y	tP}ÂkOmp}-3`:HHIZ{H%@Î*(qƖ(EO	dNcO?A@t1<_kav6l̝J(TQ-
+!ſLsZ'RiSP}utѶ)~'q7.~4ʔSBj+~^a874C1JZ4ݜTUf]P/V=J-=+~[Jի2E ~d3mHfnuF]לZT1ΌHq$ٙn='sU.q?q=iT:~]c(b-ǹ&k1hfo#A?	e/Fțtwj[=)v8͞;_`C)RB{	0ieBsIvxeN!ե^''{[FLRs0c6*}z[F`F	Zę&"ml/\,RTSI%h:Ӑ8A8p38V{eٌ #P/
+6]a	8|DNgZ6lA=dsBp
+ƛ
\ No newline at end of file
@@ -0,0 +1,9 @@
+IpCmh1ꊬ(8~KLn-sS{%"eYh^f&\kAzIa2}+2L,εU<:gO_VNtMlm:{SkU35;$nk?!2Rf4kzհ'tx(_5UDP$.`M_"OI~u]墛}~3m/>B6iN#).8fWD%Ϊh?E3ݕf,*l
+yd,fK.}d,K|/L1nWj
+׹lG$Z<>Y拟cwPPshχI|	P8A@slˮl$}&/^KKh#ixMJ	l]WY(}_=p+hd>;M7뼼!fu$Gx³F
+~Up%pE'p
+h7MMâ*(j.Ez8lP>C.D,_$$g"Iyji'F˙'^;vx9Y`TGn;iALo5LP}!f:by/<p"҃PU%Զ+:g2͔P5dSt/G\v1N@[?رYצC>3
+ܿNvZTyhߒVX8%Px^sqHӝUd(7&K_E)'c:I0(śmfR`	%.`pR_ylhqÙױx]\,f/(mis
+gb3ۡlu"RgV7.@'oK"
+)Ў(l{ĺ\m<y7޸#/gqHv/Pls{aKa w>2T7~i3TqoXIqd_Y]/{%Z^ikb_z9f=ĆmڀʓT pp"y>U*7oUkQRx]x6ct53dhsu#rUSvFǏ"W$n5<Np,5To*Y#N{eR	p$SUM5$5F|-!\<Z
+Bf\6Ѧ+edbIf6dXpf"6H5aX :I;:;g$w8xӸnhJ	P%kň<hX7%!"{_
\ No newline at end of file
@@ -0,0 +1,6 @@
+:/LD@Ѓ`uc`lp>uD*@ٶT39QE-[+"}>vHW}y%\>de+9qf}4V֚@A8\	hjYQ#Z.L6n2u& R';,uOX[*hcRVWXщ̓XpOxRǠ0oČzEk/˂{}UIB/,Yo$ǆHC#FzYMX/Ԅ1oD0RfqOX?/vt<1x(Qv&>^YAq7A@0;ayi<(xjh݀+vH~RX4ŲjE+M>@%K,`9=Ϝ\fJ-PئA~d@D-PF.>t
+|4!Gj,c?&Xv2q="_geSŝ<4MifE$T98{r^cбbK?Q/R*NP	5+sL)q`S;9NvhAe7C_,"=OU]@ViSž߹OgGK*-%VE{d}|HOxP`;6&
+"y@7VQgX3͐rlx7q߻r|Hz<R~ݗr~p(:<v;i5X(Asiy(MW =7ju4(US hvVN8zN!:GZa47C񀺙ިWFؚ:۪X:D#3~sjU^$ƹRUvz8wҡnJ/,;L;>_
+ß_mpom 	40${~횵q#Ӯ<='֝ůaW^*ۺKA:KqIt0(gtWbM{Et{$7A:Bo~C|"(r05}QJ5򷇟.w@Q^V3x0J>/
+*Ém&RM8=v<ׁZiհ~g``g^vT`:e;>>GBۑ>~xc8@W#ipF&јb2 \0#HJˊ3	?fj1ڼ1]f}rO)>oGSO!@9ׄ  \7=M߾e.կ#ƑNpԝ1ތD}i=Q1X*AUsYg=TtqX
+Њ@vkzD!bi΄hc<svJ(0V飁KnfYؗD#r[{-7Q2jȹ:Zh7X~qc:O-pf:#MyMڲYx56#=vuiphq(<I8MÝQg	
\ No newline at end of file
@@ -0,0 +1 @@
+14a5fesj4i..kb6elp
\ No newline at end of file
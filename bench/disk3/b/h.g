@@ -0,0 +1,9 @@
+puUe̩si4{m*`m1U1"F*I: 5wyi73zr,řGVhG]bN}L}0(,ύaYpa(D΄gѵj{JB?Q6%ѮiKzC]!e}*8e$d#BV%f;r+˔֡y0
+,;AE6IK x77֞9W3e'xS@yB~.f#Uc=y!C.{|07gkC$א0ݍf_SeuAl4(֢,%JZ|TFZG\!cVA18	078+M|=/"o)MpP
+Fxs@ b&N|qjR,W8޿=e?m:*%bd`ִ48;Ç:p'M]+)@m99g{y
+Pp/&zoU|V}uɥK3̃XRPNľhވ,$A]0śAT)		9|{8&O`u	Zť"A	ߖF'ob]B!7nr^;ӌj=yW{1sچ[DqGmLwъ
+5ޠ%'22DDzxjD<yVLo#n7`Rns6n׌`wGrѧ&VX'<jhgsUjdNEƃn?Ms
+cS|r~g$]ig9}CJQI)'Vf(g>ڒ796vΰYBa1 1/¸ϓED͎ ܀CP%dt[X#gNQN*&߁(0UV,"%mE1^""Kxș8<}{ a~$*B,l4Otj.75SAғhϩ,*7gAX@prח/\hօ9(7鯰^1p}ö53ar,](0*e%9O1tݮN^y>ESI)?Cz Ȕ,H$Y\XFڣ,>OKRިi`F^bj6\	IiPԝk#vџ!akZhS.MROV1IoBq)Z
+	:`-BߍkZ
+#UbQU~aQn@R-fS#Es9ElL4u1mwyIdͰ1dgtzc'QoA^:䧗2XC>}YP`s@>_(by26S&'T5!.Z's[ P-u"T}I>}_Ǻд&C2&P)5VTpHeݸvbo|-86/@5=OwФY@cqTj.sNf{h˫0-Sl=eۭTW{ru2FLy:Y"U a6b1F1Wf01Xoh(:0|;eJk6١I(.M);m9
+t'jqr%v(x;qxZ?!`IR|)%1F=I)kJm(4_Zhs~cGYh^:$:К+bW -I?(j#Ԟ[6{|j9΢OH/D}EW|2u@eV*ɠ[$ܾovSv|zN$$;]jm|5dUW1ȈN/]t;82LBW໩mC#:z`4Y]AqހɊ+ܳkD{Ƥ#Abxќ*ٺ*_jMz:s0MojqU#ĮΥ
\ No newline at end of file
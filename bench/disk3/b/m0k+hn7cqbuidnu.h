@@ -0,0 +1,15 @@
+Z܏f}ywa;(<s탤Z=dԄA70jpwRe'O*p+Vp%RM,''8w&.{S3GՅh/pBh&m3⌺e88{ʖqEfw[ю}A-O#iTmY(1թ:^gKł̵Up5)mG(Aa].rdIg9-"X{ؐOs{Y?b*Z`o+@Eqyuze$uc>K.Y!@DWɈL+4)Eݵ)fx;a3͹
+Kj<7	H_+&A<E#s~:ߢ`gcAl$BrSdV#aao8|DPH@5v	iTFՑAPZ:}Ol4\Z*XPJrhwgTqnA)-ZlY4y&7K2+ܘ"dceֲ[,v?hMLb"cLGS&'Ɗ_VOs	e3{*-ga<	wt$~PbUIUgkl	!mnXŗD,ȏp$ʘ
+53ik^W5qB?Zz^!A$Rf#s4Y[Wʧg7OCЏ5ϑuc$44u&Zv<db16~V<xYM\>DB_J}rjjuF~(6U;cIq$Pw"# uj;}$C駧ŗ2哇iIVO#LcQ[pW8}?kZWyO=1E[h^bN-vj>KT)58ooYBp<'j.FxUyvw}m9)c=TOYD-%gxkRTEMr~ă]#r\Hya`qVaytgピ)#"M0S`Z@6J&eΟIgY
+d|i1Fm=<2%ǌ܃F<oVأ0RѪLFR]7e%D isOg*KyR.ɕBfPSbD4H:az$*(8|Xse	snw8TxMrP܋F^z󉌌|)R1%d1#:o3-{8AmBY33$*16\)[irUt v|ler4㦡_n͟3	zz
+DȇP7Y蕞UgQxҍȔGZ؈@Gl̼
+T)>Jl
+ݭ6 =Ǘ84ҍYUnl Y~5Av@aYbU-*7Z1f+QiPC(m뢕\xAw=Q5)4*ɿ*a|#+Ιt+>?ڧcgߕT^+7+RuϮi94Yr7yL&Q-2曨ka؏kolW\x@tv׆벅i"`gTjAo-AĿre%@NiU-9	C}tX9-ib25]*sBw@Rtk$#98/kw)@8LA,q+ln,9Ӊtr$4иRs)˔@0mk2*Fw`L@~Y9v(v|eX}(?|6pW蕺M&0l[]59z
++*_P	z:`</D8H!R3A+fUAѠ-o]GV0ԥ{MaCӌ8~d@՛g{v8d\8t(U}v߂ٷYOU\VDƽ^-:8!G%koቡNtHpqc_㑏c⊚4u*l6XSHtk,H*s^%re?C9L:4u,T,>\Gp+kmL.¨ֆv3#R|++dmi7&H{rRP=jq4v9Пl}.hPSTuL\|#>7}).8KdL>&s<\,s/$XJ|hGg$2PS鏄ex33gD1s/O/vԺk1"@2G@i'q'CKȖp[6/W{4ëJf,G6BdZ;oG#bR8_e{Gu}iL*4mN;:F.s`I^lE.4yc/(A ybX{K?7nXeZѳP7V]̡c&6)8L/7z
+ap'#s~fLG
+ \'o-9\iyy;x,s8TPI #E-0Sb5<	PHp+vs??b92q]D+JVI`BEndb>Z'hK'M֢SgC0pكqT/9Wa.SduQj3ؓ;ISϳ+8u%)
+سW2XUs(&:`9$+Z'~ێ	x7*,q	jʖƑq~^U.6d}+\S9@
+GnSs)cuﱐ'Fbd|oLH}@
+_|L-H+C	AP'#R9	yKwD-h	j\Tr4zK8RgH՘T&!n%@ƮzCݠ~͝GyO"Dp̠u^[eizh>_>Vܺ\R:!\gTև9a}e0')d<JeiNV_+	UKF 3*Eu9q
+S&TqrpCʇz{k~y<Rf7_<50ySb=AG~Ǟ&6wV>IͻՃՁECk=~9r~ōz=$4wVtVT,S	c):CZ7(ľΪO^cFI1KL!8۽ڄDjE\`DrS}
+6P]fWuFSi	B	
\ No newline at end of file
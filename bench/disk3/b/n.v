@@ -0,0 +1,6 @@
+|u&@tj:4eTB,`萠Q]"z%PuOԩʯA55hn_SIȦ4]4rQ{0\/4 g}@{eedaU8;]w1YtXP$)F˺h"Gsô\sc>M_ ?y*L#K\%,VĪS
+!.`:0R|[tP:Zgt8 P?ڧe,=6͡Ӂ|7X(>S{
+Nd|c8
+bo7牿"v>\8{Xؗ'Tͫkh
+H˭FF$hmًAމS7F~L8V6iENw=B;/~|>_\Hdj6@
+ffZF5>m
\ No newline at end of file
@@ -0,0 +1 @@
+lB'_]Z~4|V`]3MYB|5ϤW0KYvW`
\ No newline at end of file
@@ -0,0 +1 @@
+reZX)iЇ^)dYyPƁo/>H;ĞSڮef VMq{JyQk}y/<6$dYF/%Lvn
\ No newline at end of file
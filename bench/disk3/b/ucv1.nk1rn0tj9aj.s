@@ -0,0 +1,13 @@
+vX`u9:2t
+2	k}
+}X_bʣNTUšw-[Y4XآG|=PЪUV?x?ar;T>˸f7~Vsd(AԀ:CFlio._'D#L,F[BT+#^Le+zَ90Q|\{;oCHY]?5S"]vk>GپzVe5<V1H؏uq{47UvRcw2k(E#8Ug7.nVa{'P0OV$
+8RN<*mipPЯ4v/ViDI!lx,{ڄ=Jwl=ۘNg܀0Zz@L8m\1j`@c'+ёjpr ~+hC7+}`ߛ>u9TXENY,Ty]ZΣzi,V3_?w3,zEceIҀ8}L9#s5!N(OAvJj/x^SjڡL3ڹ%`7C3/Y|@AwXMvunx|&q0<{)/i*0])9)ػ,T-Q/FSʔK?fY##֕r\CӧV6NWL
+T8)O	r P Jvٿ{@
+	ҙ].@+v
+XK~b4p,'⯣zBR7AV
+"es9I,s-(aqK`?.ne!2'TUKvQ7;lxAO)FXď}?|3BΜJ̦r6U(m6i|1ss:MX?FzXŴ3#ɀĸܡ(H&)M	6|X \eR>@\Qge&D?)'QsY|2?Sʹ<kԜQUĬ5<944XU/檤VyIi͕DX><u=vd9dܥdjbcx6&Mgqj3T\"6zA:!
+eƫ-(Ü}
+;&FA2EI,#ލn/ZXiAg'(jT0dR<չӓg.UKj3}lFo#4#za"^G\ogz_ze:7qjutuz0
+@6Q}H"ƖPиk\mΙ@{>~KUwm8ixH.~ ֳ6nMaW5kcAЖ)(+1&9kCڙ+8q=rc뀟zXQ=%NhsޜB'Q2[V8u|2֝m={B4g"spaa$.vXs$NǼ@sg(2c;^9SwE`dY)&ւ/?;q8l?ro'q̙qӉuǴ}>]7M߯ukbRS.yJ~A/5}QsVڪ獳#)y덴fxmj,uX5,ް'X"*`ަrs'+!vpGvTG{&^J,ЋazA8qNRx>'DWciU8^JXz&rۈÔ6zǤ_|uS3'OO[c ?9ƨiv֮.?Z<X$%_Nb:֊ǳ/jM^aBHML幉3_z<:_uPon/#`X.юeBvl 讪 /e1ZNƵ\Mv<e(KPoQ4Qqhsܩѧӵ!i_Kq5)B|,Ih,-b&wō/otd}/ŌEaik<c@6f.(O|ZY|T%q%D%j._ttSf(_7%td[V;8qܵu)NNtp&Ҕ}~_r
+b}EbŌh.|m=O,{Obݷ>['(X,Ek
+^zl#&ȢO󶰈f0%dQ;G.G0`EƮ=ɮ?3{~(`<*5Lbi$- CQxȳJ:fQD}:}ZH9k4m:wV6f|h/ĊKHW3ѕ#Ȏ|F{][y58|8|5[ ;<x8`iIʎZNE"lbx.vd8fƭs=2y=M+XYt7$ƈH2!6PSeo77nWX^
\ No newline at end of file
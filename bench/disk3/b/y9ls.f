@@ -0,0 +1,11 @@
+*,Iwo#\1T1+u><9/lsݔYUD	?<j1@bvGț^&btzHM)2_{7Q~i~΁V@M8wYr"7j'9(Ey"ٺ[^[vsTA'It_.o^w}-j0u8Z^LvMR:sQ\G#+<ДB!W.qVrb^փ#4{C)L2T]v߻xG[{0mvAn߈<jxxk+Af%zTP'~?[IxoCHSui82<{orhCkE;Bޘ_q]
+@]
+b$8mkXOA+3zCIŠmvũ_qlS-7(
+r&(N/eu9w&j۠ěQ,e+dp3,L՟];(RkHW?!UJɧ[eF~?)/^BP_$iOƝ?/(EOoMQXn㑧RK4iqt}!j񘒅'[-unJ	G#*(aӶq6IE*Z9yٜ#dvijZYbe8	^rY<Ȣ	ݝFsgZ\Xg1rٜ[q	O;Q\p*Uw-V[
+JXc|jc~"[	zS>3̡sPJ1žG;mouI>sgH/x%y#	9wNSEv3fXz',ǯrlTSZ'=99`-\%40C_Cjn
+axt FIIܥ}HܲJA4m/XC/:po@7_%Y^=0o	2>;]cg@EwelF33MAQ٧Uehgr燅8bS`_XO:d,1\?1s$;QRY5]%;BN` 9̕ѤYqt6רc#Bi<͠(&EV-ۣI\[+(|1MՀc5C^$M-S#+IMo \mJ{v%sc=xV::<.pܺm_kdF^j0`q =NL;7ݥB w,tkPcH@ߚ2&V77Yǥ́,+&$y^V5ΟS'U!A|ZF*\ю&l-geT՗Iʽ[cΑx6ȕad}.QvP`g%)!`*bu#AEݙl}HД=@]eIg=Rt<?+:iGd[Zu$D㢇]Бs-s^Wโ}r]XXhDxH~rlIi/c|T>SR>'LFQqp4ymF6=QdrMeİ8!/`⥠A+LV1~VyPv7
+;;_);DHO}@#7UXGڎcqD ^}.,Gs
+By)ꐺktpHr"6i7Hky7񽘋Ej@!0EQA]iHBsS?-0)|e*_pdVYv23k{#Ƕ&H^`@\V4klԞvOY^=i(SfGbP%Z;!DSn2*9wOCN8tqIk*Z$UIEI&a(.&ꈽ5Hy%dОrPyrLb$o܋ɂ꺗"QFNt`'SYLզp|sO}2bOOJ|D_twhr
+(0+';|`]VRfYWr>^;ཙPo#J^ڟKtQBrP&[#˲JEC`(;Lz.\iqGv٠['ng\2fTa,;8FN/=5LͼYE%<]T4pX݃+=T3@	GS;'iIq}^D8k/~/y}&ooO_9<3=WV?g(K;`T>mٸ1sKLL4Oa44rFV%#v!SA7;9IW9cD^ABt\q	E`%e)_qEV!2uΡ
+! >N͗F7@umR	M ]ōFF'BťoyC-wA8a$1.PK#}0ΰX[lc5ފ^Ss.~#`!JD:Eu$נoW =\nF}-xnRZ|82ؒl#5p
+m2W*[lQ4)]TqjI@t<NWwԔEQ=zV~R_`k\2M2Upx4cC8^9Oh#~osղ;meA*G3۹
\ No newline at end of file
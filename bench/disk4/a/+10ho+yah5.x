@@ -0,0 +1,18 @@
+0pڠ4\H?䲢؏Kҹ)kF=l]STGwf6I~=D4wel@#e2|?X#n9n]滐H f6T 5EP:"HzHo
+Zl)XkYVg0OV|Kǹ&L+,_D4ѿwjFsXL=}}4ǭ4G@m.JbC?FzhhǤLj4`wsY/&_'HHS_@ljʓ}1f8Ao{xԪwa!!
+]YҦ*=/H0+~{5xC-*d:X&^0I5Z֮oi":ITc%PN{'=(w
+Ojs <6<dg,{#|t %٩cOtM}JG %o6".ݙo}I!A06ړ쎚OjIjއo-qfcٽTc4Emmt7!2TLRVlMZ
+QxVZ}f"vʰq&bN90w'?1	34C]7
+("91ĄFolǉH\T7uD8Hf0h0=j}PKNaC{*
+2vR~l
+V6w~R\t//wf8$)KWkf&(37ћ dSw!C|Ңv4&\}2qY
+}v<qiτ`>۞yTVLf'7<.T靃rUu?&Lۉ[-H8RFY1,llj'aP~0o+7N^	Go}L<Ƣ2kS(zZE*laVቹ.އX<?".=N	#L@:CEa`2Pg@3x|کK	8D_xAcۻ8F8ZuU=6&y)+)G:
+B88~\A!>Oْ)!i^S؟3Xh w[%j9jxJYk#^6m9@xjXdEYo%DۉoV502쮚1fu+5v71+C2cc{_R~js"8<gh/;ODeT_wFJP35Ӱ0u8߇5Vh*VR$X
+۟2U	w^tI\rvdML:<Dҟ7%Q5}/[A57yDcqSl|-O<S.n:x=FM`H
+d:lmFh,=$`&Cج1Q-]>UVD:ϾMQ{%aB(pB={'
+݀s\cGw%YUB@{](zX{/Һf@?e_z%)hڂ*: ڶoTh^
+Ռ+qUtj,%3rDm<. l"*E|FCjw!i7Rvų-Ӫ/mJG؋)D`?R½O\'Hb-_qwkcQ`9LxNcAPc*Q7*Եa(4McgH&Ԅu]k.rЀwCKEתVk廯hP껎C鱩cbb^#g}Cl1uCIȢ+rʔ-};F,3͔ky(l&=>S{utVݙgEh̬yh\YI%〺f.[gQ<@3MqgO?`_3PR܇Mj&y_<F~w}ڕ/l+tOٞ,0P5dq_TJ9\͆r;mEft08$\$2Gj.8x&4<&oGi؛X+ )+i|KM'dJ<t2ve
+& ~wqd&ΒuVN^%gmF?\l@Ԛ/$Pc7
+_
+0}!ag/-0O%e7mGLjJk˗[wW|4	>/V3KȤ>s1xBa>IY^P-)85`V\#Q:EX8}R[en9'4ZnSai5dU޷/|׀nhv>frs5<SϝLZfP.:?+Wakm/}y 9o}Yr
+S*qnlnܱfYа$5wHy/'ο4IXqxw.ҤW0𦾕FNUlODXk,?f,NmzHI<@E1<κcLD>jS]m"0tD\B1nl:_ԳkPdm4F]uGd9tY_(rX+t?H>Eppts=s8D[wpkP*7אMCIq\kٓ=
\ No newline at end of file
@@ -0,0 +1,5 @@
+X}ޞ^a90J*^xoP8H@aPTuphLp׀~\0WdF:&Tmض	vZ%S`.	ҨtĐ-i)hHr	ţ 0g/2>&iRfS3pZ5j"1i4b@GA-teb5@[|
+ŀAS0G_[΢ɓ0m?־ .2֗#nt<w	5:yRw]om}_stm"w9ßPMw/9#Ɖ-ᄄ,~_:hh02pb/|,y:8`dR~Ig	sm^` hoX܉ٺ?&mAZge2йAfڕ1i.]KKÒoSo
+C!*:~
+08J]mu>9͈_vUD!}.u9#%Z"6eF=Id*NEK	Bif?)pk[Dc`g&yֲ.׀W.֪q+s@C G*?^%g^w됿CBHXQoCelnF@,w=},r0fBcW$PL]%	2g}"SbCn!oADГcJw-w^B6>w^&t$G*})-<Aŕ &[ۘS"SS̀?enef`+bzOgsI>HhC%l0=lVj]ʼƜX'9PXYk(9$'Dv?$zHCw˧WEz@_--\շ%ć	Xgб&1$;û2ݳvj>q
+K\rtKMե6jԨ}S*SSȑ/45]rB7Х<Gu`höflOoHKM"\BT[^^rx.LߦYV&ՏVvt/&MYvH:|y;ٜ|rdq+lp'4<򩮿jzћq<4V~)Qy2p)sHDX$	*0y(>a8R0SϷg'`nLU3$yI񐤴G2F)vaAb
\ No newline at end of file
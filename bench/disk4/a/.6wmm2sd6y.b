@@ -0,0 +1,16 @@
+}#faU%le,ۗ"NDMר_؍	vތʶY>C(濔M.ɨV69ϻDB9UI(H~A9!]~S'SEkPZzԟUY'~OxѵXhN'h$_۽EpGXV,EuxE
+>pkUˇ_UE&7НA~9wX0Y7lg?<gޚwa&K蠹O7b-l<V&Fź:9jY6T}KLhDݯ)Da\gGst^ȶGK5@j1CU%eȏnx5ae袔voҤFR]'6bS3Zk8Rmq#R<	Fo仗H-\RkA1Kٖ9^=˾0-QkB>k?p
+4yDﺄcBc+E:~WĭnN7ĹvH:օn(gTba*{}kH=V3|ҟ=͙8C{@e/7VH'B^\}I~uҟFz7?[3MÎ+7p!OP(
+ya	ipv@["'S*`iOyQ)Jڳ@ĻiQLV-w*ұ0v7ggk±tjAdh/Z߀17hщb,13F(ZHt(2yѲ
+$EcG^.ODwEK˘zvcs*$$b97jEzP#Le<Zug"`Mle௪DIoۮFV08@e	 ߸T=mw_EWhO[}"ּMlo>iZΏ^n$Li-_roHr?}useG`(n7Ґcgy_zzLx@]?=/dQ錚nUNIS?ˊy<5723Ѵ\1ya_BGW`lpτ8|btpwBMZ{Y
+=G](>+Dul&?)+Yjzv-Ih~0eYbJM_uaaRH&YnS8mWQbC3['V67Rg8y}ModE"l~-?plU0
+ *s'>!^I$dS9i:%TKeR3|6 uTK}Ñer#l9~;X,vihmU'=h+dĐ?MKqoL4o0OzmOͥ@!\5ˉ+Olr?=GrhH~8XJ6
+1616ԁRahC&iDc'asףFEOf#,U5dOubg)vgzr[>8񛈢2EK!g+*٭ 1R_k8)֋eV6`Rǈq!~<'r7WQ:|P+v=é[A	1MUHF
+!EӡKOD'n39㒌6<[!m>%/*s'R֜h5OPoXL'n\yGNcZ)ǹ;MEwgg<.\p-FX1)Y>R͗HÄo4/qVpJ5UK@R̯9TnejܿwSa-VM+|ǇN{bEMxvxYC^d؊||MC6}-[4|#sy#UKXiKKT"l(Ht(B	®@el2UaҷS	"8gmc{?πIB\|ԱR~`{a.XW!D";5ʠLz;ÖSD_%7,KDA&A>%X7~/Ű[9/&κV_"mk?-^7#aN0bӥUwcG<>Lvzl:?ye"̯
+Bf0J0	S2U?/lDJ*Blh%9\M'wcDEr96wxR,0av2(r^HgqPru"iig._ԳR؝+05k-31\:S8pjٖ'!Fhd@q: &àX2({}.20sF3i|Ǎj^P@ /V rL{+kaKbqn%AD9zϋ\
+L{b88!_h925֌hMϟ5O`4]g$V%95=&)\7~~p U\T["7f~ }'^)|'Ҥ}B]ưA'=!%yB
+d˨*	Dt}. 7}Y1n1d+Dțݛ&
+J߬L>[..#~#l߹&94Fh8/S)#!gA8ÔaLxeOub@SEpT)[-Y/3f~2TDJ-HB#YV`98SM ܹ3SG{}Y	Ġy/03b	7d[)NkKZ1m5ތI
+wRG>)}RN_8پZ1le/V}:QݍII|XIbU=пk~14CD+5u\R҉\,s4CCJczo5pTM.$׋y/mf΁q6@N`~Tlj:~X$j_s`v1kj鼹$ȢdEr#Gq'K\W☑[?eJ 2:vnpf]3]<*3V[Ut/;b>+ g]S͝4	=VCml6+H*Ts{ksP3EͱxYUnCG{+~0B|@Ru
+Q7#"Մ4GzZ#6kFq}AԫhDhQu-l-Jf)g=qaN:֘#߽ZsGoXiIU#`A`ڽ%<'wT!@-%;:f` _c
+V\eJ/=W؈[XV_F<-ߕӱ*C1e[SkEϕ^'SyQ[ώ{%ЈgK$pxX'ia|!HM=a7&UlU{X+FL֟.H`0t#{%;|L%=)n[Lae)h[,6һ5C뀆@!1RT[9Zhr2#8/4Կ-ަCijK{y^6U)\ErV|~Tp7dJ(
\ No newline at end of file
@@ -0,0 +1 @@
+au
\ No newline at end of file
@@ -0,0 +1,14 @@
+"9 8~Hy9"{V5p.MsM|Z̡ʨ^B(Wo)ϼe@?$ZrRWU~y"gDaմ>1hvu7xs$DWDȺQ>xb?'py	
+!HU&:Ɓ`XbzμBUį0~|G_
+o<<*|{	fIM+JkNЗ fޭS3L̨v͌;">!}$*Vw|,;Kk\@~s<j1Yz]7]I2PXB+w/WQ︌#HiL`~e)mѵJS47̒-[)RpVZfxtVcSthNyӈ7hI:n﨨}O=&α'*o20[Ұo3,u!kupdv"?K&G$&:鲸Scpxs64$A^ϫ|	|n;f[*jȁR]d{8aZ~L%LJh
+Wvu<G/qRc	\ҧ=Kzۣx::7֙|T{ⱨZ[gfN9(XJm Ա3
+8S"SMܫ]9/@vcx2\*PDi$"(1Of$lyZj6!Le `?SK#9Zsܮ$zF}tg&Esh2%ugJ̬ǵ=[꾿T=n~B5ПvS͝/"K=hXsV#	L8@ЃA7q'm%q~'9BhF5JGUSv'O^1"7~S`dBkd[Rq]
+fkԪCSzX*oiٺ/:Ք̯9kpؾrw@sS%mb=̟gɛv! 3jH-6߀"lLMane눅L	qX#p]o%τ7i&E*G\w_abv\4wޕg433񊞺oڥl2xxAz:.{0*]8{(iPﰹ]>m+pM5Qmb3YLR@igZ[܎u-BOͲ->R,(食~kBEV^BA}qib+P+.:4Qn.n<gUb&͓W\C:Ҭ)Gwg-sU	6ք;N4"uqਊuusQ$<%yܬO؆8jo#THcXt	Dp*0VO%\7|D$wLb#.f	\jyYj8L&zmD#4iDXwU[=J	ӊ*9K\.믑a:I5Q35r<f-Y3vD;44h",qz{|jΑt#$@{5_)+	?6Fa<*Gb$=LU|[+¼o^kRl4vDhY(0:ٹR$GzڝH6e梶OMO݌1sFIY5X̧KL{F_U<b:ntl㚭Y#{y$/|Qhu&zc&Bo0WO9 dWh]訧nd	=k[/VzI#{nk#P]7_8cȽ,ݬ_34B0 eqI#2(?؛~JE*(|E~ң.z/j(P^x#F7D22#91.S
+.'8in+H*mnI<FC%d*2#28oBF&f޶Xay'מI3,_#9JxHS2D<d6pb<:bB0q-Eu1p-{3FBk6돀]!:#IA&eyŔ:fFȅ={&alM24g$@fy(X\`g-neA?ᙑ6H8;P۱Կi,_CYn盳ܸOءݭ>^Uj*3ke Vt"40BE)Q#v Qfזb|:lcs
+ӽK2M.Oo"K=H4B
+Ep(Z-$Wrw㴋HuI?D|̢$.h=!O/j_LKv
+jaǁ1dFϏ2?%dVZȷJbfl܀~wDm\wxKy$|y3¤ 2=!	Z6BgXOL6d1V5%.FX-Uۉsg#;Fa
+uFsrqV1`	C=EIw%oDZu e:?*2V͋ƻ>:s*A~':sG_oVP`	[u{FeʼGYZU%yS-bOI:Œ}TF!rDw#]$]'S2	ƉT{6<OYy%%R
+1A}@+)uMrz9^?Cn+PT_>/zq@~^&QBMOKz;Uq"])d8B?Ax"\gKD0%]{R>0m~+W9f_yn>m |WL6}AE	e{̧6\+{4L17O8F//]eMwyh,tۘHsyF1̄ȅP L}Eme&#o"NB`+IէӜMnςu?JiQ?ڹ5#	?q3h!IgV}IOkIb=n6.T{v]w3.fP|N+hG(KF'y4/\}rt9k]>5fԈt.۪)wM
+>\r<DM-1h3>Eħ[*bm1tn!s\:ꯎ1AoWU
+SGϹ)_H}WR	a{l
\ No newline at end of file
@@ -0,0 +1,5 @@
+O;tp?m#Q{rm=h8ڨhogN.AAtA!5v䣛)^'Ga>zW7״%Ƹd'?T魁PB~2WxEUH}]Nu&\VHuȀ1~Q
+Vp[8R`4쮤4n5TX%jkE[)lmx˰!IDt]ƚt$db%ڂRVaK0nbεiI-2.L)^Nt)~
+`FOQ۲o'	%R閯19z	[ZswϚUaG	$HeJOrRą7>g/#hGݱ8CɷM~T/>:)3e#O]dc 
+W9ےIs_?l\
+S~7v
\ No newline at end of file
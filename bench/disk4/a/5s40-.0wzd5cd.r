@@ -0,0 +1,6 @@
+Qoˢjr})JۻFP	bLjoeF~Ν񂈠cEp=syPC۴d`&2>	7n''SX!'ZOi<s>	eLfD|9w׆I	ӟpД6h8	$}CH1aI0)eV8(ފtpKgE|M"k'aEOst_*k٥6Zv"2mpT,`[:&O9E}.vD@^2^QR};+_:&FSCF1d> 7K<xtY\̼M^FH2!*g	&5Êlʒ3OuAX4=xx@,2
+\:&jg?=ݻk^DAWNP(\7]-; QܜWن!I~,=SƗD6|9dx/|[ʕPNKo(~_vvn]NxT'A&&>@uaDim5=C vS*E_m9ofd(4WicGpiHwa<D(aj3d:=qŢ7*ȌRz=͢_T2梢[mHo[
+bR"j!2"#ljnWPn3V:ÞVkz뗞dlZ}Yye?͕BnO@jK7q%l"||~`TpyKS~[𺞫wi3J	D+Hyԡ0.mj[vrPC][*,{'Wl5#:ـD/f6bmYyu5ì"Vƛ.l%h7T5ۆ%;[
+B3W@p	"DOP+~xE/Zf4E[+h/E",g%wbڅkin8xm2*JC[5I,CaS(C%j6>O~ŞcmR{6Mssu	EDEr&F-L.^6wc.m)NKxmfs,D9
+G(xّrd
+ %<DcN9U"{&d/Cuk;LGv7^7hw}x<_)?+؈(52}31a|M`3/fyТM=.TI*z"A0@iEGQrx"lNR䝈jC\	ɽolg/Ň3%SԿZjVjض0bS98aTW\F$EeUځM$0dXӤ>Y溹b4lFlśA<Ouƣ3QjKNbUǒyHM8r8AlO2̱k6ǻ=wPt['z`ͨ;R0*ɼ/0YG 1{Β>kvH9dF-[.R9J ܯTlEar)9!;,/蘑c)lZG$y&WVP7q<|7^$X<۲b05K>ūq~OC},>8O+>9bxI֔ֻgqމ4oW1Py,m;קbKٮN?Y!p ,(pى9wn!D׀eƪdm	0J`loBadu+G+i\*Xr涏g-OLtW3`Rz5"e+88؜}ӥ%4?c]mGOK*5^Ӆ!TO(F=_'z8;}$ں5D4Ex7ID\x	զ߉5ReI21kL둻ƫT|/F$~[C9&HDυ=땍cfXXEP9%268_!Sc
\ No newline at end of file
@@ -0,0 +1,11 @@
+}f,9
+4!Ag[a!gu*e`Uot*&30kNR˘2g-k企EݺڵHa`gi8%( }zWr8xqq4ekW%/aRq##Jk"6BWs.
+XjP?r2}/ꖒkT/ᴟ{A=KVI
+NhsC9ySs;#έTu3(p9TRv # ;/V.K`+W\<s;pll ejY~AgQIp8?BNL?:W%B%E˿!%(Uj`T׬K9V" e#glni$f/PZQ$?A>c@*D7hŀ-:cO(ewq:R	6٬?TJTSs6r>hzPlEc0s(}+Kя)݂JjY[hQb7ggm
+9d$7^
+aךkP8~'43it 3sTDcJOTR%R	;)ʳR{G>˿|)1]Ҁ-a^( bb2NaQ*|6-[%R|7Fq	}XneVcu|7f!VyȯE\-H}k]oaJҭ%Y5/!xҟjbSrgz5r<t:gMf[*f2JOu-lӿbJΚ엥`56x^YE{u 'Ra&OuvѦJVYT7l=|,*!o8x{I3{	mruW:p>E|HNv+"[?rm΍@q:vL\-_y<R8 
+M`fk9]{H/;81D qG4N}ʇcjcȷb5VBccf{O\CEq9vLq=/cnAi[aTMӦ8!]+~
+3zRHW=C(&LŴh6\FyaͶs
+;cFi>?	>l~3^Gۖ[a˘#loB,s0kib9g)24R.1눷'Xփr-P,[oTQVN.PےM6qp@^M2
+ԨPMR{H*JFXeTC0~E,_胝.u<򩟓DO.M7oN%Ɨ`\wOqE%>\@3Vk:vY(#Xdzsra$//Ӧ2ӓp5J0׳usTQsY{
+$sfSIeQVN3:Л2\v)w@:vz$JY2ä#4eސ#I`SĦ@?.H>F*\.C*g4`{Rq#A뗇9iY'S9'w̑uxv_7p,SFnFEa,Am}*)<LG^[gy)y9N7z> l7UDE*񓷻JSNiJOu]OP9+@a%Sm[z=:_ݚͰ0J6c9̒YT+\+li
\ No newline at end of file
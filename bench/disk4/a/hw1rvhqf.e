@@ -0,0 +1,3 @@
+K6I(6=m~cDSܯf(_~E+euG#|w|BsZ]\ v:5wM)E#ukF;ՐHgɣWU!wM>yu4ƶ0!E.:e&e
+-x{ZۑyެG-
+)ufMݺC;Îd:F.>8p|_3[H%L
\ No newline at end of file
@@ -0,0 +1 @@
+v6Y gNX"!Y,& Wgm}7
\ No newline at end of file
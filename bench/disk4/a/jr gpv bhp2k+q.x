@@ -0,0 +1,10 @@
+%>3tClOVޒ;rQVcnkqOZ0.ڶK{:Q#)w/!+|4LቄqBn6-Yo\dxI4Ɋ&c	
+mJz]`Y)t|qjf8P.pGcZhZ%ؐ,[cp֗ 7s"@s=Qvxa_'3la)Dg7[9%[tSP?3nO<ێ~ي#U!rIPQ\3vTjZPE+7rīhJBjԣ͢bأCdBK|5+	%&ƮܢP|C80m'1P3>卛Y(n ul$/_U6<0ގҨ8_Tg$Qü:ɣ0Dݬw8҅HEԸgX+	_6?RU!7_0,㖟ch^#04\gOx}6(c:_6D{Ga)ffګV8c[	.t'ZԓfN#@^
+|u (CEea[t	[ë\7ޑWԴ`(zcqj{YPn(,ۋx̧8㦃]ȉ|R?T؝l|XWL&
+xǿs ,axПX}f!kPCm`L]Xh7ȤW/h.ԄBLJm>zn8rc0-P!]J+F܃^-P]F.>%WqzW}n
+˵W@	NC/\uS:FYѠcb,rŻ[;dX?0"`b'j7W)x"tGaz2qLE+PnSo0Q.DnԒӷ{Y<}Yf9M,ڬ,
+-ۨU-P1^j'
+p,%?^)V<Mق-Ϝp.S<c`y#;KC
+m8҉1#:x	:G{b dmF>iaDg?K+QH	KAr95yS4/hBqz+)N\~)='p&.,	BYB[c`Q8ev)nD؋8>}4 9X`qϳr5[ZlhC.7V&/VZTh?bZ֕35!ng<s3ͧʉIkе5t<g\&qAqpӭ[1OA1(1?	s*M}.fxfĥ zLEdeB@b\&&	"p(AUc9~W%^ZPԻi;DȞptΰmkuf0p:o}<vQC~)i_!FfjpKXmr^T5̔/7-P٩} 
+J<$ to}9[Zmd{@t}!hͷ <YNg>]qEizp/)B-F|e@ȠYD=Tf˕@yOnj\U*+ên$[_цv~j'(Ǳ
+c}<?lM?e@X/a:p	C9_UKZ^E%	aNjh%`PbZHXiFRrwaRV/kzɝEٞYB1ݯye4nxq<FYGC_^>	O0v0e92ZAD%pe7NG.c._=i}\rZc)A,1tz1摺ѼJ|uoG#Z0ỵFʗUl1gBJ8$$zlyۦ59@Un
\ No newline at end of file
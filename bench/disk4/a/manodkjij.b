@@ -0,0 +1,11 @@
+aA&*U	&L7!}ˏܪF/jo42&C^{'CxM;kR$[2@Q6g`́)=m4k7.dmpܿ-nO;*yKvsAkLng7Y\^܈:P%	4ʏɃ)]T51O,s-˛p&JQ.}t-ûK栒j}3yw@}S$QaeeѿL/[(brik+u6T(#~6C{C	Ҹn=n	MnnP:[\{0ǂ|uX4**)Yp)SK-.|cIg̣mQ["Ʌk8֮O~/TGj+3
+	ny*Cj`&
+W-]T%65#́}Bų$>Wqh(rxk%Е+@3bQ^ׁo
+<Ϲ希$ε+Wr}^TS׉(3"	_T3z:P;if0A?
+?eN5*nm%\ӋX0C%$s:Y@nGcYJ=jOo]תV ntaZNu+rSƤ$_tzWs#)',gp+}h<,,Bg?W}PSD'겥ݍeTcCpXLg~
+5u.w;1u5PZLo";w\KJYcF~T|C\bPLte2Ԝ\	yM
+M8򻙅k:0?^ ǐJ=to{Q(#f(aq!׻9b|:1LPޅCP7<8^~B_.	a]Zy6Ćۀr"&Pze+(f$pbπZҿI%}yzu=eCYxGʧx9LBaIZs"*PO+e,G鳄II<ZF,{.3#=Do7,W{76)5XM5|{p]>4
+Py2ҍ|o)[ui]CjCBЉNF#ԥxlsR[iipHV<<L]tS[	7`JE$˼a|)wHPQ3ADYc: G(Pj~As<d:ʏKCst)T9wK$I
+sk/svIn˖3[<Y<ו<ՠW=,(D(/D4QbdmE.s
+vQ2Xڊ)[ctU+3ĝs^ֻ
+M#ҞhBnr{uN,E~R>?j1f+jKh)^ls
\ No newline at end of file
@@ -0,0 +1,21 @@
+xHk;bUHR yg|8H(ip&(f^9Xrj!ZJa, Y(֐}^0ky>@J\~`C7R3FvO;2yc	-f/k+dG	Ru?mNVJLt7`KPmYIilDi=_dxew:jYR< 0ĉM8/MRNa_equ5Ӿu]Iߤ` 9պMuA/2\JOHHkuw7NΛ<jC2"
+~5p~g]3bĢRu,o^ACN͹}}$sR~$󡥖>Y\$_C1L{8";eQkhbUV
+~iu(/t]sMn;^Ύ3P(gb//Ll;L<2
+XR_c>Gv؜D|J+[!̟`AzyրzSzZCUrPr{ūjk*)Ϙ%ڲ&7Y;Ma-ELLxkVϕ1c@Ċ(,1Y|U77C{n,K%RACf۟I(h,SwP,wxDcĖH~-W-<8+q%l{
+~ؾs帰XxolU1>-wkR``Y8v};$	nE.3T%!`"FS^x`%6®Bn~]FJhw+~؇4d>sKfIV]xeOM	#/?Fx}Dv__ 
+S8uV{w.[s%Y|=CREӃ>?޿37FV&H-|w7@4i.ݻ]1Su!K!r%j;l_gW Ϝ(ׄjSKnfJ
+Z?߲;G={Q8e3:*Qir?gʛ;ef#?>$88NDCڗY|7b&X-Rng$ˑd,uaIuDD
+m׏RgMi`~QЗF{>6WoJ#*Kt
+`^`ݔwuYϼ@}[iPGnHF$>;	fؕ\$jB%84/11spn͖]PJg;G.E'$9 cHbV'uSg0f-@ȕp&E{P|h2}|Q#KؐT]HJ|SxJ[K =EYk.SЊ$yDyW+=C*>s;&%'Kʤ<,{9!5`)l`<˾uqm<$fjB@ZXB#Pv0Q$I\#7z4^x!!4-f4s[
+z$m%zzּU Ye5q"<{\uݦ9mr.aChۓŶǓ:7mf΃[T1%AVB2=	nHa\w)0Զ@ψpvv'!C1%
+<XTP1yI0b"\iLsٞĠή{_1x9aFǅ1)T7({ѵk>\ݘNe5#GTan%)zuUeU7w;&$C̶<ߊC{
+Tw@7H^$+6H3KUx`q>Xi){ -FO)GYQl2tI|=іȳZk:++C<eN+c%EG%'M6g_gM"^'$Q:"\Suv=ya:UHv|MRBPeOW.uyzL8dt٭#*ȇshTsp+F	89Ëg9|a6->Ϋ߶R(4%/SKͩoQh!^/W`^"!2WT_M8-ЎRrC;<ϑ)*\}@J4m@r	"JYÍ(ɽ`o	NIk+5Q okJdثLpRrduDST}Fޑ{W$FA/3n3IA3ycm873hO!&c-=&ĈkG?)颙-qpaRH PkԥV{PC	i.q*$1kry6t{_)x~H[?tֵ'{n}YEv4x4Q,>E	l%^~x\
+"IalM;HюއJZDbI!g;WFi-Ny5"}+^QW$ظ9I.	<vۨjcQav!肢&H7xE=6 ^x,{`+dln{P9E*,B]%D?q&Pu0jjK	t.X=΃4B;;SZD<۶#8&wǨ\[<.+%'vdD&NCX7eV>YJ䁵REX	ge~le4*Q~_NoK
+Eȃp
+QJt[9
+awz%F?>WeóS*WLu_"kXZMRm;L,vK(3qu@Ư7xP'B\oK_G,I>mҠ˓Lo 0t"X2`
+<r#ajmb2l	xZ&E?>ת.Ly!9aa(#vjf$H~/5w9yl I2
+`N3H-%$$Ǭ5n$6ʗ"6D+Ha
+K:acqba~A;9WJf Ԧ(Kq0%1 %.Ql`6/iqTQlJ߳]"tktR0#0u'L=tv+DTmI`iIQ/[˗#u0DoHY
+#҄Δ6?#K[㫪׵ϱx%0k\
+$A
\ No newline at end of file
@@ -0,0 +1,10 @@
+"5RZ԰s(`@?9j2.էDdjMuW,~|xB([`nX[cB,d1w$F.of74lR4L1!*W+A2ɓ@$_A<m7	gD: {ghQ4WԽd"{BcAGۃ&Ճ9465(Hǜ逾;SV_xשEEsL{).5|&ul$*<yt@۵/?d4W{]sTT]Us.MåW~kG_|TQi`8)hLSfC5-3yQ12ceR&%62P^Y>Mk	n$
+e5Qԕp
+RW(%!ȺVeg|zgđˋxӃ*J5aF7HOM?tqM'(K9XE}ܥǏcI'V[ 9% [-NUMu.ON5rTz=yF}m_T>B(O[4OdG;`WgʽL4%r7UUfD3h1]{bl-?J	&Ҿp䕂B'D8,~-^`A֨_v֣#uͳ	nJWlLsj0%K}^O'Uʷ{RA ?
+vp<_V7!w4P65zf	gƽN;'Pg//gUOJ1f\Ty6$*kK"grVFRv,Z=w^Nl8j1C6ou:xKso̜vwZqIj9F7L;Yeˊ&C+_8?_.d9w(0R44A'MH-=ٖt j5̎dt]3:AwUp(^}Jj^i
+0Mxٜߜx[oM@)h~l̻
+O.sǇK?yIza`?cz3 Qp_}ujw||ɧJL$5U_,Z4֜:P!qI(~3PǗ	fkB8Ȥ%jԥiDD_^l7|k_+A [?g|^b>ҏZh^Q`Fr.WbiR*A<ѕ}wC2B%0J [WJ9{2=M72>>]4_iڷ4	~@ڃ^kȢ%!=SEluJ!J]	+:ehƏ.`s#y/)3=ۄ=T{4;Z^UK>O1mNͷ"Y).5<&ڧ[&'gTOEBԣ.g2aL'r5u9%.j_-'C]+dgteoL҇ov729SY'V5Oi	f-K$0彻ڀ-vX׎:gQyal_jH
+Ⱦ:8z(;HRsɜ>qBLOl$=e0?qݠaN}WNR
+kb=1Z+)URDrugALoFqZy\XߟLIi"&_*sIλJltL5Fuج֋x+]֨*e5lv58Nn"K
+\^6eWg_(p'Nn`cB޾c8<'[E.QV嗖	j]E0QJvof*4#&9d8i~ҋ-,F'%=,WS|\U.wg_zoڑ̩X)|&Ԅ)wMciW(}PcE)gti	(%bDZfv3zRc.R/R+p2q*.8ȕIt{DnO)CɊu/cH9؁`O({nv{[,ާQo		.gML:!|cU^n^ͦQZ3?l>!	{MfbBeRQgmlFz0m$
+N@&uТcW2G(vwqdЧ9~}@s-sձx2t
\ No newline at end of file
@@ -0,0 +1,9 @@
+"|7e'!,pQEkgM*lQJ;kZYۺMv >*!n1T!>}=8(_Ad_I<6hըJء=LJGZOq|~ F,q"DB9>/L_t$dn3)Af?ziJ ƫ{0	8_LjH|KT!8|8WDɄj1%]6[ Prf?KܩK~D	<iyOFtT]+S{y}$ݎ^# g8VYQMsZ7I+ҊG$uz<ޭJjfrc<W5g
+ DxWt*"utkY#M(]dGd}-tX>tJo(XpOYD/j*Ó/$Aڷi	͞O @X$೨&D*DY|E
+urҋ$fqЌtЈwڱ`0MՕЂ13ø[im)\WΨ'䩧lT+U|%jm.}]j<JoAhIꙷ34ĉ;ʛ6(~xDoX|RBR#SK3FkW79r~pl*%YC)dc~ϡOcR-WvYc^u0w7e}㪦_x=ḩCsj%eg`_})T9*ok`@m̥}[w{'ǻAʽ͋}O4M	އ{lTHje(5PB7"zDQүD;/ί& c.qސG (r{Ol(oΧq#Xв>7[%؊i-P?>>{rz	H9(^iOiyHd
+&I&%O
+EӑI>_tR{!Bg0o PPzr̊D;q`l+otĠFf%\>!4:&R\cl#E;2`<X|T8{>$oz[bLTo+
+wzfz Gq!a#0lg,(qAZDyql]@aXAʂIgIWĥ_uD6%:mv
+cK*ΑFkbz9n4Yޢ+":KPtIaZT@YƲ9ͫ-9wPe)~
+3@xMRI˨r-,gg!T퓃X0"-7QzuIM"RxgX(aޓ7ΞͽЅVHxCF rv"/KӖSڔ<24Fb[!jd/@;)ہ0/|Q插Wwt4anªW3+Roy܉U,w]_~Sqe|`L*myVx`roԕ;N4j\aCLn˖+ԋW_}l#:kxjolGŁ/.mɫwdtlW߸j$1=mӰ!~(&FfZǤdhȰFc'x,FNS'e14*%\\IwJi'{Kyt:g${u`!SAiؼ+QrsF%8Y&*e=jp.P8kow&<oʫ}#M/Ơs,$?唭*M3vxFIn9/GkuIPn
+?B -#'4%Q{I0낕q}Aax8ۯʧi\C׭8e20|-5w4P?l5{F@	AFg\}#X;OgL,'GɧR<<a҄q)LEG$pD7Yhj0XMo ghwߔ+E8yc²_WNA&oquxKqbn;
\ No newline at end of file
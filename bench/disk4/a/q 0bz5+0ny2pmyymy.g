@@ -0,0 +1,11 @@
+6NAH%qS,G:KbfiNǨ(Iu"K(/g5s{-二@;Ӛ<J$𖜀P1|GY lll(oKԔDHyc>ǃi@ֵѰ,.zjdI1pRSgy؃>GR	7hhBTWMb\H26^ަ	woR+qoBy_^DξHc7gӃ3k#h30rֽTʲt{_c{C$8A@avAF*\n.9SakAPg9s=B<6U"7Ȅ[Иh	`\>4ŎVvJv*8fQqe:4l1WEYgl>.EPY^A.O[sqsJbG@h]	E?uSWS65_Uw$R度P6,"Z{3;c7!0oMCz'U֥]CXԮ)ya[_k9[/Ey~$p
+|e0)Hpֈ;} C/PġZm5ObaȺ&9)<&R1kᕴ/	uڙUR퉄;uvKJN.O(1TTFPgtr{\n!澊gOR=ʤ@t_I{mY
+v$*Ȟ(L^u!&ϟ;N{$hrM4l0	tQkr@'MjƵTD8Ȉ^\b-N}y;nOu!M5W+
+f}tbʺ!+0Pl9^-%wpfB_Zm!:e[!N]f/ӪbQ2a%gnL;kS}Ie,U GbAk#Q$fRyZa1*{OJXйYІ?'"th"q1Nw{F(u[gݹ%/ᴑPi5j.ŒSx*pI/Gqָ`KB4}XktǮ.7yf6iLPi΀j`05vm8꯳̿hDqguC"pѥB/FٺہFBӴtf'7tf{8SvW{|"1q"p
+o7[q4dQOZ2qDt9?,hQTթ-ThU~b3d|l}V˛dQ,$o1j>HRW~k%W^UoK`cgȪK
+L2=}	^7?9	`H#
+B1Iu1郸O|0=^JAOV":*Rz'<An5,NN}8'v=im*>^	 `J#/:zQc=%oɜQ	(em+|6]}Ը+U'R!CS䰯3sAeల%DQ/ӿϑTAPfxhZ@^R!F)s#+%vĨblKJ³r39V09A Uqɣk*IJsgTEt	d2"iF3gyD87]1l埏6Wzs8~ub`qVS]`ɴׄ/,EEf$TMRډ%>XNƯJFF'g˔?m8}L'i.	Uo\<ۋ۷6:	+/iU9WQP8%/+L'+|֐gtR,t=ZL{EDyڌ%S'`E?\fL(G!n]Q Qv&{fPUgʑldlg9r(+ˮ,*k>Nԁ]dXH1`gSհ!/0Dh?4X<	HDRDZ4Vݼȭ+ Hw(o7vҰVȞSoE;Fuup$!\k"
+x&~θOQ{ho'{5ƖOy>_icnzĞ~U	чªezr>/n{STU46%ư8Spa̓/_B[c'̘ENn4=e"6xowGT.N12ߙ,ms0[[Mݨo2%BL`jDGEc	[+.V,0嗄IZA{/MZlFNj:H7ܥ<E֗ySt9b+ʔ{ObIƼThcw-?ؼV䷜ƛ^[牳8[r޵fdsi$[UiVƛYSĸk)>ն=$3/Gvس~o|&#l8TؚE]r#Ye+<1GŰneNgt<I՞nHZM'3V/qF1(1UPUb 2D.В~w[-܃8t˝sr1o@97U(scO<BZ}6q^>`>gխlO81l	8I$YAEa'h	U̞~[C~-V!>e8m+!
+y2B~XnȈE9){ăFd
+0g[B
+oH5*2uIQ@^[@lH0q`H[*	Mc{G皭6.oLFםEOrZbpY@AwK)ؓghh6x'v?Y""Liw<yMF.=dMpS칣ByiX;շX}14pz,U45Qͤf['tǂDvfw1jaD"L稶|/w|WLIz:;eBCtire	ܜA`ZߧhTܐ}u_4H1CH>J#C_.1"ED)ΎuGQszV=F~*SVbEҖ3f
\ No newline at end of file
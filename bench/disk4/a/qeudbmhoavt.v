@@ -0,0 +1,8 @@
+Vᅴ1D&
+^oe@6E/J`ĥXJa'RǐQ&	69kpen4p`D-M/W5ԹE%0X2)}ɻqcRޓ	S{,
+nEVFpܑnyxlh`ȑzJpis1:=lOZmOu<4+2(;dn6D>g},AvqݖUX.pc\+(KYbXIr7ƨV)QS[j\d%fql?T#7<#lpB6\ˤ5pḺy#]^O*+AI8.>9:It/	z>j
+w.{sA?9-6HTܙ?z$qۓ3T(8oܱV)(uKr[9VGB֜4o]eƕ`طp0Kgۉ&?2[+mTS~K_Z@Wz q~80݃Tx)k!%kQGs^!#;{}2@J[h.+];5sd-
+r[p'>Iy)v@ Ǽ4X7!A#wOqL
+ܜ?v.G2y?j"λ|qf|p}EO:	|b-Yg}>xn_hyڂ4Ul_)vgUݗA1=+qh|
+v馶z6OmOX;fμ8:0duaO#zTyz'Gm@~cDUǷ3 $KYw":CS`g3(PW+ubsvpU>60<[UdYiw7X+bUwoit B2)~PƎЃJK/"xQAHODíFk
+_v8sa-5G5Eq
\ No newline at end of file
@@ -0,0 +1,17 @@
+dX2l{64uYNrM?@3p)鞁#	؝3_gq3[?,sˀdAVih^=wJCI޼t *ѯ0WBtsT&3bDĬyf=}vKˢ P2LXx.(bRAmspxD=CCaO2]M;n,6maYDTcvGN|iz첒CƳwNǜT.Ō!-&*]PNG$:4XNyz 6v6l|\+%Av5(E0kgȂbQ-M[hxD;3#~P{ץmP4@ӠB>n$졑$Jhr{oc򕿓!`7dLNv|cH	2N
+h	bèљaכ}u*EU@sK݆;rflfؚ>BYh\hTJQ:E_
+705XEul:rpNI[zܞKBb,e<Am^س0=@Wøn\pGA&ŕ/XN[qOx|&pjVz~meI<,H˜28^埰Hc 3z;SpPoKi$PQ;0+d}FlGY08<K̵^~S?|D}m7ē~F[y&q|Ri!9Y	ם[P@AaŗV~,ݲtwuRY,fc^6gҥ{*䃠S1)
+qΈت9V޹Vj?9Ye{	P#Tdq{ʠ*L)P g<G/k]H?`B8A(7޵,~88DJP89EdC7 [i;	i=ǞstZdغd,Knxin&)C-%.Y}`XQM=?sD|_	}ɻFNObz6"N9Հ,5gU(z},9cDu_`oNJ46i^]? &]/9X@ZkrTvcQ^ؑ!o#6ZWoZx8<:sn}/=Y@iQ;a!i\Sܺلu>~3,)U_=b/JfĔAǔ1kjD
+##63`::hb?QFO)ofd ͣx`=	)>\9󋶘I51+vbb'5ѱhV7Ww`Rlx]Ll})	p~z(xǒ|Hm;ZķoY$cQRjy|CEK`%i"iRgEbbMi&K)sh!,4[*Cm	Z7}-ThnA(}%.HY̟_W;1TTTHRs?uK~+9	a*koCyUaJJt:Vp2v5rVd!ecRj==7CI;=B<BG`>
+yKmn/Vn<1enmFq
+FEv(z0(~Ysq3̡TS!zsNs3*Cи!>XHOp
+". rLW&oz4J}OCT¨OS^!Xk}3YywnJL)N
+3Ŗݺc+gLCoBZUc!ӏc&;Uk`M8F]2,'	ckC>+I	|8#"d#BjV%	Yޠ<J81X#|:E摖ܡ=F*E',N]H5"eDXp-W0~63_qI#(9/O)u'Nt\fcF1vFeDR
+=}gJebg0xL1654mݭ!rpJ]smq[!ῄulR.2;oTEn3jN{:7Nx\f"y,scI"fT`msRA9%B;nySaD{q
+I]=ws~4~[peU?]~@{K@l׋ߌdkxDeE	j%!O刚q"i-͌ITJeLf'n>6yјш]qe
+SN_K_]Ucu{G{P
+%/g@-mgVgbd@HnND9Q[ˏ>;./@#A3=xWxwRqiC)DAM#dDzQfLjXHfr=QWhu݉(?mKD,bfq4|wqoIqg`fE)b0qnu/*7rq5	նw|Ƴ-V=\C;
+F_dNAmpT"OI\i$JBk 83iAL-.9I=ܳ)JR;zIXW]m "gǀDl(t9OY1sPy§qxmUC3aZHe;3UWtV!5_!eлoz;#zpBWY^3L8A{]~ogGxTk<`/޽#H#5|Sx?yFʏˬLxj.zŦUxMߡF1Űhed>5r}&3.-+<YǇ#&A{ZLY`A@ϰoOl4SD?Rmgy<$_:}TL;H!6hdJ5Q"-_"}AvCS#g:	Ie3TsID/o& mFRGY4BM[፾<WJFxoZu6f幭DO}ch@90<+#cꞄ$}+.73c+W`uCE
+t/ٌ@gXgD<w&qlb_ݛ/0O| 2\>8TN	?#3l	{hJr@Pp1#{,Y]UKmjNl2={,@W)0̥yjM>Ym5q\
+HJ&>>=2i9яTcil?Ovdúe*%RbbFKs@xid<HX{7]x1R613']z֖UMl2em@ˇFnvN<lt@Q&]kPPGJ
+r^j"0ےCU;9;6ɪ42fmS~~5"\^.~{LYڋ5[qnh'~g*p
\ No newline at end of file
@@ -0,0 +1 @@
+3h
\ No newline at end of file
@@ -0,0 +1,4 @@
+dW`befQ&.uFr"iA1Wy	fDOm:HȩRuMӖ?V^Ά'/"=nN'ө#+ݭv9Fvw#lxO(?75vG<T0)	@*%V?;"ou(@s2 3W
+bvh%]i$4W魇mAb@t|o:vaǵw(bIoN;WRCv&)H?IG]8nij-(C-xiHM(Y;rTb^G7$F[Fڌglk.DaA4N葽l}[:tjYlTh'pGktFLuC͍+@b?+G";V<ֹ͇#	3A|x6\_]""R&;c&^y?/)ǿSU읶H>2"$È"1`YN!Z(C"]l_
+Y/	9w#b$!(P#;xC%ǻ(@ ;!#LۡLQ~z7_.ـ'ea]ՐϹ/tH603asߔzˆمE\yY?vy%9]-xPژnScG`K4	ۚL5ҷN*Nj/:#Y`$/AQԅ6<6L\qLP-WLEk!6m;5x[GDvk	J>x4QDBYQe5lTւ~t-v9D{}v}McƏ+?|ht9l~W	Tws{K,/-?	yvBl2jE@ì]Zx
+]C/Ft]er@7z2>>$;8lP&CD1>6ß|"Xj"({2_=z%~%س+3^]([Ybfh*2Kd:+,pt)rA(՗Q17~,;#eQ3gܘ<0Px5971O	$dPNb'g֟5"tUw(}sW\k^ҤZ4\Z:Pn BJf= '9	lrҒ,C7(@b;N^p/,BnPfY%/t6""|Ӎr4-UY۹\H3vT 	]Ly2AMyY.4mAKXH
\ No newline at end of file
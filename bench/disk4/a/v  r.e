@@ -0,0 +1,21 @@
+GYcg!dKg"x?JK׻ɿjP޻iVUX<6#qJͿ6bV`*ү#2GRPր_a@hwL\܍h
+3|hzBbc~fW5b]}$A/9A)(pSCmI]h[[D3WMի1a{Aۨ3V&~m;#dNao<2SzK&7B`1/Swbh
+9x@7,6ŸI"=w+1,Qk1WC72V#@?e$yYFz%&	1$}$]R\w!Ei(x[̺ȃTؘ]*IJ:pTڞ";5](Y=(PCpиN%~YQa+&^
+[ʭG [[Z)1IDh!2'''GЫ%gH|
+9ΧNf|"%y:&1XWVB
+h"#Z@_f璞7{.dbg,&Ѯ [j_)d;&
+oO4pD՗]h$_
+:GM\y0h{?hjotu-cVI!HFU7Ya۪U<#Ŏ]8nQYQdvf%\pnVj7Z(-w*ֽ; yՅPv/=X1+I&bu5Z{QZd,:ZoZD5j>z]Rey5dз,gj)9+s붛{e-7 :fQRWR$>:wNKEm˶QA20TFǆ7r3vJ	丹ĭS|6`IҚSj\~RAuU!EOJ)JJSĞlSqq0a44K5p
+g>=&g m!,a|5GZtjS箜Bwk׭oD}ޓLvIWiM0V鲞p0 8lF)!aAb6NP *̦n0̶Sپ$}fMZ˕٫:m?"o~$]zmF=
+/yF^lS|=t8f+ _=""4~!
+Y;/`ciqˮ~-RxewXg^LCy,e{$}xLi`FW9)*A+2-æ2	;=܊ybc 5TUNJ+u
+vPgx[0uvheWQxS~O܋>ZznR_[5idRcj?nuH+f=(g>ͨL6Oiœ'jx3b[PQ`$f.5-K
+%؏c+EÎt$o'ݏі68LMpU{	'HrF5/<Fwye577^]1<p/ExIh΢^|vFQ \&eץDG1,47ƫ
+XEzk͆9'L%v.ȡԷBaRcDqJb1y@#`Ƹ[	w~(( Ѻ1&׀π`, 
+8XEt"ңL4B|(Lb->U`?GA*MdTF-M谕#IOF,ʆД
+	c2 E[Ă;}uӽ>%;SnOEN2@dVf~Hz1\8ж2SSdC}|E;.u!aiL*q韻!^(sgiGf}\հ}OhjϺ41-}U`D45Tzg%Y</A߲=hvKPy2ˎ2C)'gUD$wo!'^6VeBQEC}vǗՙ.\o&	3˴ `ڞKNY$mőu>S擒kVt"KGO~Onbd1ۥ	CTúcyU@9wJ/pd7YOnjwVA3ͩ5!B.wy{dc:c4+~+Ē7>E͕q;p?iy}$f~avqd_9?O~g6s!%_)siqRvo4ؔbV!
+lҵ%lKda
+-Q_0}:>Ͳlw'k_
+b:D~b""[dy#,bL g% T'dK_C3hVc^_B,~f2-lI03cSS	AyJQg=-]'J3gAHu͞n%euԇPnEa.VV+Mv8N^'b%2-xۍfdJ۔;4/P&N=`U%g
+I.[Xۄ~H<Y-YdݔCR<oT1O\hZ6h_u	&asĭ	 BC#kzWJ ~!'0D՚Nl[vHz+s52Tz%ͅC=9%
+=⢸䌋]1DVp.|Iz_N6-3̓*6ƶ`ɠ)7]k<J Zuk(o1{tPUMv&kرsUϪfy2haS
\ No newline at end of file
@@ -0,0 +1,3 @@
+gQl1ZaT}C\*\GOZM.Z;h
+IԜ9{4_ sY	&a/{}MzuXU&aSTPB86]N.BV&u6)6NX
+󰎁PSW_DY'@`E6+Ϡ5طCEw,TxWDpi	@exerÙ,nHsPўӽ {]1zWBwjgjs<
\ No newline at end of file
@@ -0,0 +1,10 @@
+#au1b\ڝ2d'S11زS`kmyz[gOB~d9~#RԢ~F.lٵ#ǄWGWc²|g\׃2["Q"(\:aM$G>r*GB,Vm?@Qd-w^@%ψ	FD]V-vF_
+Ư-lxα95!kwPˀRc6C!x15WjY~@c%?D+Y>jBYMb\s Ve3̦^8.^M8-zF$L9CAƾCYt	}T_KRsTÁv{A8<~1AWaIT%dWCo+ۧF3lÚZ5H:.M<:s{{f=NL]H@ٕ %+=',/a$	سU- Zhgao--"ks[Iѽ{d`h؅]cޝg<R,B?}I1?IzBs˽rch5g=-tıo|	y-*(ش e75GrJFW2N/X|I;1&$!MfBJW}|&,$^Zt37Qs@*'`0tI %Z>UK[w/r5byII3Vr`㹯@éH|5\C9Sչ R0~
+	HIMn-^ɨ;?.<eZ+nSPN9Kzy$2idx"/ck2:T=Ꜻ!r9ZIqAfui'mVmŵ'[)e,L|YTin!qD5>̎"/6}KĴi,Ճ@ߟ6_PF|ZI~V09&%e{;SU5WƝ4]cE2`DW҂C!ỎPY9۰$gŜZэY%m<	ޫ"}vb"}pB(S	@@@l@^'Hksy:4UB M|"G|Fwws
+'h2o4hXb@h;Nv[X/lƉ¨~g]2BCr
+lf~z7\;)7}9sP~NƲvNIuG=Ve)J`:HuFm?~$J*o=n}Kl[\"6^˖qKFk
+D%}dm6h7KXPR*<:'ޙwQYłSRN/$9w"W;VY7NkDPmG=.H仔Lej#2҆	Jts$0wEmO_b,	fXpEO
+/2}dyd٣Zvm'u^8ңOlӖnjiHy#E:C	8/-l/ȯ6$Z%y(3}yUyny_Y{ı[hơQ{ؾ)Kh_n)+fC.bSU=ho{N܀Sthwj
+W: 7zH^;(#R4}cXv)㷉tXQ@ʿi}Zzh!M7ͤ,s3\tkܗL5N	ª85ҀЄI%"Ւ`"]1*'ŭd.lxbrUmQ@Z]>IE1>K47ADD3QS>Yz\]7\eK>>b`텞Q+.9ǂPc3C]q˙wV
+>X1ŲzG$`90G6뗽Z?1K+9?>,vh^@y,J9wgLRv.A08w\Ѝ3d\ʐFŘa&󏆜ʧ.mEPig"in_zTҙDh3Feaw69T⟈O	ZUaZfd'E_ӓ=i9htZG4=6cw=	k4+ƗLNq=w(Na584/7|пxgPoţ$}1	k.B[Q&R45e:p.ژgOY!EfFuU&hq4B##5̳-8*`Y}e5lr2BW0&kQqXVƄ
++v0|KV;}o._fH`& T Zһ\evmSk3w)vn=Mtݹv3H)OH҈cR=W0OM(ҠMfo>)zME{s،3SQTgܷ%Ӣ_APݐh_(Njx`Yh\#ˍii;~M|Ԃ	T
\ No newline at end of file
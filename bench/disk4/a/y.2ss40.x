@@ -0,0 +1 @@
+mM6U/6d6λKnBحM0E_2c&%Uw3.;^YSLU\YhI?;U{x+@zoJ$oBɫh,,uwk1
\ No newline at end of file
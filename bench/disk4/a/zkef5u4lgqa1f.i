@@ -0,0 +1,8 @@
+PU%r+W]W`JEɧ-/ôGT&]Ьc_#i윻1ccҗ{*99lN!d`}`7fȕx4cx;%
+	$l"˷gZPZw1O(̚i7f%KJ
+/U"^tz>͠A䨞{ARa~:o<~5acxhyMDLM5ԎA7UMΙ%^lQqX%B/3C	v1B3K\(i\:S @|F[Ģ̿[TSZg$s5ʗ8gی3P-/ޒKhB#B}qDTqLD!N=V"<pu|s\	mCiS⦢LZ6~_Kǽf)#JES5L	ABMB{]8k
+|^>R~Gܶd?
+0NoAt!tGAD,/@zLPij*4/SlShw3j.>Yѕ%SJ<:x{0?^d
+!:%#)Ԣ!pșqLh-x6]f2κs%zFnT319␂>wLJau&фVLCEsg6^qlƖ6
+">
+:#"EͫO~vӏ*7*B>*>f4C2	OXܕ3zYdMu!kDu*C/<lq*hB!fft ˦#m*MNgLmNE:{j9tvztͲV|ƻ(Ɍt-'悶<H,VWs|jmg;DfJmW(#H0`H'ךQ0ҩ2iJ5k*JtwrKCȞ*KGt5Pe@uO4۟Jχt;Aa7GOT%gU0S_#+6i&ⶭ;Fd=׸xQV͝xQnSF<-˹i5q\S}{->4'䘩'2,9"{V?&!-&=#қ?-r
\ No newline at end of file
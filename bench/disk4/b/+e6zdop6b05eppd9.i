@@ -0,0 +1,17 @@
+NcЎO\Өu#
+_
+.|fּN[Rq	k(qo.,wndfIUw]{>ٺh8ʎLCSM񞷐E̿?GlSS#-9%yP$
+Wq;q?3πp		%c7|'OJeDͻoNZQf/b'ֶ#jnB2\kWVu-DgIvqot)<2|oW
+#ĽN|aqn0{z~wP'M-ÌNYqvbq03ɢ>:̉]KLhٔʰ`<UXuDLy[\ &<rcŏr%E= HHCTLCQAGt&>X#hOL+SɹhijsVZlݮΔ_ݑGYah.AA--)㳪/{^p/<*
+N=~uwF/X->M??M)&&, dBlckjfd^qf39,4h ]t~ˠȫ!6y^]%t7БbeIShC<^kay#&9EDE1)SD%[O2c{	
+hB,Sy5 &k0Jub:IgĭlG'ߑ-eS[A#Vn5}JxUV]v.}D޿R&ˠ]A2Y7R#ku-':3@$EHRSm+4wjJA"NUVPasReE4t~(v"o|qh?ΥXK73cD-jF/i7,:pƾrr|OEp<ߞu<*Ē0knzHDյ>Vw(B`-HD{#&]cշMM)Lh7MDMJÿyZ̧KCK&H+rBWQXV>;j'LxE 9%:y
+ҚRpV?Ց%ܣY&G9?};4&]o:j+!T%y9x8"_&ѕ,QêRPyKkfFHaP8;XӴU޿zZ[OWcU4{TâA93gߛ-k3M,\>h8J{iԪ<ZXFIGaXZ' ᆀ#I&$ũ
+Ld:8kUŒShnvj8v&NFtb7JndY
+ӛ5Gp'B
+h! tL{UV0Y:\cA]%2_Pe2b
+ySdpZ3y߽s d_1jnchb!*eu9*\x켥NCQ8guXr:v(RhF..qNOw7tRkOrWH"" ɩ#Q1{+z)4L[sSsgZYIpߠ٣=&,_fB ^>d!ykP*֖w77lܢ7}iHBv5="{E%S==Kh70b&TfwNG%tMY'1OT3%5gyϣP'zB볗PàVӟQ!ǞSFig&]UD^UiD<a,kD@a2&1aF]Aoϊ9Αg)g=
+nC;{D{e*/ي5y\y*_@trcDSaMx(0p/x#UjuHa$Lae^!ߪ?~"tRšGqo|eVlƩ*S˫.؁T
+}<(iUMFru~i{Gʊνb8ޟ)kex1jNp[rL@;fmt}T+݂J/x(Zj"IP[$״1ӵ/l1zHJ>FDBN	TQAZj^{HP9KM|#SRFqU	/ίګcK|'ʒ}H"^gbdy>$i~4ȺԿ2\'^D^uc<mH;/q"< ]r@1TLw]	EZg_? ʦEDΩksݽ
+3fdIȥ>WV_Al2iH:AHaK div[fkN61U<*I0zt@a#Ohi+2~FtkbMbdWlj3SQU~"SY$b!_b |ңގy7(3)EHC#4ˢk0b}HF!Hwʪo~Mdkr!2b-{{Y1þ?fF&')+Y$r*>Jl^_JCX'誋wLer>$e9PNB9B;/7Cڳx +צuTi=z
+$ݢJ:aCRNX[Iⷛn?.Q4D[= iDndf]P%}tX8TjblbM4Z~%R)gIJp@.pNm5>ȯۇ-:3'd,}5blJ'a"E^fW7"i:H#`v9mqoF!ܦL	_!EQi[EPcSWy]$beb}xb&FB*#8sF/5\ǜpnPc/UA9!ҹ\-=?oVh/9y^SF)Ar*[Ryܺe'MXe|qAi
+`4@W]XbTlQل<pHZKڈoG:&Ʉ3~L8M/ޜ(I/K0bݯՒrg1Sz\b7ZR88&[&*%k5٬".e=ac.F)@,o5!Gus(˸eX[}"4aRW`O\,DƽyoL}>w[a6.BT;!1'-b4fWgf2M;GNq9dw[{@Y*ٛ-3|4küǸڰq	I[}K1 ;^Xҕ3x%Z8f<tmAD<<=hv Fnrf=ȯcKZtY_~1~Uc``P1[t#W5H<l%no,aWp##FYlq]bNF!jqGN\6J-˓hȐ{zm{!UdUd_M$k5}'l[zFz:G~yrqVz"I"MGdO4N&
\ No newline at end of file
@@ -0,0 +1,12 @@
+4Eb\v?d:	iFO9PohaC[%*:0
+@8U4/ 5(n2j|u:,vS%P[v(B_Zh94+ڬԗʄifq	xl`$p2Uۻɲ ڸ7ŗ祝_G/#qt7xAA<Y\J<.?:dM"Bx1Ji32!S`ہ`˼AˑKP{YNmsXqO{x.o)zW%?_P~jp:(/sw.9fNW:2ۇV@mfVM26nCNש8RX͒c0SotSt&
+Atr$KiyYo%7t-wHf`9tUOJ-=a<w?ޝpox/Ê@6֏Ϻ&\CzITD$?ȱ4G#l'▇I^eHWKTJVl$~)RT;?	~>#HqqlWŬ8N!X VSP
+bb;($D1旯euXYu4r(eF<@OUWfuצ3oԹW*κ_=O_)^I><
+H'Wxj,+^#ږ؝Ηq`+"^;mB0	ZWe=DۍtOAl{9գ!}UH[KyE>ʝk#&8zZ1rS؏M<c8>/V;Q/Oy[I%F(QOMC..w]qMbbd_
+%g{._MʊH*g(
+z\<0ע&2@v5M6/9XN7Fɦ;geGwH|	ԟʎQ?J\̇zc;O)XR+}BҰojCgs3L<jY(.XBqW0A9*'RU/KU~idϼ)ϝ[1Ӂ}it?ecMO"'I_tA|@hv[0_+G{A"jw]=tsćyz~JH'ǒ:lc!$?f+bJGCYDy>CIJyf	/G~ܠJBn:uZ2ph.*j߁ ]T84C='5? V=)5IskōWƩ5W͒DQ!,QTa)j|By64rS=Z`vqoLAJ??dRY'Z=4ІZ̘:8e>	fzu%Y0o%::Gbo1v8p>
+Vo_o[qݮ q97AHoC~@3
+KƣUDߘ}ђ{fa1JmpȰQ<LyIwڤR<9kŃKjOi+ 	v`Xd?9]epy;/~q:9p8c,^b;X!ğG, (A43xoRQCh fH}<SBJz2b͇a.2R9V&J[}[Qل?E?@.b	#sC 3j@3m8łMSQ$z5$_2:8G/4nz2C>y%⍬,7?"-qt8_r]\&<|(O@'RG吡kE۷|#ӢIE8woyZyʊóWqƝUD&}u%7rG0rPKBRSuPƐU24a7C0te;;6H*?ʼƈan)[uPBgi&P͔#4uԦ
+J%Pq|z#F~Zs&7
+#usdxi|?ZHlx=׸]z$2]'EO'_0q-4[Y-=M[wkGG:8*Pnƕa*:B\(oCX=3qқ6u^̆NojX7Ě>/ 3DOTF[Bg|'3Rzzwq$Y.N4jL"˭HLOgk?v'\K2e`uOW,P'}JN7o.t9uSmz]HKGu}ۣ0I C	kytvޠ d{f";B_1Ӟ&u|_Ƶodԋ3F>
+75[X0Fm6PjW|w@bLIVL޳l>Da'<w1+j7UӲ]>&XX&!F+(,|olխ<;`{m&IUZ!o!1'*mkMd<۾܉+(%=M(L*&վO'P]r~=4F v*r_wRb̀ˮO3Q
\ No newline at end of file
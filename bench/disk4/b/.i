@@ -0,0 +1,17 @@
+#~6|3$IG((΀tԎ7~o6Y6KRr*Ud`vB2G]<9VSKtEB&5Fc/;[F%e=h^|sH~%%GdB0sHb4οSy8fPR}黖ԇPM#ㅾ`[iqF	d ns$ݸ3X}ɩ]78/sR%$Tdavѯ
++\YH׍3DUcZD`ehX^Pp)C1<il%=C>8V.fr^t֪Jl8pN9u`6|"Yjd:P mM/VJ ;p1X|0^já٬xaϦ)8o|vcu]"BOS4Oqg澄G+F{e4o0w?r/N>d/$yT,`YשvXR:;?mG[5Iz>rYWhQgpTwѪP-⚨"u=7VsK,pV!AqPf]D~ڤP'/o7YZ-ZkhF,xq0ɱ<*mc^5֕j<tޕ%$,#`Vcd(#nuƌje	S^D5"/o{@1	qS]B<ҀI(8:h^N&=,!%|qt݆(t^s+Fi纄ѼӶk@u+w%!	J!iaE2݅!`3JW25+rwekyz͠$^k1>Y:6-ȿ'zNɍmhocjθ9+
+ƛ]]g49Ύv=IhrmE5&Εsd(O h'"),m''|."oxo4F؊ojJ>-qlQ0pku {\9%* 
+ʞZ`x#i7:hQ
+$
+7YiRA4<LSmTqʊd'C;|q?W1H#Cr'r("׎C1IwfrJinɵ֕JPXjע%PcMD.!u#0*ܙq9m$Zʯ5	ҥst%+VrȳIWYf.`C;|R|e)KکJ'>h7\RF-'taqпϡtQVط?C瘆]YWc	6hewJxlg$"ҚZL^ԿeMcr
+>wʆnz مbqqN8.8#܍ݳosV?e>S<x&3e{DzW	!O6*?t5ӴuP	#KOd;#xrjn~ɏ!|:+4#+A
+8\:8JMۓ=)/n,O_Ze%=nv,=u滫,7HfiД@'gPzQیh>@GIgej-q%czxx}cQMfdp5_6ԶwEn\9LSrV4c2f[VUϾ2Ԕ#2dVs|?U+jÉ-6N$#&JvIa"݅XlEkGhYؼ4hӼ(|\^qʜ%ae0:Ĝ/KNJQFACVdg`NHw6OV`3\駋`rW/E>k3k>,%3P1'8I,S8;]J:apUPDuRUr>,@IIMHEr`v4yB:AF{[j RB޳"u{E?U
+:Z0F&'2%+`
+\"
+Iqq@V2rڀtj_4`Y-!K~uwŗ9df^7T꿯Ppsx.1(_8IDwV!ObQgG``[R{WTnE5L{}9q
+GJ	Rv	-{-GdL>f0bQ|:jt]
+u.zRns=p5Am85)@Wk2i[Lg{qõmixdքκ&WG%Q.gyx9n<%-+tʅuOy;yrGo{49A=UX:hrZ:ze=Xۏ}HL6<F;ޭQ^Wqy{SC$L8m57{6G7Kw8lN/pZ;6]^>TAM^1.x 5bR$|QtdczHc|[+9e/9x|~]wa_3@D^o˳Y $sݛDb-'xX>H;,9D%sk4E2򯟍S%)i2%-o~Zk+{	`6%f9E>2G<lq(L)e2])&
+s7uo|_Eh@'$̨FPr^p}Hi[LW=ś'cK;4Gn/%ȅ@i.l]HN?au2Ll#es+Xn)?5t\Je@ZǺgٞV^Ï,6{G؉7U}[͐k	Jz߽_a6MƎZENE5Zk%.
+ot4ǉmyE#ฐp72_DQ*Ⱥ[aotc[8G=AVT
+bނ:^0LB,Ϲ+m>TПu7)~5{\q釨=C8t|S3[v׎Dvx_טxǲ硄O|^10k㵎n$jW>WsDP^A9KJN/5faqhQGGbi|$fl}pE|UC_xtZTʛO5^؎
+a1V1gp*]0mT ZsW><RÑߘ4=њ!JнY_HS,h㇗SRUsn.T&]&eol7_&NBX$<RW6aG\HcF|ZV2.nHxP!E8Hul @ƨ((^a+,jDkcETaۯl߲@1of8Gc!? cmQZ%",,^ݐ;HrTti'@/_r<σ'W$yuP/t!*jH}t5mGBvn8PS{@n%nr
\ No newline at end of file
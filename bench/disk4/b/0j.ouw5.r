@@ -0,0 +1,5 @@
+8pmS5f5AdqMyΩX5\mH&&fG0f&Ӱ5|?faэlga%nC`edg'xJZD3!ɶ8sox"ЌW8]8rb;jVӆiBo8WwFw$W'&X3i֛[9ͭ쑾nS%ON@Dn޽O.Ds;<FNֈcgZ}~8#)2{t2sFP2lIQYg57=}[?:PG۽R+otUp}<M]:;}TP5*ZYwѯ~ưZ1ݢ%ŕI:eaTs,̽%/fK՚?A%1xugET_ʎس, \li"ꇴ~>쵶9o(ۭ~<-@kV"h_'*=a\3ʄ`U*o>w̠(A3.FrP:F+xّ;0Wy~
+.Nrq@/.ob}z)&C$rp
+k=[dغ9I'`ZYp.Y;)bjKJHIN1a),s:j4BhUF+nFT\j`~.\"dRt7GFxG$R7evV4u}T\x'H0FǂoG#ݘ^з#Y}waz]1A"@Ch߸#^mXsQm!`'jA:
+LO2~Fv
+ڦz('p(&h0ޛ?JyEXN%S~MPZy_X^~o`C'R\ &qlVJMgO;lV̨!fRbs/]
\ No newline at end of file
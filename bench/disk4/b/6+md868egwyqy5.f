@@ -0,0 +1,7 @@
+ȻepYikGӕ`Eۇ/JF{J̱s}OUA8$|׃pW_{ HdiJ&_ޙ$M@#MMF%2jpCa4+uxb?.Ь?iь\ڎ닔fVdT@nT6K@ƊeI|VWPa(6""Dr'3K!CXP`^YB+)g750Mͬ+
+>cQ|:c}s,UIrN"e+byG/\"d {ITjr%x 4AFF󿫋Cڞ´N8ʊB5Mr`}KZ*mn?5M]4gA(Bt鴜Ҹ$p[[2Q(j[I9,g;1,yELϕ	<
+*	d46.]YAT^hv<V\	 i\#:K4;/<
+ES֜~_h\v&cIUЉ6B?^sk̨>bm4Ǚ	Q8>o){;U=8EmJtRDuCQn5u8|	C
+-c"g.ކCNVmqwie`Њo8n)Ѐ
+I)0cfW%8569Яgnǫd>[-]
+fHtwR#%"5V!~y,";n>̼ ǁT*U'30 M%Yg=WG(Zx߬daOC`'ɯ$#BA˽kY9z
\ No newline at end of file
@@ -0,0 +1,13 @@
+#O0NSl8;nYP	d4%ZW*;t&>q;><!Eٳ|0:>#t|?|v'ޕDfsq^!zR' H]1cvTz%mE!Rx^5<'(~uj>P[´LᾋG+Z3TgCi0>iSWᳵXZҐݤIp|;	YsYmNHNh2/₼12ϓe
+"~KE\}LqAJ Mܜfv!JY8Ut1mMv2&ppv0t(g5Bp@aFSI~ACmL
+Țr~So\6&sA[,K S}Nx d-,bq͆wыaBwAUkmE hJ8pAN{^Q:7CgvbtxF5(ώ!-ڮ<5l"`1LK.آ!Q>Z@:($X.+߮PM~9He2Ivɪ`wOX}UKzbg>C:'4ۈ@<sv&!3=PEI|e߶{d9n*Ȑp#3A"p4:)8Fiz[N4\!`޽$;%"lz)WBMJNlaXNL6M.=8q'JrіQKiǉ(`ۀe^M&(2w^P<e}/+!y#FeIn2"]ܤJsΨ}\T&oMLĲZz=5
+ka_Kw;qUySp^ySONs.w{tZaT>
+d~pYꡕ/'"_ȃ>O8SaTwQ!=W[.v+X+ڸ~(ŶqaQtmEbs=zP	;ct=e+^
+maLglڳO|WI+[6zR2\bH@?ÅD()PlmpH5!],^HAu`
+	IҴ"k:;	-Wde+1W]>!{5hZ=
+ZᣭqI#:eC0͉`urP˧߼Kӓa]ist8&6=m],A0{CI~ʖD߻4\ÕY|=':ZKtX(@TCU&;<?H|Qn{tۄɶ剣ݟaRfHndv!*XdƣHWr'(C.Snp7&cCݳ[GؑBSю	&>p!Z l2dJ"F@0}Y)/4ҮlS@+Eֶ?)G#1ʞjL<33y=̂+DLMxkd1jY;h:+r9&V	%ʞ)j%SKSRW
+%%J!4Z=㧌G0M?VLmdpJVfhN3f^.$ֆhSmģPuIXz'ߝ?4lS	pfԎEg?d/rc^ŉ[Յ	e$Z9ƺaRɶ1p2ɼ?(?yuB逺4Dy$'?ۭ]QR
+)4[5I+w_;m-tl̫#CYoYdim/ϣ-.*^D6R8N*x{\[tun%#opr%7B7PE/Z9[8^@\]5)Όa8SCܩ"CL;2^)8O΄3cspN1=*5",,X۹^ њڪ(F5J|7fBlyP4\h>Fj"xT:ŕ B6
+.xݚJE Wd$ux.˼m{ :F*b<c5ϥJr<CNA嶔6lͺv62prBİT%~K5OrGPzVol&UuC
+mb\mv#:%Oy\C`{E.в_\" tI΢yh&jbȶrFSw%ъȆePCȕq3,8<M*,YDo^[JbrM%>mCJT{J?QĳD:<":i.֊l4ظp2huS-܍8tըBҿ:.&qZ	`*L}`]_e1vu:
+ ZJ+V'$'6mqٔ4a?hKC@2о5X:S;ѐeY|K<@"a%_"BUQ4{ʤt*ajwLk^[LW,ā/3Bu8aq[ٚpf\!os7qy]{"MhdVkr\"2aQbȨS5r2C61תgvH$3shj<Gj#iqfd._%A+S1&=@1v*"6a9#WwwX|eu6Jx~=tOl2Ӈ 8/>> md^øb-]25~,Q8S5^g)|DS6G.y[,gzWP38gy~Th@s&Ɩ{AǙ(f5N,ӊȭ?_0};_-05]+魐P_AE}ͳb.6O:=%k	8s)*n2VXU>1ji9=*o1s!>[9SJN74*}%SHVۋ{z%և2f'|s!	oX܉#̜^ںG'i;*h\q;+lA87D,$ߗ{l Ş̘4q+>ުqҾiYMr5x#T};K?b^@2|`Wb!R{y'5	;gPWCkrȬ%qKUbl5pDd??fl\
\ No newline at end of file
@@ -0,0 +1,2 @@
+_6X.2g EY	#|Uj{kTFnU)$Pn93ONi2w26sy0Ls$~2[M){nOv<	;-D&MoLY]Ghy0xT-S^_X
+bHNvli%-԰JDVJsdi2"}OyU[Pp 쒦,g1Q(X,{T"E9,X
\ No newline at end of file
@@ -0,0 +1,4 @@
+[4@F6C8葉~^'wq|Gflosl
+tr^ȥ1naF	O;9-=WB"~\tL*WUݵj8w͞HVUZySy3zd&Y@xiahJR8m X@;<;ǱFˑ>߬\t+C&XM(@F>i61$0)ᔙq	q-##Qlxű9}>Uu	?nJʞbt	QYn}%!L%&;hb][PeBf㖱&Z@.V]G:)8MA⿌qM`';'9v<D3fgQPiTG!A`GNUSaɨ*ciųSl04!'K>H+FV@С2btrbNldFŒ"Eݒ<bX'5?^@O掻.!gsòՊ gJ@@]GeO+7P<(JZo\Ep{YtIӰ5󂆚>-~P@j2!gygІAwB'՝Ne6iiT1ΤS:ڣP-[4AnCپ5ë>5;X|_HS;D,]H_7_깻zޖ+1ZH8DNh96֙'l\b0#t~khp"
+!%qCf^߿\WewO]:IDߌATI5̰>Ui]yg`A%J#Gc?;LuMv9,G]/F{:o`gTâ+-Bf;.äsGGOG'e
+_JJq]O\7K!a"q"8&F
\ No newline at end of file
@@ -0,0 +1,22 @@
+Y0ZK;0Y	פ}M);{<.AWLQ7"qPpxk5 PW	/ͥlL/={N{y_x(*g%_n~F@ٻ
+z}2zl0i~sOE4IR1:r.
+K m~]C1!BNp<=\|r pWl/;L՗X/$I(uR&9?01^Ϋ7[w[GWuo9	bN"
+сox6zmd):]aEs7%"\ur~ƐhшyqDheF6"	\W>3BYqܔBM	W<u3}gR3!`vDg檃BHb?Ȗ`9mfĆJ}iޚj;.@, gb6y! 7Xpԇ΅8GlbyӬd9:"6b8x$ظtX66=U52B_ZQ(VPm.
+0ovaoDp9ZFչ08~?UʥJ=h&jto=`灉>pq4w`[͂R?T-pk m̔'etAs kM^<PN~Lbi}s@.&uV3	q<Z*2˵^a 1*k
+H%RrB#$"cEN@*`b 'eE]YzT雇<<,W(h8g˰骋4CAsu܂!1~k}1j!!CWjFjT+ǭ2GEzFmDzd窎Ηql=yaNq9|G	O`{!wb"0-[B(7tj)_\I:
+
+wKƥF߫y5`ԇfVȓ bb}֜I\- JM}I3~Tk)>͝ҁ>* ɕ*kɉPYgs }6
+{"Jȴ׳+>[-'d`78zjmҺLr[ZBߗmi~VUWyyQkB!m%}mp^kj
+z,>U0Z0G7!Oig
+Jt*ZhJTM&AuLLrf1VWqM輭g%`eDAT$oE=v?!q-OzP|ǉxWMny+|+d.h>pڰ}͛Ŀ2*ww8F8`f%~/ȿzڃ(qV;51Z?0h;KE_ )}/2;DnMȜfKR@bO!৔;{#ⒸS'ޡTFjjDN1;I	%w)!<VfloSh8Iɲ~ mA|c{">$bk\5Ǉ:%ǶA&Ƕx4IT@'Fi
+=T3*`aԄp)Rj@NP:en(ah)I3_/m7Qm}Nse=f4W$ܖSOA;ja{.Fhν)"ˍ
+1R<5,#Րc~/1PeU,5ZZ״.7(f<r#@k 䘾i]8d{.+bĩoWQlTluI9Ea1ARaU="nJ.Lʹ(lak_&0MY$h
+څb&RRѢa`4UHyWfL%6CBJ`ƹB=KvlECkҤh5;J9RLI[i_Te:tuWc[~BRn4XόL?˶S
+'O%?E+D#q7\/e$J;%c\|т"3k<mӬu5(e&2O*d̕E*պO0
+?0CNSWnӝeRy	L\U'\G9q_?f	c7YAHĴ*{h}R{Ie{'S^PS|PL8L%}jPNS-׭ռ b3
+Vd
+\i,Pq:?3ƫ7Xc%ܣR5$XOCvDآޛx-m'mӾGuϬef|h2%ụwa[lgh!Dٺ̇̓,eA%s>WMַu'BTDL*/VX1uūK
+P)ʺl8=#0,*!v9lP5r'>0tis]ƘCԀ(>qί(\y
+Y.e?)h-_\?6+
+j|u9:jGp^t;?bfjYg.*b,Un#bXK#eEsRڱZ7-UʈN~`J?掷2fNeigyp{{0j{)%h^c,D#'*;Ej:3L?P^<awys[b.$ƋװpK*[.R(Y&^YAiKE>1ɾC"9+DmU{Q6@%Е-!vBݸ JϨV{}GkHJn>wCݐ`?ʨuo/Ma}4/T5(IQCĺd]O$w4oNpot2[@ѴBd.2G;ӓBvmG*neQ5PXZ֊}o|7oD5`5OKrЛA\:&3zW!7WQ?"E#MO%h@BrlUAXCZ
+6O!ޯoSVD-||Pr-'t`9biw(]]twia7gG1oӻ>_<F@+㾳ͭ<+24V7(ph9Tn$ᇂ.YzWG:$q?";%>2lٍYPԪN IN[z띟듋@HպӼ<o6Qc|6b L¸=B쌖KB;k$,iB7yWʹjRd	vEn"3VV҉Ml՝c{='&ێwS5.Ņ+؜X`6[~CIMG\LG;)VfrNʤw':Mܿ,V5]z(G-w-Xۋ?>D_#Dk(zY/T'Y6ۑ5W0dpnUQ>GoQ
\ No newline at end of file
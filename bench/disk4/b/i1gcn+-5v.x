@@ -0,0 +1,10 @@
+W'%%_>CFEvPjze;/TmA2B,ʼVu4Qv52ZʦnVlbY՞/Z	͙N^Yᴓ3
+	)Zkmy7P6IܙNf"jD^ya@KxylE`7SOEKrdǩGgΟ(^<jBب<G:(l8Gg|D%k>W"<Ļ荫`rz}|,1?'ju)<y2־y"PZDCx,{9/!^(kmmpo7xGؐn?벅x\:WhL&7>B+{6E$4 P扑i~\R;1amVm|o	js*C6!Mb1Zce{-h1"\R7.VGZ7~lh0jZyIOʎw£1SstzbMׯ<Ľ12pR)?fÌDn#i|Ԧ0}+6$hzE/75#;vt/Bǋp{[oa 3:3e$eJH,sdZ|o1p48Z͈{bJLU!J^I?_:yk, 7Դ#MI:>DK<*c/púyo>G1ЫĖ/U
+acS%ku#LH1+ASH褘+cm	]
+eȈȜCb4}S9e`n[5rsF[ܢYQrn[,b$Y
+IaB
+3PD퍒2ٚ{@ċgF"@j${`⴩񰓽wCSS6),e{`IAi)c$ϢTWM<RA&~X6rd`{1d?Q)d%H	/OeiMI{8	M/]9oO;Up*^dV%.:;I,.2Γ i֞S#C4!H[,׳zQ\}"\׀/tKlA{Xu]TDgx'E|w-:Bj"KpuĚ	A:%n_zՖ'W%vuoK`}tz.U
+}jNvR8Ϙ@ϭxm-`שe+w#s'9o2'QewOGs2W'q(x@۲P¦ݱMkW
+/!y"ȶ)أDɉ&cOKBF]
+16_mݑ	S28͡aXՏ\Θ4N%/&텙J4'p2JWK(ycj%8Pz=D8^1&YF
+@jPI䈶@a\5\̨d'W-'QD88$-WhZx7>eFPrLoz  qxyoiY_CW= Pk|I`O"(	킕)͖NhFx}#;Ԫ@֋5Azfg1
\ No newline at end of file
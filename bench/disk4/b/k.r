@@ -0,0 +1,10 @@
+n(?K+`^yg[hFz*W'Q/8$30&<ͅMZuNMA03:(fJ]
+D"8*nvQ{<3b-M?^!ImխB=BmfLF8sQuD>K<'
+97|liuT{k]~}@4X5+ؠ鄺<yvϯ?0>M"V?e͸Bv
+i:ޝsIQ(o>OZAnv_cW;&aޕW5{&AN"@]rH↭fNcNَ+DlN9(7Z]dXxmW߷͍Jg&Z+gc3{.;.o%M41%܍/#2Æ`퀃fҾnRe-8Pۍ9{c	(LWۈs<ύ66~G+4T85/`NZ"|AuʫfMy
+~Z"<XBafWr1v6n#.LF,J6!oILk<!hEzUw+ GqiŦpnΙ$`JX0V\N*\!
+^mʈT	ܘYOGuFo:DO'{wR+>gL~ƟϞ.T7MBx!̠ݔ(nN>r0xK{4gp`{vI0iA?-!d7k\íU{JHHX!+g	K
+{~
+U*> `|#J=&Jћ㪨	qs )b҈X1U4|@yOw<y<w'0[j[H0B/pNKa	;gUr/2WX=#x
++fUuؓsp?P">Q"Kڟ;N(hXVVOX"	tSXwÊD-p@2;	Nǀ?"+bU!VVcP[yb]%~&d#l@%2]icHq~w8>Х%AIR*RQ!v͗/(*\m^Dw
+ /RmRnuam8SqZKM@/b{)wbՆ=:aϟeHOG;5wfk]lEUCf{7{٢_`ru诐3~'ScJգyPn>a~1+5#p,Xo~cZC~o%R*Rɯ1Vv:zKNobIRaOE!`U&P˪\nݘPqeču&q2cJ"Puޣ۶KG[	XgHkMqt'2<FZcRz8/;A)iF<H82xYejnj=7 ,vKq-|v6t|)nJht=Ԁg2<jĪI'/Ā1W$l{x/wGiB0?T]ZʊvCz"}FZr?ǪOӮf^GZ	W j8Bn+vf#jwuW{_%sM|.E`^J>_"DcbcZyj|MM̟h6[5l,xPcؒS5:X-*9#BghJ/<]n. eWȖCl	fs$V8WByj::k>*R j=ج_}:KgkP;>mGuDQ`Ь+xE٨9VT{ODSETe0Y3Gi.!r	7:snppz>yYz+'AqzFbϾBT+("'XŦ{oa
\ No newline at end of file
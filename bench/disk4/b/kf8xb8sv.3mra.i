@@ -0,0 +1,2 @@
+lڜ0X1p<yw	ŌF3&Ew	l+3آnf:{#}? 8G3^Ib3F"f):`+Oh(+wtOs%lN\*KyڄKmj<qLn7:˷'LL~rZhH*[?Лq]eF^nDoTjAh2²}f>7j:]1l\RxIێ^dR.|"ސљB5?^ '#ΩnSNӃ+1%bu4,iu|>#vf!zk+OF Bf?.+O|QHİ'bþ]AJrԸ̠~>*`HULTM1$A,1Hw|Xօ\#8-#ʂq̬{4!݋7+RƛI,d;L2}{v+:͡wQuR{>,Mʞyw_XQJN8#V:4g泖&"d7FqՑ/4^#Ҥ$!GSA96J6"%ylmE[W##o"eH\݌"nY0yQPT$fP(.K%c{	٦҉ō]Ty;uykG"v&ڻL	ArYx.8x@b
+e3[I྽E~HEǙ3Ri_*`)8fKblw#S;L*<%Z]-t4aRqV5hEyBJ#`v&ʼM!~B+yNo>D$%SK};Ov7๹ZFAKr`Ī"q>>:?FG(G<&UCgh~T]jzNHt|qѕ!xKu5<_؟H1zySY*a~8mőRӾSI uWFo{nkW?6+=:#gs&OFdꗘNڏ蹳w$[:$031#pM"\o~Nֽ@Ϻx>	i0m-gR<',j!nWu묯 0khKN_(>hHތ}/>IR}kFU9AEx@A[f3/ ^q3@/@8m{3H_	bx`_}ѭa9RɀG_U+~H%A9p3KJ%BvxY.Q@=U-SZUsNbUО Й\ێ/'x֖$b9Y
\ No newline at end of file
@@ -0,0 +1,12 @@
+NLUA.H0j*{Z`&KiSȡcxT(<wVzUg]Jg/ȱ@RfGL娐x#A('2>[~3^'h?ݾf"3c/#|ڧ).q_bKVG)_=vsCnɝ2a#MK?FāGs+޶v6zVފ6skI8Q,A}ʷlmVRJmFL2jzܓq 7F5f=DWBD"kv|jq˘xnT3HϬ9?Hi%*RxPfړfD+Di\+<ińwLgC%jjEr|:e-oty4ɮs-,9jێ=nxė|"VgQ#m>iY.%?t-vK^jWJGۥ2DɀZMүjAxSjQvޤ6A?(eSg+԰.O5Ɓ]/
+j.otI"*qJnw)lB#,}ҊX/^0e&F%dǵE)۪ƔUP``ZjY8N(F!^>fޮ|*ʨ0iNoMD;4﯐ekWRT7!pG})σ.fZ:,utj^RƠ>+Aym]PYz]ߖrʿGsaVnf>\f3YyM:v25@n|غ;b%H]GǲQN~wXo:b ~%
+y1kF7@fWocIqI
+2YuZ3PLwLۈ~3wtq~JTJg}OPzC~JVVTrY9KIMٖwh]aIFɑZ9O!zfn
+Yd4S9YJŉ('lyKi:$Xwx [ԅ^ej
+aaɨ;A7$%toԈs3a(N.K%֎|"l3m~Vᆷ\;xcOX
+;԰s?`ݱ_
+vf`w2l*"E@5-a?\bFAΒ6N6\asnPLLgh?d	^lvlFP3PfQC\GؾQժ_	"E}H8qp1ha!K䣖b>LxSr 7*nR9dA\l=x-@b(_󡼝egĲ1DQ&ˋb8iB酁ABMH\5flgvegj9f?r|26e`s?VWNhvJ5>~
+?bKqZ<G-gk9:s2M|}\KAvvmJGKs03'ůq6jPV;ɳ0ޤE*%~"٪tS#4w7K¸Fʵ8|2Ru1Y#tfBZ]}(Ěf;-D4%-NTrp6b º,{"|t
+j޲D|G]VJ'p!t=-5Chg
+}!d2I՜vϱa\@&:&qlpxe܍!Q`J^+B(YDÄ́YSWPbOp貰y&69fSwxPB>FCt!RGD1LcD]HwlG6w0oEgpmd-8lL̴c_9>LѮ<:]~Wm7͌t6H2އx1GServRQu!vD!x+&T_PR=@
+g6);>
\ No newline at end of file
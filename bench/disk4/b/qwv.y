@@ -0,0 +1,12 @@
+Z[͡;5jЍJd7wG[-Cw/8TN<Ty!YUJ-	:Ji*_ww
+:;}6Jx
+LĐl9<Za@dDϰe=y?Q: Y>߀nNd}-[a|hwdeOfSSUƃ7JBq 'KwȦvⴅ|vI2:r**(9[i*yѹRw"89z)PT>)؋9U\U.yh-4)YOTu^nԂqax/buތc5Сؠ2yL$z2l(=^iu'7|DEr	D`ΥYwyHt8M}wɕmѿ;gLTdwY0\i_tEnu-U;RGF-.I"C+)K7#QC^s,MJb%T[-<Jr`w	"(M{q즞L}Ht[%}BoZ\V{>qORr*S0	%>XJƒ
+iF>2#0dZ:
+I{sfF۽<4H!oWAD+\iqXJL}| Qgeٓ8r764w2 /M3FI,p4d^,owrb:TUbpVh[}<-M8D[QqF?Z3ADn~pE^эwMk9֡lHlLڛ$h82we0ދĵ.g~v0|xWP3|+gx7[j:A\邥,{q5s-b ;3.Pi$`jv$y̏LhdVronX"X2'e^TPָ9)bYrJPKɣ!³J@`I&	}٧%c{]8e˻,dk5j@Bk4H]m-U"zzO0]ݴJI3*#m۫~)z
+i4o6-bPHIc+M1lʂ	Yzd"W'u V%{wwiQ$ofw6:8Vgu6~Tը^SEe,#ϋn$B#~q]; W1V5#ms&"@*^CYt-rPA_u@KVh4:E[l6	fuu-k[!EJ]'1nR	V[dULɦR#ߒE4*!AƎd$Ԙu')X 'neA	Dl[ŷ)8%)#{x.h$\:Yeg&xY@#:(9m*ORܺ+VIrMYg
+Ci$ ͕`@XuD)snmXb"$qhcĝq/EM_K@'#Tև{1ւmG5\٦@pciLϖRN4p[2`x@Z8肓ۂ;q@PI//&1G.Ωsy0$P_E,*+r{CCk:T{xcIY0#/豣Mb{MNDl﷊OYUᆄxe8=yƣ>`X߂v𰚨yKԔj*!Ĭ,6JUEm/-Aшb<TH}mm<VdWrnJ0M4ښpB`o,<$$|i
+RɏC(3#U*)GKN4k[JdmoVZhʹJ̱4EQpv*n!K?Q/ eꈄC8Df ^&ًb^+nY	w7'c<fKFχZZoW6wܙI*2pN9Y7B|t=&+iȸblp\n5GX
+Vbk`Zs4bZ~4=Ԏ|Ӕ%5u0tm=p0m8]KW7</<|"o>rՕ13cc;jq5#8hsr[!kpKFr[ZiA!{a1%LNRSܹ!A~"k5j9cr$Ir\^.hB&mEP L{:."|6N1ь`wyݙӎ>yaЋIj2gcw:v:d	lLj'X-<Պ|[K,°M/d cgP"wHiA#OHo<-^^ͨ;so5A?ZUO92$HNaL)"Yo8:nHI;Hkk(TSG|>9U7.Og?F	{@|-k7IN+i\*J$MDKJ|_b@*:aC-z`av3`rbLbњ5T_G܇gVJSE'R|QJyxP݊厐Dg:]=Izq.QP+h.A²_fgb{Rd;oDqDN#:}X	EhCA됹ߥ?npྱ%]3g
+RUC-WVJ<#J1loҗe]8ѰB]?ZDE-'Skl&e{G\lx2v#SхJz%{6m5N׃_
+rxgzoiA@Gx=	k=ZgQop$uf)^܎ 5ixx-w;F@Mde`'$$&kw83Z[_/Hgm5}YIMB09TeUVKϻ gbCyjEE,%9]9_BUyIX~WtԜN,\XF|C 	>þGi×--hn^x0;ao6跚eB޴E_bh~P}3=>.=R+pCUĬ,7!WCɈ+0o{8,G[AvuSt+O;@;]۫|AtsAlS_+"ҶX"Aw.~o}LLcsA%/E2l;=-QI|%ŋwKMh3=q$=
+<FܐSJqxX-u QD:?D$e)՞]/l u|8qrw&2KxbHiQy^^cN#?PV+nHqstf}RGWȾfv5-z:v#[DNkIK5
\ No newline at end of file
@@ -0,0 +1,2 @@
+OSMo(QܾBܣÖQ#_E5㎝w'%H꼱je:V^'q|4FV_yO|m.vzzuf5*MAlE"@RݮO6ruMtZQTg۲pV$uuMr*X&EAPUI<:F씻hԹ-d|V+=%f&0be65:
+PbtA-j29햼MVeE9:@$]:^T?)9`rF2[¤U%~B).8"8U_(}1DfTx0q5*R+Ƥ;~+;_.I#m<Э."{š,TSV9i	#5L}_4W5'/S`>Ĳ8H}MJD<]83q_LKJ9f*re<u|z;DKFR@ʷȳM6Bޓ;eIj3%;w4c[CUtb`)V~Ξ3*$U.2JͤFb6ImC2MTo-?I]Wm[	2I|XW<3+o715lnŵT`Cejd'P1F䌎J52(hYBZc7SB
\ No newline at end of file
@@ -0,0 +1,8 @@
+O[Wμ>f[+؃62xp+ P2#H/͌֫dgY䏢n\O!>I;?8d.~A]ޓ?6
+)sj*9n\Χ.@\JJo_\O]L0Gfus~(MS	O"FQYM3`Fn%P<x^t8KS{Ρ)ڋWé`() WG4z_Қ`h@3mX}}uOk炒bЁ`)v{qtaޝR_W2tӽvbaQ;o'ZU0;!55"PHlH8d!oe+c!Dn	`s"+S@pu_6k(pq7pe zDlo'gКPUEla!5Upu%QM7$rh}'p0PṰ׳c{f3OMTUN-
+@bTem	+2ŢI_YZ|2RmH=nooqz\ŷhuGQ\ ;kEظ{IYJs{z+ׁxҌ~vss-޽HU,`XqO(Y*>psiq;$ZysHQ0bV
+=BHcqeM{2Z,*=.V.qւgXL-ʍ8H;쓛vhloM7s!D9ǌZ?bS=/tyq4zh{J91m<+P{mCIXBaw%\ b~95RR䠵A^i/4'A}Fq7ȧ<3E:t}ב)$͋fJ%yxbc0G
+SP>	8fC`Z]x2xݽSvrBD'c9Yw\Ts/&Z)'P"خaX<WQoݣ7T&kd
+dr5,H}3a=Ǚc&eH $=|'Gz[Nϟ4Ђ%"M".>!BbMgOg'T&BRT)fOc1Չ80~*G=_}u2)2@M\Zh2 lsKds=,8Y֩`?dEBHjrBV^nNNO8f-pZp<P7{cHbV~Cטڃ޵ºD/b6Chj:ˤQ]io'<+AK|^\eA]d3*zOdY8/`rtw$aD#+_-Τz8mn/b2i_mG1	%z|e͆_Cu,H[VO~\[ /E6z`LpW.|W(0h^Dx2x[6	,ĄCd|wZ߷{;Vqa$>V6C|+g	 x -
+~ESd!CJ[3{~(lнl­4wuCsk;X 4/f5zs<3*"@⏣ܣGrGD)NGL蓪mJLIr(DU=ԚX\ˌbC^ɨNOQߴ1ZMd^ټ'xl(m{veMoJM*XA\_UզЉ4&Ȱt5X5.4vv\t.<y!E<W$qG1Dd}_C1wy
+vV	z9RJ㚉;}@gBzI}(ZNed(f!Ū<k	=S@PCO'vYe	/xJR|xY3yBW~6<GzT\ F~oy$Np6Hȡīob)X|.	A;oLn>1s7Qffv`8Ǘ: ##xG+)(pޘcYn}MN ]%KaT&%֒sɊF}&k9E%lCOrYIhwM&mʴHιz"I6vGOCFWӊ
\ No newline at end of file
@@ -0,0 +1,10 @@
+tDl6YqA42aaj4_(_^nk7"Ҿ(Cݵ'kwJL(y̎NDYJwNe
+eW"9PB\pq؊.Z=!E?8&*|fsRwhJS6_4.uievDb,	yT6)F7}RDL(]^P=;i45ܗN'&-*SL5{zJ`=ArDIDe FܯMgiտ7Hf;; qS$Kj{=W:(8;Ao½w^4"ǿ^s1*z6X 57]%\n5pm*,ظrI.oxjFʒaYPQ:|x</].IGz6ldqy,6/]kQWڒ)OS"r01synr;e9!q#@HF!|TM#}&c+SEt hhnVoǂȸfAVڞA!LJ&}Oz 5`H(n+'&&lof0m)nzo_aV@ګlY|2zgF I0͖<frBYfEsZ&!J)0#J'G/6E-pl(8ҶY4@S?ZTW\>*3ഺԿSK(E8&>R0;@dx\:B(X{ٸz)j15œGoz$|tX"O+cك)U5kyoh0Ev!"({h.CNᮡ[ٱҍDRNrC.6W;F}ECbte[Fewbe5Xl:iZ5՚^'㺐Ho>8ʫ;la*?읠#aE3uU	xs[!<]<f9pU-a
+8$k4Nf/!|M;55DǧN~K$Gxvc~q)1gkl|#U-mGͩެ+2#|6iLE<9zU(QWסU,vR!E<WxztaFPCxȠ4ce7cy'-t6SsA>0&&JC$I4X\Llt\tHjwd	KcPF\C:N˦݊d(fGf6 Ws>TLPdE0jN2f0']4fnMvwx$,
+=>MGPɭ_ǉTSM9"<cPjV/5E:39Q9ݯ.&B^M+3v١"sN)j`CFmԝ v_L>zMqIx-1_J
+R3͊17qRR<":uM85O!M|ؿFfbRڋ^t\R0"|=^kk<M`W8nsͧ~e%:fqL$CɎxֳvdn,+_Z]zWCD
+cy3	ɏbkK(iH=2/UH-RnK+M9ހ45zn	2s".X֯y˱xVуHHl3Ý=)rQT~ʈP\T|o/>Eտ#蟼Ux\s5Xym*/st{yrRk\Do9hM/D;
+ےm7YVJt0IK2wq?'t5 jv1;LEe@?$D@]H}\zOe6.#k{06m4^Wv+;Ǒ~jEE켢lO[r{HH.yt t&XyaD:}qlAqrWN0eS]Oruil;oӓ"V%drslܖ	r$ܤ2h$Qv43;^7>|A-*QE>=zDL{|H|	D6BKǸ=Rȉ7	;FA߮-d+;qUN)-	\Gjw2ᛧpխک#ڲH uM@G$Kw8KgMx]/?;f]s?#,SrKS6!o(ڠִmm+*b:<MI3$ІR2&FZXFrn&u[lΏ-n-a	2.n0FQL>_@!{`˅>G+lY#g\L5}aB6/3)?ǱҙҟZE5hQkc'Ө&.QN^U"݄b%p^K!d\f9h>/7x"R)0vr:$BMKkxuYA&-M)mȡ2XAD
+3zg4`6QfR!Lva\	S]~WLmnf<K14`L4%&tjN!Z]Nq4?oM^hz~I}sSGCsFûS\4̮[7($9r`ЮABGuZB@]Rl~4ı\CFVJ+mpX[Q:h~nP~{V7q",t`OJړXYŴ#2,:e?iDBl&s*-bc($Ag'K=ڄ(yjHͮМM:b%KCҨ@;ߧQ/zu(.w~MٽSO?WM!ΪO01PΈE~i׷ZKxtUI4Z,Gw	2[Q]5v8r y"&J|nxcCغ\5mZa` fݗ3ɟHcRפL78˃F-JSnCa^P5ibijja*Rn)wkLf<ѫKތe>еE`S+Z
+_μC%=eCo3'ӸWOAT*ru|wrS3Hdt<Foڰ_nW]zY-8Ә1]sٌDu{A3褾&T0)O[qI}"=!8NӐ@ۉ0ͤ$
+'}|+5B#m"fEִ~׬u}"0|'ux<7+<V*zu;t91/R$yf-6,&<NLpLOS[4C~+p<0q\CsxmTFenӖ_ڙa`Yؠ?RRMK&_mŬH6`X:ZЧ\i;&4y	AU7V
\ No newline at end of file
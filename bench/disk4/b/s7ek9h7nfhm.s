@@ -0,0 +1,3 @@
+{ΚwyJ*'?PZ#4FifHŔv
+e4qyrGJ	n!]uXNf{~BZYI	G{
+}3^h3ib/@#CҸ1{~1UzghrcOdf*gz
\ No newline at end of file
@@ -0,0 +1,13 @@
+ɵk9vNc~"O^,nKXv;_
+cBY*Nc\ZOprCκ,ĕ}u<io*b0
+Eήèl69kԶD#*E64$H[DYw~
+axi/0^^Jo7B'%e9\Hz:0!G@U|0	 Ę"dzzèx|I~1F;;w{ldC5+#mBxUjhW#59`f-OfZse9#Eeو[R4*;ҋQ}#Wۧ}
+>&P}ĵB.U]HE+9l%ƒ~xN7z^BV_̀Q\c-"UnonԣOꎀ;ؼAѬ53J'@c(	*Z;~v*lW=QUut5~<5kc6$ZptԽ][OfgCW2UJP(^갧.'0c#G˧2? !@_mpQ>zG?RD?xlc,;6{sTs)+l,浼*+b+Xbou߲`s	4@ڶӌKKmEq	>anA_Ev[P)NO!VT]E5_bF;7C_Bˁͽ$VFcXߵ}l,A̙55YX{hIlG_ތ t]@Z[_!'J;U
+(T3r-e$ӵ~1:0ddtbJ9To2{i;NQ@d/<	0R3nBHJ=p33wlAUxWӠݞE/͟DL-r~yt m2`sFSU7`%1h&e6
+QX8.E`5E'x^ҦLidp<D]ǻwjxK6tEGl,?|®0Cr8I+Z#}52˿}ZL{i>~=;i	j^1+R}9Tma
+rmKxk`:'eV;
+;B<jhd{,X!P\= Kͬ~&5l<mA[$]tL"X@PD|f]BZ[>d!ٔvהiU~wB.hz)2©_rD	 ߺO J{xC^)C(!e日!Ft)%/9>c}#^:MZ|R[ycċJuXQht	u`$//jb8;hBHh3<jR3^]Jrئ^z`?y$\4PBtvmEK+8dmߵU5E^HR73~bq-:K$Q5c̎Td\R~w^%-dgYT[`*wSi|`ҝ=y7B[#ݘ穑]nۓAw.sF"6r	Պ rs|t%C(wDR8KkybLMoF;(ek[	N&v҄IKUgP{U3oVe)M_5ޒPOdMi;:C^9EmC0wZ8fT^ǍpR"0+G^㖹Õ[8.<*MxhM==0	'PBkЧ}!Dk8釘uݦ~i6g#	C]C/2:	"vqBL5b:)_Q9<nJVnP(^bEp=ns+u {Zxw{VA^]:`7OW *l)6$fyBOMz].XIzCҤJNfI
+7ӨF^;ˑu;
+Cjsw/Oβ:k}d^1
+ߡ!^-Ռ|R0OrȌA{-0m\FMa3,W)dɎwydW8V"۠I6Qضeg)7u48,kmj3:dݜ?)P!3&/ijA_DN<RʗMgm_Jo#20Q"{diJECz2ԛ\`E G_2vۭ55
+/+(ӯAnc`l(fZ|I%K2 ktTŁ`z*ICs7#ǚ"%hKARCxk_mmo|ۡ27oNr~Cyeʛ'dEE.z˟zuIp19TEt7eٙVf[=)*ͼ]dom;uN$?P)xwUHNi؀skqk
\ No newline at end of file
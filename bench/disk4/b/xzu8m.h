@@ -0,0 +1,4 @@
+Կq7WĀլCaj0pge|
+L+Ztd|L~1d`&o{i'$@DhvE(1IPA2|s*|ו<rh|S콛k$oZfFJHLܲSm-rXl>Ѻv!Nr#WjBl*QoWo$b];Ucnaa`Tc-s3z.Zr`s'ABN8""	7<92Qk¬x
+N.$wf	U74&-{$* hOhn\F'L}H1DQQΉљlx=F6&޹>ijNqtfT8[A=[t7ʎ/h>$OGJ%!Dy/#gyERA̶Lx;Muf%lTli,h]01x+G4X!M]sw5b e0^	*?@\	EcRT*@nÝe N[o7miLH{{UbS.VT`Hļ 6JJBSGrD	aXl;z{
+<|M
\ No newline at end of file
@@ -0,0 +1,16 @@
+1i^c-"^awy"4jO>.v"UndU1c*ypJ>6d`	g=fz"U[r%O]u%ZM(ίٛUxߵjZ 7@ϔ'r]U`M@}:kk,h)k]_!qюٓ(_Nt<Ps&"0$SmK]/CS-Q[Jy|ۧ#@AklpMdϻxj@mqg:FvYy<}*[r*K^6KV=Gm$ox
+RBwFXmu,׉(QvZ*v{7
+_kgxveR<iѱI/1} 4g;2F:(QP_xѶY;?WX0\c\
+s4nբsŇi{eO5 =!Iim [TެeF?˵ ~d/hxI9 ʆ?P)/| -+qSX&oFoy4zߝG`H	W$g/m!=z;͊X~Yў0TU;L{ڨzKeEQ6dcA
+ljPD/bH4|t"{v{(b4{3pҵԜLbhTPqy3W{U*B.bɅI!ek[g&tm՝jJu0_D^4c98x	"f8YVl:llobL}0ӵo7E|8Nb']Fϭ2P7qL
+̓Z k"+ka=U) gwX/[\,-t8Cg7mMүx&G̲1AZlq8C<bj/wQR[.c"3g:12sCtqxIRU8F3W13 u[W0@ڠ:|Y=5@t~ޏ_4i׬ڷ]?|਺>|E%{*='g_PY0H+{>za][r{9&ō505O͢JkklYKif[$,LTZSڂ4^jaaܨw`g@8G٢h*y툤Of:oZ\C]	4uyפtƢ:H5
+Zz_w([5.Uthu`Iݾ]6Q'w<hjm.@YkВ#oɫLx3v_oT
+C!;m19}V)\4ox$`2&.C`2I)G2V7^G؄)Aj כ2)8|eSŬ]
+/ǔ*T[NI+s"QB!&ޞ̞;I/-4Ȩt,/Vn`K=qW;\^-]0嫝|o9%D&i{rrV_vݯ^_Owq9(~v/.]D7Χ(7S2cX4 6vE}oa?,Q`D$pVAmK,'UElvyؕX>s()g2̵:Tg_EDqGcf+ P@#*ﷲfgGؔZ\_+:D(ܒ9)Y3'NDA$LX!	$N*~@OH%$YMyGVʄT֒#>Ib'CI*P6Ê1U{*P^)jϷr_Z܃℠"9jq/ىv#pIz+b
+1UX$Pw֌4e̡9b?ԕ2&G_7l0t̥,:g;pudwXS-dj^Lꌘ#/g.K'|m@!T%]p*ȵٯ^=RE6~DAaR
+ U*mlk=)%J̿1YkeIUQh|^ILHy/}ؘPi>*^YhR/ˑ7I%N@@eIk_ckE^$'O&
+`_xў(޺\ #P2am\d+B.s.)2]n)31F%SaJ%gШ'ѨU%GMfc]_(kҨ|&4晼kEM%+&79ZXNIseKdK#$b)I
+=I¡+:5j"pvf!"ˮP=5)ܰ><<NHN`d-m5)~j1bgL	^L~&g/)-PTbR&I؃Hu+TD,9G$'NL["XyK)i~0R!yyh>m_1!,Oį|bDFm`BEA5ߋ= nk8>QК)Jc17]0E)ӻFPV5΅I*gl]P3X7PYi&&T2S+%"JtIJcI8HRu{&٦TRC\gAE,u0C_XAz[r&{1;Hjկ5)m .uzXrIyEֺs'dYѤDa,M4+]AD"(wB_tȂRڣ`ZW
+k'Jp>`%;n}3w)n&^.Vj qc՗<
+-cCR5C1\ζ~]zm+:o(<XTTG5mlUoJI+nRySU%?tXc%KBb-[E׫!pv_xsֳ!.oW˦E\o&_g':[Bqs!Kiix)>"li_@_rKf-)$-(o~ܽ*RReCp'0J_`ЏF9s񃋜	@A'
+5|'ð_~7(bcfyQNHgxN?.D)	~f X~Ɩ;W81},ZqN9[1;]z^V5_[/#J#/\ْDTܑ<'5qVZnӍ6
\ No newline at end of file
@@ -0,0 +1,3 @@
+^$MWc`	t+X=9SSC5p@0WJVbX1|빤oWYz=h|Į&㒁8l|yk7+GjvnN\w~mɻ!4]Xffh zI
+DdkYPǚGiO s&f
+`"h5lkRkJ8qoŴߖsI!j ;iլ=鴘؄cs8V>CI!o!{J܅e)ObiyFuѢR
\ No newline at end of file
@@ -0,0 +1,5 @@
+hJM+MϘRl8`Iy]by,|{ʷr`𰥣vv<[sZPC0p0`O%<Vv_z}=ju-.|Uo4@,GbVD(=yѧk>jb7U~LȎ]nprA/}USFjAֲFXG!JSjY=NlDZQkG	{lg9VQ
+W"5x :1mmYg^^ý%b/^3ˠ41|FRPp"Z`vMzXA@8֥Κ"U8ky~XB.0HW8aonW(憑'tfF
+P#S=>NBԦa_<jsç)]1@j'[@BR.kI3Pȴ.x~Jo5hN~^	V(LR|(	ucc
+EU²12eMFu~BjK,Psһry*Iu"ׇ΃uK<;~}.}~ē7#ي;cu{B8(K׹cjn;j8x}8nqIL9&
++#18s&'rf|hu<dyYFne%S&E$svCHM;TʆBvwڨŔʰEܿr+h!Iz5C(|TjL*ulUFaߴcoLȏ7)9c;%s<"=VF36]V#]wnPukHA.<ldX 1G[Jh1F;QX;'hV=d2N;,/NDZ!e 8t7Sӯ߯h6>BXG6Z
\ No newline at end of file
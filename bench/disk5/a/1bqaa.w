@@ -0,0 +1,12 @@
+6!v$Lv;B#X~KIb(,CwS +XwsysL]Q:)0|C;~c񑣱!Bqw-HHU?Xߺ4>3u9ѿaYfR|cDASpQtbپU]L\L>	\l]@1 f(CEVQ$o5}e}۽Rtnl8ʶԿҝOԁ2*S5pN^Y{2;J|ZJO";i[,1/=Q.\4i!K	cAXh9G w<4~%ic#nrR2QQuK>]hL^&',rŪሓ(<htݐ'AT:%@Ҭ2;%d/`"Y6*n|Y4okGDݝ&ٗbV]rB93fKvf"XUT{XTȁ)Q
+@x]g<A_@^_&!Ұ;=cGH1yE%CࢍKק~;{fLSV/y3a<vG;NlSɝvm;)RQmԄy94I*TÝ ͗)85G6hkM%23<_ S٤eyXZSwdo=AvK/hk&̓/%l3x,u"T[]<Ec>697i1mss\.uPw[0{LEhuV?q|
+*=#B _I\@GMHdX A!zq{ي"Ëʦ)_UGRFECͬV&zɽ&4KhHݾgʩHxBPeAʭd\=S]~+{!q%g@7ҽ'~AlLP%$>;X@ XAncd7#r-]oQ\y#	־Z^ 1AX0јC,`BReͲEҟS+)y.R3aaD^5;pzT|WjLX}h勱еNo`,?QjM<aSVoåf{?n?v3bba{pOb>!es4u<RJk'(wQ;̭vV@i$}	<ַ2ĨM۵{bHR4}(E;RV['5.pDJ!Iqv}'øo|u?~0^!o
+V+4hrA/,=`x!U5_YAq&rbHiȌz{t|NQ/Tѱ\mc.;*	By"GQ OY$MK$:m$plsgݛCXy?C Ptdr/nI%#hq|m/{h.*(K3T/e7k}.m䴲(#{@a}%'b]}	IN0;[OL_KLDv}YA:{^.U:S}sP;kCѺx*}Y
+$h+|
+,Kub-Kb91^ehW<qٮ<q>k['42%,}9_9J2qGM)Kxo 
+?=j3I#A*Њosdgx#zQ@{/ri%eӰ+
+Z>tf"/{z3mSHQaόnص4izOyj^#Qi&iM3lm?gxoA",~l6g#~N UvA30ސ{4!ݟ	@4meb0,yn8F!7:Sg7;H5HG:x4$"$̩1HSr
+/,q.FoW8tLi`&[][vBVc@(o2a;0tyX&>86s7@;=sCsJmF{D~Y'<~2kqtY17xmS$<Lc#Nxp@Q|PV>TKcHV9Xk?č`Af-cae!D~%tJzP6;gpUm|[ݨ{NfHY^&CDd9#>XQv;nX%LXA
+Jx!VĨL|qFPyC0ap
+C</?Wc{dVvbb+qAK^mUR]2,uWRhڭJ&4nR:反\f*}^=fX[֟0f.ۘ~ {q,$m[dюcgD^y<eǦt'{B2yDuلh6 {}OxPCSc7Mi@[mONDM(TN"aSP+*Fs227JaۻeA7z՜o8^oM:8Psع
+uB̅TJGLrϢR+'cS{WzX({=K?cDJJRI
\ No newline at end of file
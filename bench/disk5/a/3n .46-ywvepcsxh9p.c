@@ -0,0 +1,5 @@
+bTqz;rJPuCjCR%<l6\Mf ߴнT#2a@zTW$>5r)A㽹`OQْ[7%Ǩ@Bߏo^B5JcsEG͘]cRZ+:{u/J1=z?W-'V%guAqAl`wVŎ)ґ(l6616L	\eB3؛h'9/@(Bѹ<+Ee-ia>9YZ/?O3ZFZz_ᤰHS(yEcSH'[f$WYA *mva7²Fn<>whjR6y9t1b@.dқOLcYˋØ7v3: D%ܓRe,R*NݛuG^u>'4T\&:=k>9Egv {~5eG{=A*Yx]cH%a5&}DIÖ-Fv!nbK
+C:>"/n&.w=e⹂P^	b&,I./>nfhܕqŭ#2<la%F90 &3+ynWؾwhu}?>4Q媞PՈmޜe2'7\0`7_F}u'N-#ܠf"T.cO,"Htz!h}%<)W=@?B+]vQ.k, H=ǫAzZt@ɂ"v?~
+aMfuR}^B:sJ%]d.WrŎ=E*|RP)kD?0'H	[`[׃[ ;hs8n|{< XvFeu3.a~i|e[..йd:w ###Z%=s	yV!N6	z5=2נ4^և	vVb[3эTs?|2~ ޞsKNBihX64JQ7]=SS╆0a5j'd`_1jZJ'}x+:)z"2GqX8bq	J6')WfP}V浰~ѡ
+:}h^^aBtI.ֈuj9ٳTbMJ._wV[]ښ/<ߋ}S2}<9~;Y4HP$4fH5lP]#hOT%3͆_&C(;C^0bGH?4
+Gxo@bIz!u{ؼtת4(K.=痏[%Zt.bP0L7Fpl5{VDWBh;;&w*v..HڪNٹa!1j^/;/mN=<,\TgȒI,!#eF&9%@Gq({NM@F*RېISS_`[}eOWL{W!T#ے_ɧ+n.~XmghצmN:,Oana(N6sS×`W{`)㿜hb'Hӓ`>ۃyd	\fOTBIaD*w?~َCiMpZ80km|O9j`B}շ.Exj l]B+8V6Qy5 9})mƟyϥ)fK;Tcz\$s~Ҙ\;~4I<Q'^Z鈸x
\ No newline at end of file
@@ -0,0 +1,9 @@
+Y0^B0Aygxw	Ѡ(3~n&"Zbd[Po
+&xݰfC^Nr&cR=pE4ڋtf3ΥX4%G%h?+Ls:8yvZ+pRKQĞ\?km!7tSL[`QIn׾TxQa$R2m%k!T('??#/.WVq&+&=1FIS&54y(3QXɥt?UAQ,gN~]Ap?${L3Eԭi$hEW<Ob^.DϱB,d7drd#v*tsV3̨,Lۀu]EX`R	䆟h\4gDHZTYElכ5htF\RߨaTHh	l}zƲjO
+o?d1`ڱ@;-,'owM$I&TB#2瞏.j`(Wm('sPyd:BCz3:IDh-I.:JvQ|ܦ<"άolCK}-ڶWJ|gѭCRP4CqvUF_G>,~kڡ*$)5c{7?rr&֐<uY᭠27Wcażc?&uUm_'/?.Þu4[`0DՂɌ2lcʁ_c=-3	֌,I]!LVT*ⶭ~fKS*AbNm8xi]uvB#R⅔ಯĳ`.wVvSȅ"Ni.f6"dr?V,R(Y*vj4oʉu.gvל?y1zsaJamt$^t.e
+C
+,12m7gM
+c-3dɞ9!39xњb+|NE48[y=>,6:|5ϗF2rd;&k=>C	 r$KVv[&23eCe[875&JZ:	$>\UX]233fΈ)KH	T!og 唗ɨa삸],Flk`7Ś
+$`b*~6Gл+bfi8 WT	^U&[`bFC+V\]e1ySAwx&hLcj";2FD¦`Y3+.t9NʓSk4O]2O&GAl<#iiXH#n"3YzֽZ[tmvѕ=Yv$FNzTp@flr7!M٪:^G5Tw2*>в6#ߨm$εInz]D^E9nĪLpD;BK"F{m7	[h?|os#Q{OZ^-#Ko9կ4ݸyXoD@A.gLg%3/4Sbd=8pn}!63R;TʌMk)c>_!b\C+~n']?@,Mf(DhZ60z1ۃ)eM,A	Bӥ]H3º2^UTu#e_	Fc*t@]""De8m\-Z/ɩ@ku~wBy㫛o۔"FֳRhZVX6o+ߣ7ɺAm¸(!mB'^g%#)ҒiQ7xpuH5HRsRwQq2殏ZV#K8:@[-[D'7_3yzUGV˱rkvqD@`Ǯ| 2?۠r[r'+=yɃg1F؏ǹR~_c4=AuHbAW&^͢kjF6y"9]Sѡi"M=nA߸~ÅB";sл-T&W@\BIqOe;;0s.nQa;7(	D杖'ԔHVdwLx؃nǫ7&̐i+RC-w-"%@Nb;r@8p6=s1aE+YkgDsiM(	b*5+pKGɎ(YiaIqQB~⓳a;s9F~#@IYi)-73yq;1x]K^a_CӘmws~dU@\Oq巊9jGm"2s@̱ųj,UUm	l^yc1Do-0v)Fȋ!JI(F(R#-8	exx6
+{K8}N_JվgT.VVJL,Ystx'$p3qwm#cu9R$T_MPCvCd6MFJ];ε-T@U:~hhEתv
+ށu랰tL.df
\ No newline at end of file
@@ -0,0 +1,13 @@
+9(bXMDOZڧ1um&	=<ȫJy5E{eM0&5o0t5ЮUQ/1}XI&D=!;	.|=a[HbL_m_ɳ9w|?L]`;<fc
+jSQxח3e>|=|Ft^N
+%i<."'!f9=*QFİ3Y5J6r2Dh3hhO+5s9MBIvVwzîm#\Ҍѹ:Wj=.`FTsO˕B{#.V.|3"Zņ:TWնG9]Wz߯x4f-?C1^q,5%'i15qJ	2AnUPԪKU<y5$h=.+K1v9_X:η'MZ\7(ρz<F$fX:	j|mrF@a;1${x-UT@-Z|MލK#7ќjFaZ<epF{Kp[3H0ҙ恀]jgNրG:#^ZGu {ZTECt9}cf	rEY̼~ү`"
+hSn8Εw"0If5sYwcU:wskZNغ2F(wڄ=]U0YmRNx%|Qb,^KO$
+=`KnF/vK钋7u\6/a4$-WdGHkĢz3'lǶd~I)gMs_w{W[Kخ^Ou+?+q,tݹ兞"ﺽXe"֡3Ekwiis)2ˏn
+GSR1IGؗMTowCsj7N8ֱr0UCcGX'|\+sMTD9@sc1$ј2FƲf
+B{+"war\>ʱ>~1wCPd`v15,H$ie5ObMI1@IhbS7e!+^mZ15lRiŹ4"	a07Rs~`&
+S0u%KLzjHm$)Z*q^`RV7E[Ciˇ`uke2wkvO@Wn:4ZcCcQZYB
+ &ƕ=z+{bYXi0G1y>Nb#Slk{-҅ t_4K6Ϲ/Nu0`)+˦-fń,
+8aVzA^_s)hm(LbWޠ]drdĞZLݜfXw&שYryZ2w33yLGžr5|;U
+X˄6LDykd#)/AnM%Հ$;#. nG6%]+*r`AjFu6NovFH1
+$t'ˆdث/^nqπdTL`՟xʧ^l^4'QA~s
+7w0*Co/M=yȁe!'SAuKJy7D9Uy4;#E6mX|̥U7+As`5KgN0-܌̬ƄܤXY)@IJ8Q7O$׏׸|W>G[ilߵ9q	%qweCϨj	PzIK<إxVx1sNNvnk/
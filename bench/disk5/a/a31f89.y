@@ -0,0 +1,16 @@
+|4&\swt{U:PtOf"~C	e;d4rnpoNZդޞܭhN1-I$,ԣSTzT&:g\$dK	Zg!-eҚQ_MIUޝة\SA(U`3%\wp[8V{0.;ѭ!ʶ6-zrI#P^]]!"][µRÐCXrU'YKm6@7*?E|2/%j]6/\œ{=R)isTeHBp	A!Jl$Y[ڐWԮ;F&TD{uCLj{sϷ_GxmAA5W!m4s-78\;'L<GCgw9\ׂT=Uz=̝xd7:݈=+QUir7{,7޾%(;8>mLឞޤ<Pkf<}5hq-RN>^*V1oq`$.[-U*Qĥ(&4agnebk!ojۇ;a7y1Hg\d;$wuaGɍuE).w圬+bf0uj\WU[bs2/f[ޥX,G!}R	h+ItQcAr*0
+&M K=
+%e%KP֭v~f޶BaBz,0y!*uʡ&!.L],_ޔc˛_#Rĉs`bFv
+:8ydCUo-]L|9qN+ŷ7ȱ*ȫ		Џ&*ْ %md@\-P!/"h1.?F%9N/QIE3@W2% AO{<adl(v&VrZ9L(KXjyX8h2S+Y%UI,s~k.k/Kz z &G-?4p<C=2/,A K[_Z ].TGmb*ea1;cg1F!t5d#K"C+hּSFdPV)*(m$,j0̡h"DI%ΰw-=E6-(
+ڳ*ݰna_.ty~X@o>YUwQ@PQ5bRv lV޵f$-kǧᤀQ*jD#P8aYycC;:K:fNUOLG.w 5ۢlNfrUͻ=cUR.jG<.?`񥕮ZAֶ&Y0|ZQ<'D9r}6h7L0@H-kћxz<qT*ID@cZip_i"ކw6|/Ĉbzo,Ko8}!eY
+ js,a8Q~Tk2.K5s=f"czcʵ7dϕ#ܿ$#{6T4{qͣ dHJg
+$zeo[͆ǡٖ_ޮzOPcmr{|h(= D-F\sKՑ	\&ՄL'\rV-%uH;6Mrn!!<%Y3)Lx?IX	CVzܗ1jw,lY̈́w+R_q?}G3PCuj~y	T=m{fXM#vQ~{\U،q{ݰ_?:)@o>}mg	Xѱs:dP+2Y0)9&G<m\o%ݥ@jD/IO@pN%pjǈ7nI=GA.f5d5	I_%KADfZizSqs9<&
+/okyuwrEx`o6/x9[FiŭTuW'[Ȍ%brfݗ{0/o滂a+t뽰$#`5"+Q8nctA9#AdY;
+Mٕmq3(Au1sxܞ):Q&ZFDAVYxdMz}
+\F;7|@p/OEU#LqrFj[地ȣѰ$~Q,ffM?ޘ#)3##Ý.e*`ah/Pn 0^e9V	hX]*8JVEm- <!<6iz Sz;wڀCYg`Igai{iuJjr|/ښuRnR.TY	OsZ(<n$JԠ冝嘙
+v)	Ay؇/Aq211)mRs:@TK%͙Ѯ	TmwbzW%_o_"&l*ZlVikm<"Gç	HR%hw
+jLk3œ:7A9Dۥ9}QGVN9s1q/L믪Zv
+C\2?YJ"3G只e;nmp<x>?R&qyO~HPﳥȏ8#}&ϣr)<E28a>Mv儗;ufN9{8	I`H@TYMQN0H cBTWB(sI=y9/jt_#,z!ewWyǢ;W { x-f'ԾRPq<N[*L^bq@cQU4iC9^\|M'^GtۣZ^N̒@/qU>a}qN4qQane5(.A՚g%raoxxX{d{"^.NN4X4mm
+hWqxmVudr'sTO_Jvc;Şnp-:8$ƚM}'>pN W;0OK0^̇U44S9V#RzҍYmH2+0 0(>Eu4	Λ| 4}p4hue="sg-s8僃J60I>a^rJ0]ne֞ZPWS8,qc[F6/*쫟lDqa2z7Ό]l۫N^;8߮->}h[/϶za!:i}yiABoxcDX3b㧰.]5/qB,?/IRR?je'*>Q]ڃ0M!T&1^3ԩד*$c0쳳@`\M[#GvT\j[R;rrH>ByJߨk:MěiV5BArIRMu%a|4"31y[(lϫI	
+eMPvlTYz_yRωWМw=X޳*)eQf@KeuaI,B՗~7ڂҤ
+3Yy-aƌ|Ez%?t9>lժ;,6l4t28U>Ϛ&îq
\ No newline at end of file
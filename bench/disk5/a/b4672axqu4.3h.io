@@ -0,0 +1,11 @@
+`3	3]KC7ەBRx_j:X*EbjB	5/tӧ/4Od^6%"#$7x;eITk`d\&tsh>#	+R>9bwM}A{@7- @݌1Ù-vA;2v'"gͪg7t{	[I\Z-M[W\ap4RE1;~MT?V{/`	ws<"pzƓZd4Z2k{ޟBmj(8Fr 6FBzI*ڽ:l?EǋCX7Wa%ڒ(D&
+|X?\.")`gړЗpF+`4G}Ft;Dc3ĥWSwxTRfg˺B<>VX!՝SxҦ"o͎cx0+]?5}\	Rʾ/ndxd]sigt&gX)Hs-Hpj1"b
+{3\o{t?-W-oBg
+G*A]?͞:뢠M+Sx',4Hq^atĎpXəA{dkO Ψyo+ĵD](KTEUN3uJ%]O|^3͒Hu4Q,*tGtEhr+*l{H
+F`S&cWG!`
+F@A9ؤO	C)V)f|ϭܿ~WG]`-zzߖg'_sn^hFv-D! 4M!qG]~>#(h`6	<뉽|'ԺЌ޿4WFtYCTXZ+	3+᎛E@<q+B3DvmaO$7vIOV.?:Cjicoexk]ܕkKI 78v'<6l4KCE!8|Br7j?s&qFBW&GN>-X-ȡj/zN*"&Ę'Gy<1?Vps{JL#ഭ9yAcB7W:Ӌ6.yi%#A	gJ<'['?8Չ=dT)
+qTϻ-_tNk=U>_9aM>/hSET
+s|ʾV?Yo>a-,'b)$s95;3L!?XIf<q\*7?SrE+y YJf:յ{6{b5'!(۹imdqB)	AroٲAjc>]1Ib8U(85n0*|D|aGs[-B?H+cX0h5^ě"daQ?u<OKRm+!Yfe2%kIHj*~G2	t퓓ym؋xS(WH|U.`|{Bȧ\47VN؅EZl?YSXƘ2[3*@e/diJAM*U*p]e2H҉Y-o7~1'?kRn5aQvL؛Ӿ<MPQn>3`VL*s~ΆNKsD5;n]ZbsD/U7X@o}F=&h?X3:wfrͼəf\\~;p߂81Yp{t'
+btz81u_cSuNUNclh3:g	uXMyF
+]n\v}"Wz;Lw j*T5n.5IlQGn!!FK;̗dݫ9lcVrsp]x/&HA\,:m\ĥM{|Lg61P	}WbI*5޲|?sC_/Z Tap$&Dib.	ѳЦ)DA7鉴Pet8\}"dE9&WϝLkUծ.f"@d\ިe3ɾ୷V
+l"q%*"
\ No newline at end of file
@@ -0,0 +1,5 @@
+#^˧qN\ZU]R{+}RK-+@,Qy'%/>(DNYgVp-&$nv58kS֕hJt
+¾t{-CՆuP01PS`7;VTYB6G8(I"2O}?YY@
+fH,XL=q?#'v[O22!i EQɫ{($.41z9v"ÛgA_VVmrb	9Y:%6	"0V:BXbT\,cq
+@pCc!A0Li7ojC
+_fJ~FupwiEɼrh=IV[RU
\ No newline at end of file
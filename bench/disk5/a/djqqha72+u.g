@@ -0,0 +1,2 @@
+)jM߁Vyn趲|K;2>ei{G%)8kiЏ:ⷺ<MqQM37Ⱦ)-m^QfJ'($l~[񯦞ġEտ-sţc/OuAo~ vSxЅa:b#ШRԽ㲾F'3c	A;ڬfey@YQF!=ΈV_˒V+99Cne&-4&TmRd1$2rZ㚼RC^9c	*,hj%}:Di.`mƁ	:n+/z8!&J+*4; eK7f"
+Kӗ%tVz-fİB|E]pÛrcyi??ё`i6kh_g՗uJ=ftH4_ΊsVO_Ǐ1
\ No newline at end of file
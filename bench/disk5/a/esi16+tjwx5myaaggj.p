@@ -0,0 +1,9 @@
+y<a"!"C?J_H"9[hΟ\zj-`q-eKAcw&G?~\V9L3
+ѫ)
+nMhzgxx`w
+OhjoCf^L)lCDlӅԊEr"[e4H9R1?HTNa^NM(hZ6B-]K̥j*3#p[	Ԗ^jOJl^ꄞ__X)^%hkN5H}gMyDhyՔGǉ)쉉ow}\l:K0%(Zbu}9^{3諘ٔ̚j_R^f[r+dL/fCpIw}h(ot G|[LcZVRI5ڀ}'V6^<";w*#ZWYXRPVyV!iV,6/lTO/1?CӼMiCSZmsJ^Uۈ'~Sł
+9"#O:gSB)Ýuؽe9]CbVU¸YqgI]!Rn/@ѮFFI؟	dUr>6	YwܝoI{6V`g^1?aTNH;ّ$^>qaZI=ݞ, >@Su&1UK\6C3BgkMU+0"ޚҫڊ<N#]LPЍ<´kgM`?Eշm5}[\UI%ХGUzl{xug{i_9DwM^@hʎ.}A:%ѓ~ ?z(+ NMݞF+zD?meه.a"˖AgY.w;guCiM8x:tK&W]0	:xXsţBA#B,^|¹б	.52 &e%'R`%%)lXVxq6}R/j=zIѕ=k3/Io(~M$ly'A\\e[ ӚtƬ!diN@vvqU9Z)Ԕ ^㘗СB/T5 o> 8.N0Kx(Bw0j.WI^&_B=OMK	ce?%i,6S}D8R}{}L="7`d1	gGbMV:{ٔtr"U!мbჼ1:i*o"~?8yW͸Rot<ڎSA+,Ę#+e}<6G^j#ک*cΙΆaGK	;obva#JV&뚱'ةڜ;"tx<w&eje#,У$xW;N{R7/߫1~xY:Cy	U|̭qr+K}/>^Ҡu!i)l#r6y߇"kpemIBưh^(d80$Ǘ\"Q(5ۑvK:fL=,fHcGrW58Gjl!6݇AU]NY>*W(0!za_3A$#A>~HNhlC}=?G3jhHq8zL!So3hJW-G#0(S&nvG1g0T	2#Mޛ4B"hi5#YBx!EdbP6T+j6޻15okEI-Dw΍%&t;sAۑD(f~]dETǼ/ 9:AWaha_Fo ~)c*vׯd'_)x)H30C=-MyN&c4Pu- ldCDB( A#K0Vye~as-z'-޻2ZXCE=՞ԇY?a8%YŝXљ.e
+{D9Tk%&SI2%#*Ted'bo;F|#r:tUq	GlJacCvj	n[ad"K6xSdkkO'ي~Xw"u:e-KK@wOye_No[jÀ#
+G=m~"FtPm89W
+!]Wl<Qvb{iA3*\8Tל.0._aTfX;$8w>ɼUcRϺ'	?4Fy}Aw;R"Po[N7hbjr4ZĺxPK[[!<ޒD)bG5>C֨T[ٞM$'e5-T:>q4XBysܔ;gxQXf
+V~Bs\:$0h'jv[#z	`s-?Iox*S\xN&@Ѭ1.rUBlay2dԿMː6{۷&(5(̆>V56)OڇqcIg'Fw\Nwǯǆ2cr6\phu2.SQ/C%XUiIoh뢑1@3}U]ױF3TA`yjdN6W63|zr#Hhx.Je_)`پqvTŉrnщj{ɊMHQ!(1Z󴆜/Bs';F>Z=JV\~1j{Vy/}O˸xPjjB;G|fЍ5BR|(A	je38faL&zenx|aAis<a×q'ǰz$.p5+3tY?-caPc/
\ No newline at end of file
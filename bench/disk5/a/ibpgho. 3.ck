@@ -0,0 +1,6 @@
+ܒ,&%g,k}] 	:}G^z:^GyRS	2``ng{#2(ӷt#+~#hP7{)xH۷H]0д'M//EO_0|h/'61@t4dt'O bS{&rm	Յ5#ZE}eBsHJ(>f~Ajr߼YH2Hٗ(3R~@n3N<	6	Z],a7}{E='pw (.'*O$1>w4HnP_Rp9jg'ܪrCcPvN:zؗQ۩udO5uf&Olbl҉^Z&\j`]n|p^İB%3+r%p3nSlѠ"qg85w6Z"{jK qhrbw+$]an))ECDMa64x
+yW;vWyJ!p7OxėrTWwo
+4V\b#æi0;Ӻ?3VǟOSC7̵.PQZ[+RITǔJ'Ƃ%@/+ums&Iu\4scrlKyE>`B)CN"2MyO@$mJG<:MI
+V3SZYU'MUzTaa{NϪ|\-8tl?ch&yu
+?0ku
+f}|.*{jݎ|GZmՙ=ME4do*q#꟢;2Å|0l;ލ$7ͺf;-|3gkKaT(NEߒwBfA@6dH~-긎1;VP̂Bb~
\ No newline at end of file
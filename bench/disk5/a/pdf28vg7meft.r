@@ -0,0 +1,2 @@
+_472dBiA0~@d3l.K C_
+WXͽO>3T(%+[j)4jr	@pf6h<A@[BI8MI@
\ No newline at end of file
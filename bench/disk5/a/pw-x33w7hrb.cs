@@ -0,0 +1,3 @@
+/"SerQ+CNfmyXe|ff&C^AT6}K RGB(%.* z5쫻G_W欩Þ%m_"1G	AZ37#ۜyrQJfVj h$'bົԁc=(aY+)޶\=5"(2}5ICR\Msal7T7wnJ``v?gvVje`<r{[i)y5]T]Vl4nbo<]g
+%j)*з?rknӠ
+j͈ [Uθ~%14#'|HBB$1u*<åУ1C#:_ARE/zi0sRVAP3&*]KHXl2̐ˢS)ԧۺ{V*`%:,uRRx9+d0%lñF>]֏<%VBhİiǒP\'j!+X_z.16Y0'|Fe/W!@q`qk7ARiv"?@@մ<6I)0>mDHE'#
\ No newline at end of file
@@ -0,0 +1,16 @@
+:q.HifS'D-3jw({K_<ߤT̓o	gp86LUxM* RNX~ x<!J!`Ea9xQHe&7۰k%F{nXKp1jE^cFNDc%%EV`VܭGe}4-C|Fw`N/pY*5!%''dKFJ=NOS+ZhҒFSgt3WVzۿKO?c>	
+ʇCyh Ŝ^?6vm.W%jm<ܙdjLp?;r)@|"Y?}A	X\0`?±:7o~2V2`Ff"喡L_VzqTRC`v!*pĨv@AޙZc'ǰXkwIu_/8gu Ϙxfq&WɣIKeb D\:6:xq@v
+VRR>43]O
+w1)Q{/@Maۿ&<T?xF!װO<}x($~O_P]z}:`0-efdsFOq!8ۤ#DS3'g,@2	* ܩJ/w*$qzd¡\{?\yLlkЯ^wG,Qf2?8|q*紅rњirci3k2ו^Ipg#oxſB,2:!؅ҁHtW+Nnbl&t)AQ\-Uz-@)KjYl'Ų(}3Cr!inp>49*v&r/婳OfV	[&Do~zh|SF%i~tɬ{|+*ކ$G>щ-H6MDU$eǎN+w֧**LwT<x_rH*{ipU4gAzr]ps?0%&d($[JK㐘3t#S7)kC
+Ti1kYA]n)+?ް-?us[A`vh;[-EV"Djj7JnfDA<mF[o+^֌QBsxg8Kq*.F##ŵWRn޼8'D1[xOLGaw5(I70'BllЇ[~.^wͽsT{CWH`OkQUEY0R([57(u'?HRΏv/LNmiC>ᗻ%OadgQU`DU|F/MI?DhG
+2M2ZIIl;c
+pk1>"Pt3|ʷ}!`Hv34ժOv:~Z7֊<o-p1:y_C}y}1k~M07tmyeX0V/&s:#	B/ɺh
+/Z{º,dq+2oTAwEê`=<*]%ؗEe>7+,D|NE4"L`&CnKs\[ B=1;G0F6͠|2	S_
+(khCETdi5q%{Tq;A/xz[=Ȫ7u?Qpe':<'Uٺ;҈QBbRy>,^mwn'E.CN%5a¡$5w޻p8e]2BxuHi//I$Ag)[鯓k0m"Z,ќr (kLv3v!ޖBd.iW6xA]y,b/=P14|;;_ʑJ><OK4?R=4 O*Њәa`6!H!MFI9J%n$rJZVR1iQS~(VVTctrgpnQ,/R<T̃,T/%~Yl>+X&`:}xHvCO@#BC[Y4os`ҾD~{,(ovq`.W}R;C4
+H:n	N%C'Mp.5Kgd\|Q1WY)
+oK(%soJd
+^!M7}Yt
+Q*0syx3եWi%P}>0]xJfjJm$%µtKhy>5kCZ#GIȾ-OrdĻΠ-Jd=>\0&}.Yw<4X|6Xf?;W(O!*PB
+s%"g0sxuBэdR*fjSpb'(2"_cL7L,._vGZX'6SS~J>q9.gF8Hэq=)R?~}6۾/6t~eeJ"fU,Ԃ($ǣ8{ns)Y
+fCҥ?l!Ʒ71V'.E)N$[j@0b=H%W=ԣ"uG᧑uWr$!B(+pnE?Fmt5!o6ɛn{c"Brߜz8Ȣ@UT&'Z>}s$}`fqP0\eWp[H??&5UmO6B,]6t-#QL&+ɑ*pQC&zumؑD:q=SVsT|ڼg	Z<mV`jn\fGL7o9ytS9?5	&9#0g*R`wPXG<4vnF#=Mzɐ^60?wM՞hWbnrGfEOz8}$)' Aow0P`ɅfEfI1VuKLo1XwL
+ҥ.ݥEu8m6 9nP.ݟI~TrBMdsW{QoWDj@WʰOz֓c{Rfp^]_M	{ZrI#*	1q|T.b1#	RW]O49wqܒ)酀Tn_O~ÓoK"a;8F"co6C1)m":)7.9##fVJ()=G&A}<w-YDg!T~ȼ?=c<Df&sEte&4H
\ No newline at end of file
@@ -0,0 +1,4 @@
+2`98S-]:@@c]޾=g[,ge.*ːbsʒ]γD``+6o(&	.d^7Ն@I?UI̥D$?b!o!䑟➥ƒPj73=8s66$+qȡe(Ԭ|pph˗mI06v1GYu4fRYTY)[z(RN~ߣ=,j;_ә;!T~hOCtM+ܜfzN;EHz|N"i}hY~L*߂Y$$A,Ksf酿l6!4;4s1m
+UZǰ!T<)#'8_؁>S!jj0y|m-lo撋{|55of^GT<$DXhszԽko+f@Zax`!'!DhjZ_8mtv2zZ^)۽W7"$>-P?EBPo>[U?ݿܸCW^V[)~Q83$gq)¤^?pҵ֒L!|[ɕ!Wr;9c,mՏTg`قa{X{6^<adΰBq-u.p~YЇ勻PcsC/>~ndzmw5Z?.l(	1Эk7ײ1xPB_Yl]I*lLb)/%`wkGWm/$.f$<,k*A^TNs'.VnfJyKe;sE*n**RƝ.֔X(_Տۂ׃={^˓F ui>YJw,=Vv!P.}{]xrNUd/ζz%.x-p3#[PGz]̛D9aq{ ;ȨZW'{isO$D*x>tΆ1_lc?oӌJKb!MfFSd9cU:⋁ҍ'@X.]y[kѺK8Lk+r:42mW=Ʃ̡}ovS$] դ-kO8_f7Pn^s7mԨ_,˩с?C`ڻK.b?`(d!`!_
+}s仰RJ0Z&[L庣9wc,B$BkReD$`C]L3sS	@_tfI67P*cxuA6"\/W̸WuB?=yH]$)RtpKV@9*rS%ڨkHi̘ETY!<]tdg+OK<"6|j:CaQk+/f,@p,!DdAmg0qHe_01يz(.Dt;'Y#=l^W:]3kg׋VH$ADTO$WLwGbE#y@Nhdi2>!D6al#g0Vi~ƾ*GP]aNHk^?$QN@ͲVNΜT]
+8Zp
\ No newline at end of file
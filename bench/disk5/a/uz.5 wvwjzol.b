@@ -0,0 +1,13 @@
+Җ c7A^qoBbM$N6".nޱu_R<at	tQX;4#!BBl}濡<)Cw~mƫy:v<uPAsY	Cw+"߈`gt00MK*Kac+R.k}r++MLE
+=Vcolyr#Vc[v'G,PvN0~/yuJn2'/MaLEk7M#E*;*$j3Ҫ\xo~kռљ91@U&Ni7O.dh0`E20Ø
+pX>tCݤsx
+#N]nzf':dT!M.bJuzadێJ/5JJg3~ݛFڟQ=<RAAD ㈮cHӈݣ :WiyYͮxp^'R$؈Wu?H\!@rbXN.nv9djy#9b%M,%{aF+;YN`OvєHSՅo%"si˖uRCЬ6u~:3yLukPʹHtPV.Fd)Vha;'bx[ L	=<hH+%\v}6Pjx!NdrTY]~0䝄*T+\d,<AIRSȘ{LW)wM4ulkU*9O_T7dit%9WqPOdFiJ%"\EX`+:͗ddJJ1a!J}Ps"xϲ`Fz,W(
+~q^=)TI\4|=}< .P~5T&}l@'*Jl|5A-ҥlhzfw-nwn?js,ys{6QѹvL)g+iZG!HrlR>b"~U1]e@MTml#DQ	/ڴ4{QmC%أ]ޚXjIqtsr῀cWu;fٿ+$Ol a.o2&oay"羣S-8=ۜFa"Ly>h['.%S?I	UR+7JNv(<6t ZWGj^LËSZ`X%~ ~zoAP$irzoZyVOMl;"*J9a~U`ZIխ#kzO5HYH097õpn#B?v
+5}gPWM?'te˵PuXR<h&I\=>8AQSvUB7P
+b|I3jᦷuېMW4ʿEwWTIqUزJ[\Ly[COazn|[zsuRǵ֐v:wqg0GG¹ж(ܢ4=Cb*
+ZyKqy-:W9X[y	QVQTbۋ~NX͛8fRhϺ%hKQ^PGj)hƲq7b~=1^PIMQQP9,W"'wN%2BxV'vQP=lP3}@5;W`>>BX4\Wjȅՙl@
+'쐤8A~Ԉm#VӂWm{fcM;:8WzK	uk ] JT_-h7CQ9p7hVA|LV0U-e1"m֙.{s8:
+6ĤhlXPPa'S/Y+.u,0(~EK4@b!;>@)nU|2so{-"~j#XaCH
+}}5\y3,.TF!Ϥ|Rs'SbzJnI}FTNINt?rÍXrq}NP6qš_.oe)_x!H7#s|"),[uHpUp{3]@#*u@UEݵ,X5)ń<MdMFYrw/{٩PzDjsD!_Za#v[H+6H'NfWw;~X hYLAf%j
+d[d
+lOx_Cl۽&T,L.Zh3ZH<ɯZBV
\ No newline at end of file
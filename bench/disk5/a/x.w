@@ -0,0 +1,8 @@
+`ڑ}N|[`FOqZ/@@-q$j)ÄnpXD;Q<2vFLԬTqX vZAXhWYIPYy/2̍OB;ALP -<AYBxQ:P'ZJ<[[NI!HRܤ>1IxSpa*چC"44N2mP[+~;1_@>3Ґ*Ƴj-h1@O:ZM}`8Qc\n_[i!!@BDtc#rfHwWVD'^Fl%iUwٴwǞfݰ"ۓ=݈5|{anA]6BvUN-1HaTw:1, 4Ex5Fٝ&hѨp}"܏Y7`[MjCX%os<zUN	;L)yClE*^dE~@Pwsh'@3݊ݭEOJo%D=Xi٪F\* aFbQh	J%gO'0N[ߘl>)^-{gO8&
+fF:˪ F]~.O)RJA°&Yӽ2uv5L2#i|4"	9͞.#쪍^d:}SB1SϹmT 
+e6vta0	O!]3<c)	+;5˷&hSޱ(əT3pʓ,st?3ɿe~m|ܯ.b;ӥGWfS\XG2I*+0Y.;SpJk>BNAg ڋ2}Ҏg	z.(=Z>OlA=}?5s zlc2TKZ8:87єZ!7cѳ[io}0PhB{$@*jJj/)͹l:v<b$dγfL	e\1I2Qr^@Sy/$ob1v/CTsEXG^2flphdoL3)sz%[-h|8	43yyxJ:%jЌ;1haXRZr	X-XTg7{W048mޘ}TD76B)Sd
+zc"tYw=H9_7Yqr7Ln'7nN)7\fh9J`F0i,Kb/HZ{8?$AU@~}J?=n\oBxjC9ZpK^\^dL1*=zo=4fupoYKL.eP=bЛ*c5|xcEô WlYxۓoz9^@=Qmif8cEhoBwn`[2G \^mPDG*fOxL.cvLq1qcjth?=kQoL677nhB'H
+v9эU&Q,@m}Z۱;%,urFs6ytQ-YFjX) MaE``o#wvrW]ybۤa<:Zau'Qy#ڻkA51׶Ly
+,XSidKSG\9L I3ns/ã*
+)lxu]㙽(bNv}aK̔]A5~)&JUEI-?;~NEy' ,6
+<LOU]\6j>*?xK!^$t($p[Kt׵_яr4!aZƚ&iA{{to;Q-2S-sU>#؀>^6ӥJO	Hv!
\ No newline at end of file
@@ -0,0 +1,11 @@
+v?:HO~4.2#38U<z:w5&]!H좷';եw%c|G?Ivz鰢VFIN%L(J"\btA=ubJPQ$}įI0	X65]ٸp|%&8MCWHܿe[ҍ{};R{-Kg2e.ZRi)UZ7VV$<4|B ^DIC-;)H{^^V}]6uYJWHk`=*ue7@BFgM-eL0`DvF(DX6,(gk}y;Yt 2Ւ­O$H\I	ILX?9\d+[7&VRiуڍG(Tw^/ru<G̯
+EC1YD2L:8fG/?K8ǟmob(d,k\BZZ驜ƃ)-oHLam/<gLs+<q:'f68~輺󯑛݆C4!ߔ+^hpPɈ8x։<k3)+cuӿex@qIg}keK1#juRͩR?8E%WgpEʎA`6<)cxLB^kOa
+Oyl֮T۹Ut~l9f)b6
+.2tX#"⦽AK6xdY%Ї[KkhPUS#V A0MzJ_NA|_T#w8o9e^r",K4/3-Xr7J-M5;RõeRGJ_vu%ȎOşMR"71"B5Tu^".Pj;ˮ@'!g3~pm]ԍZhVQSy|9aF?,LYI3w[?
+YK KPL{2GVj5#G}%o'>ę3!	ǟ07a>ZV¿^y?^>&6hE6Wom_Mʯ="kt+m
+q*٬e<½gJNu
+3a7qǫ2*{/,푆=MʆRs* \w]h8{~zTGMo5G;sBÀ%:5w}ڴzs}8a/WA~\LP15 u5gYYWrP5S.LrOI(#XaRfÎ͹e#<uM2,ɂr}4sgշ҉אBXU27d<*0 VF@r@R)m&{kٶop]}ވI q!yҶ)@\.d\ȌQO^#%kcGOQ-8cYN(YEpP\2M
+sTւBRv.&C6+!VfuK]vo<Z7<Y-v*/;jɔ4Ld!S;{vT9նFCGd3ڪ\P3z^{ŀݭ`rFA?
+ĘLQF!N9l(xKqK,=_
+rMG?`pGmt,.[l\w
+$ߍn}i<d%2x*.4=S=?$v0CHhc2<%*PDWטMN}he|F-Y%U{ݒ?4Ci=R`tM;asKKEE⢞FJj]#1Ϩ6mX&Asm->ٌ;MrL[&mbL1l-U5u8Y|~\jHP13`XMvY\LsxM"Cph`a/lZ#G{ZFI?^%NjHjT&Dncn{Q
\ No newline at end of file
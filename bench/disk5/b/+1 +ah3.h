@@ -0,0 +1,11 @@
+="=5,C^c	.󜜈BEOK21j~tA)5yg͆Q\f҉Td*c7X~\\DiACȿ/9tP!O~W?of06F}>&,1Ec6͌N-
+.nG>	iց&E7cҩ Rs`26xEq,?b{0bE@u%N]%+0&K5p
+tB{)Xۀ;f)זu&Pj@Yv×7,H1rY>ξPv4G<хWQz Y&U: 7in*ͭynbPDa.4J!ET0S?TLm9sXd]32"u?oP{MSVxbC156MA1FfkETQ8!&N6
+Hٳ˗>v@E;>l
+
+=1/ER-^qv1*}xQ>or#uwܕdzhNQ6{vo(?,@N,LP[)=b!cuCK?	T55̖r ꕀ7yHłe4qx9dOcdaKp2	/5g.nGb	{4F~7T]m
+]?FLYtuGiVpBM޷0V= mkz+TX5w=-iψSN<Xgp=Fe]f<}tݔh*hLSAJ|gt¾sRϐ՝o[ā)-&sL1J0Όc6)ND/1Mj=,D	!6iE<3j&&p]غ6'$̘qoMUq?zJޛ皀}s?&&oLL
+~31HWJ#.J@H
+jރJQ|<))-j8\߬pJ콗m$~)K0VG%z*5v~^o)\H;^ W7	('-ˣp0&75brnS9-Q"a@%^9ǱȪ&L_Ғ;-{8%qtZv#]skpodTXm8`AQHPN[Wt>ɲs89z]2+$(^*}s<r;^}8P`Z3,l x\jN;&QU+IvhkLx4S#|tLO
+H6߮]|yPvIps^c6Lmٍ2QoF4<xf{cEZrGʛ)0|^qTӽe*KfB+4aGXBdqtσPRbn<F촐Ԍ=Nru2D":Ν~v5z_DK"JM'))T\ئo|A%!k菼>1\x3??w4E\%Lw.	+OZLBM?AxCLmK8JI{1GCԽm$c^jB}obqg_%9{"5i$9Oz	t	r(Cqeʳ9d˻*3k.O\HcĒy0|ϋw"i:Al瘄9n2mţ<T]{a_rJl-VN"M5<n]Kj2Q:{cR߳۾m#<_g	kjeg`׮'5lt->[D'9@"S	npBZ@JT3f&^L<k4kbtL0'ic":	Vb
+u\.a(m<_v(<``95*_J`Wؓ&{ъ6OԶMR$~A˽&s80ޘ0mDWRX/4l50co[2vf!7=THېč7n2)ХK3KE2+l?קP泆*O!Pa4^?{Y/{o&61ϋY<i82NeI߶zۘoںb6_q(E{KG2(YZ<+"+{vpŖPǈkC>,{g)WzG䣛l~J"`AI	-hcGh0v]]~N?n>9X)-/dE u&f`Pzf
\ No newline at end of file
@@ -0,0 +1,12 @@
+okr4EW8(-hNE;	QyUwrރo݂TX[?lsA1tÔ7)|SzC?jU05L*k65bjZd%-K Q*mx`r}+NYا{r]y0z<#U}&f[26K4Aum+]t.FUw4QBs^vгЉTlc9F>NKMHѭ,4_SdnE>V!Pe[dͼ#q6z&Ugw[80TR'^ifS{?d["-FܒǶd'ܞ|V7wB)W:uV:ʯ-TXŜSz~_&pRحArյMH$?O谞+lr J4	O
+KէubT\~ΐg|&|<S|yZn>k.Riδ{7 0I(e[!knߎ񁲟pZrС>ԡNtsa,*v7>gtҼG5Eߓ{c($ɪnJ.Θr_`=܇Ԑ;
+}Pa浄DnZ
+8r#NKca养NĹc~t/nelY'ZOT\*aY2'Vwڬů Ӳ[aK%XAYjB,	řXta5fpqyCٕ=!sۈhGYǨ7!W6mv395`Æ,K"_G.(KoM|1u\O|M&n5M#x?@Uݐ8z|cFP<KVLN73/&de4
+4ҕ䞰WZ#g;
+&K:Ce:0!;VшA!{dц[7^^5.˅u"#?,IݡȾ)SHF9vHr)$Ћxৄ8
+&V;~U*eap_40\)ζ8zJfw%AՈWu:BrVO>A6@	K67elIﮤ/8-"'3e"re(z͘WƲ$j)Έhq68qsY=M)3G{
+3aQF/˗9:넢s&,{[w,ilZ+↰eqUL]zwdXwWu#XėHACaLeLȅ,;]*K8xͅ)y||l~;x$T3.kdtZrsAPVw|Q*;̎@1Ma˪vebUR4!Xk/җ99qy#׾{ٌYDJQ-)D163	Usl7rQGH4#Z.1!];uKV?jؔ/Y}:2>Z
+F]=S"FT+CY,Z~}Dˌ}iKFIP6uxT/9U7m')gDüoiHGӎe $&Ͼr>A@kl+h(~wU+ݿFJQ8D+Xjڔ랸4]NA1 d7*|&&Q<$pïy_neo߂?ʁ=d³F-
+J,UّJU,,f"9/'>{}+?F7tJhCy= DCίʓxǶJ%Bvcyv	a절URc-9M-Q`PǉT{U7.$$ʾ"`+yaw`LeWE9T]-ASptq[cw'`	J0`JH&Ł}t\f+I+=t^D"0oЪ51/}_&'&HE& dr`GFQF%R":QJ$rj6vOffr.>Y:Pv`7c%BLm~dn-G^p#wU~_VM6$x+=@	Dȃ#kg<3Hﯭ-"U0QR8P6-rhI,-ݢ8.-]cM_`7`.]BшQQ`ZFt`[agXTՒ%N?Fз[JK%G
+hkFVBs*cfn}sQ}g"K2[ń;ra҄x3qZ/<.n>"=(Z8#8j`Bz]ӷF7xLƅ\h
+0pp"WL6},#±~{U	D#uĠ⫆,b)zjpu~J*$YZNz/Dj&ᣆg@p%PB=w6!Y8o|@qqU>
\ No newline at end of file
@@ -0,0 +1,5 @@
+BJvq_E60LVKse=x|]c"@R{y7cy-ƇI+T;CX;7՘9F{GǃBQl%"wu/U8QK?LDwmoNzxc/~:*/&ߕT0IBD(AW@B2`W)	:F:w(.*8@sJZnEE"Ǚ:T-C!IEOJǠ%dӑT$սL!~6Ù-++Pd@n{y:ϒ4@}Ɨ.n&|Xf`䘅X\ZaNmt]L2Do$y=GCxЃnX/)Zn:MRm>Ӏ;]upgxi˼K{~9S`"A/ϻ~ga6eHqJ
+4ٖ0B˅5/zOHRܡT$>\5+eQq+K
+[ʴ|l8b.K{:?$؉l\ŉI
+D[]aʥlR:&s{(3@%ҤkRؽ(b^quwx+9ko:hƂFuܩd'm=~r(9%q%ą_{!){9"bWSŠY8`snem^#g=ekf{'0;iPzuug4t.d{v5վDtG~{x#G& J*8=I񕚢8D*5H0~9%TuI	؀A@
+ryv,	&Љ(
\ No newline at end of file
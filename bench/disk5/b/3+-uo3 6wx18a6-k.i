@@ -0,0 +1,4 @@
+->$lˤ2NvctQث<8OPD-Ίa'Rn^OUmv<:SqaVX|ZD D-tflvDKCީo
+=IXtI.uz8U3.n,wZv	$mb/΃&Z\k[{A+i6amz\k'V1\M)M^9bŠk֟;裟+WK8+"D)34}"`ϔ(1JFǍ2sky/jΪ!rELDm5Ycqtl?t%N_wYw}Y/>j##pfI(BC=DSJ#ψ$$>;
+Po@Ng&w)*IMry-e+bH/k]7-Ŏ:u(;S:^\ϖ+d*8#Z.h~FBxڋ[|FxN
+d4Q`-X.Tc;A-Aޠ%ōR۵:)$!9N{)F*53Uy,w'JǶnc)Lf_#t1lWFq?jF7\loDXgB~͍GV7Ayݳ΁@Jߺ(@Qʙ-'1i30[),?_LϘ!x(o!5enxFmo
\ No newline at end of file
@@ -0,0 +1,5 @@
+hJ3cљ1sO΋ˁcot4Rۛ܍-Ag%vnUɸ`IYw5bMq29{nj+0Jbq>v`/YjmЅ]ܕq|9YH?NJĞvP=3~tc&A*uרDBYDrw7}-gLxKq&6z79\W̛Ze.AHYj,#9yW}/2]Bxmd9ϗ{xThyjR(,&輬P!.%<|9N9=ttpmf跎0TVsn%7QἮOVD#2јɢʪšډGKvς@Eu\(\uHX${$-SN'^룶Ma)w7XW(-B_wәg	{ؘ-m?u_g`G>@49_wMMWhGي>qI Y-.M)0t}Sq{ꩨQI)@Ql;}KwL+ uAg@bo,GmjGKczѢTKЧ~kX$VB͞!2׶wԘe89D֣_ʘo0	pWnbJ;3PNa*P1RS62ͻlm,%NQ&ge	&?П0g#(ptZl>YϹmGZpՄLPɘE>~|J)U{hY)~zg~mK#QT!B'X)Bѐ8,sбr;N\/h1(,@"ip8[u,?N	e)!Y)hŕ9ST+׽|9
+̝B,E'ٞvȈM;XġPF^Y2*=&a<
+}t]7eU!D5XTP!ưvP0|_'ه6Uݪ|Pp|4RQa{?_Ja6]̎#Z}IAlM$S]qx	kmLtq'`NF+fDU~+JYw	bl9=\,+Q<*6x
+[_iױ;RKg+,߷՞~ZQbp/sn'T뫉d+o"ZL+qSHDw.j1԰m>FtĐiy3?S2`4D6aMn#6F2ve*LԎE@R2U+##%_&p2j,,@,!׮y-MjN++iZ8!6lafW@Y<faju+\&%W7/*c(UgOdR^"OQy -vN:guWy_CVyJPaFA]ޱwvX޵3੏#J9k3j[$ܞ2Ƙ{1v}VPX0.Ssfջ{UBd[B?2w^ddhQY|={F)(~s6aڽ:KcrU)aR6/R=FD;PyHK]Sbqna-Y[&g'#}?O+"`֜rgݗ/JMe0MqI%ڝ'V.wB;)yr3ꆆV&S5±%6-(Ց1^O*-DLY/Gt˧;TE1_ruz3j?k0Yz3+aE&(qJ<ˋ|ޗ<.Tfm)vàU54Xigty3%{w!YI~͕OY몯Aqpk/`+OMWv	OxKO&HgsIԏ^b@qPXqb+?ʎ4pAn?JYeIҎ|ؖt	قjH9ֆo4kd.6mBW㯐0qS0>[T$s_|xlߘD -IMsx赔5/ڞgBP	߲qUCdÍ5um
+O݃\=:%v៳`6\!7*Aۘj8`
\ No newline at end of file
@@ -0,0 +1,21 @@
+dD0(>^EUעhǆHˇU_pۊ~N*ӏhDǢgOMM"'"~cdp\7̞Gqڛi7oӺDԈ'c,r
+p
+L_fZSpRcY"eSxLO={NB|ފjwFyUyj+~^Lf,d_-Rد.vFPk6h9WtPɌDe"UBСzw+W@
+JW{&4ȴ:9`Ou[%=<KNɱMkў%`>*~;u0OUh7EC˂kC֘Q,	'f.8N|z.<UyًsDPLpPKXt%%s)#l!`Ưl"`h%l`[6J9"Ql{(\.753>͘gM*di)^OJ%Iς0uw1Lu.TW}s)^G's@0
+"c&/@aG:Ce
+#IL7H<Ov<OGAg2?v崛w;=X:w}WJfK4'%a^jNalvuWb}'T<u\EUܔMǏd.<tTtO^CfyaC֐Qv<$!/֯+prZ{Lo?T"x(GA9kŰwC$Th5gj];Bf=)}lYljZI>3diNtbE|^1©gD\h5f8}Tns&I?/%J/71bh(7UnςB%I|I2zOE(ͩɴrΆQ'H* @Id<NLtg
+Fd?YΔEXɰݞCɖg`R9c4@<Pn2)2><BUSTA!pX3p¹6<ƍ49湼
+KY6Ia"ŷD'෬iJ%ڦE*b܊oH1B<543tIADNþHpVwQ\/}),|*|	BPy@*Զl;Aw|q׈%pG3Ktl8Wm7{	imO*bЃ<FIyzݿxvL:TVvSe6mEE+QV;%h AW+Ub$_I?'J3weYqTX9*L8s"DQ)U.wce@]bv<W\S[S
+ѵYE#1KJE!Bt\B!pJ%(wRZÁL]з3<KnId%8
+CP
+Y%3>ZA[MWjGGᰮ:QZ>% 5sLpjDzn5|!30o8٪hL|-w,$IUՌҽĂL˂LF,+%?$#aӎ,fs0<׵	șnݼ}Ffe;b+Nu4GńVRLILlVA8&46,=8 cʥpIks\/O	tVFy],^K^t#N\磌Q|S|jPpŃGo/,UP|ɭT|0sgDX<h뽨wjvAzdP?e(SWs'(X81%"X*媭q"rTO_V`д`@~֥gUEWU!$-:MX|JòXE%2yX\g5W8(Um|lUӉ3C9[H-wPRt'hR%q0fgݮ_(xVGΏV(gs3
+enmJߝ$w
+,`Q^J>{x2{"x/){z̪KH`WNsq_f*'p䁟f
+wC:N``N-wPԨjkPk`:]~GZ8uG}N|dN[pSKi Ňd$/:fNLiR=ߥU>'Sh%.c+Pċ_;M*GPfΩ-1JUz\_FbAa$Vߌ>݁H<kZx&h*5WTLҢa,P9G`ҧV8M_
+;xj:*
+,l(Pu5PRf]ٛ,x
+5v/_6=ϣ4/$A72NM (Nn-(/J/S=i?aSG@g2un890Elk`$+~Qgqڱb繐~W=ϰ=$HJ6G<JTgLYK&V!R|:"FC6t;W/>iq#)i82wUDo=[8WŢyl4T'SlmJudw7ݻj!b=N}ZxGvDF%@ғ5
+ayd+māie0P]W:92Iî)zx3=yBqXíj֦_q2d$Ph$
+ĄOͭytM,rz&fϧ#qzyĈo0a,4__(.W-*_)OX qAeYx2T+c"3<|fSs(//B%9eȫR_XBlc8I(iL@U͂DQ9o</߸@1wYWͯ[,BWk/zޖ0	2͠:Is_XJER^FD}_@_w9Dɰ,c;)@cFlJу_Ck}c\tTtXށLǝ¤x΢c/=3":k?ZdV(/
+NoX.-jk_0@r*;tu֟Cg1PBLD}?e
+GHGe0c^HOl)7:YGD-p9S!d^ YΑ^W>. h|gW!I,tCX0WcKg1HSzɇb`_OPfǅY86zI)i}UD17KzE/If~#W
\ No newline at end of file
@@ -0,0 +1,11 @@
+ScfcƉ&G[·3ɬA\i(D?*G
+KEY/y(Jn]3Yu;o^Uu}rWxD̡gr~Bz>GUpMɱ	xPw3E%[g;#nal%$T*jiАCtQ!){'^{Ӈc_(=BR?dydPF'i[#FJCew$*?7H̗VH),?mBg(2qHc}i=fEDtni?򐐹0̛:G =5o{oU3/nZv/͝e<2.4k.Z7|>[*w"UjSeR:xl`oCE++Z!C	K;Q-LM(Q>
+G|Uk_=>+T\iõ{ZE=wW$e	hęL	noMb	N	DSRAF&*Yz8l[mLynƂ)buFY}'M,ĚSy=tw_[nݐMC"(E]ԙ
+J1%,rש:Yrd5=ÞKruF!Iiz F؎'Uew!黄i~w-Đ#I\'Jr%v2EM{OÂ؜Q4TQT3V?/IkeH߭mDmk/-xzePBU%\cni(+USch'ClVYu$ZgWM*$ؕv"(sV#>.FqiUYX7&}=|	(fNpr۳ZR@+'Gc_q֫ݿl3OYw8]zeClUӕwu59ÿ6ZY@&[.Xud&G2z=vWdE4iʱ)tvyH'>;J&'Vw:71'ͨ4}#bHkew^$l{:+=2"!%>bs8QB900ඓ$%'FN]-)\QzEcug92]{Te!BR>U{.=e}T6=1+b*lE_	&tKZLO}xM_Se=(L$Ea<9f&H8N%.vbA֞mL&T߉zhDC,	55[& ]*Ls<__L;Bn\B?'[/+Efۧ(nJԻ"Zr$
+D+M1S\2 6|K&vב͎hİSrA͢af59X,}1"\drБCvysB؟vtEWIA'WWri;\U?nu$lGso/rqčl0(o):rzDvr7n=Bo>47"|>c@LƠ`VFh|D-DCTy3F!njT@-3ܫfT^cUI/կ^_V BTfaB@:_,w!DHyץ]0"Sbi95YŰ,gZ	:V:o)7.M$faW(_Hr |maYU99y4{Ʉ6~,^KSPP7RV.M
+jAϙ`[6\=FkaD>Ż<- f5oHm5)Țd@BT[Ċ3;cӓcsq^#w0g%~%ZWb=ջ3k#Bw#wLZ8d7ߩ'q=dJ?RAx_4SY"x+25r[ ͦtH3XUMRNw&!U>A]\ApFC4.kݷSz%T@T"6JOXlD%#"mcfJW=rΣmt-%g%0v@RTzVoFo`H{31{81/[E8dtecWaIC̔]CI"	`WAHt2?֫
+?BKhK֕Dyr3!D7[A'V#T<h}ȟa{3{Aˁ"K_wjh92e3z:;0>>4)c\[lD؃L/-DPtQnXDz˦Ւ<@7WQAr4p
++g,6ӧyBpS4oɰR~HÃpN
+ߚ/uuRL4a+Hƈ-	Uc͙
+R	pnlo4zxy&}IxV@i/^ã%Am*Uxly9_ݿQRƸRV!KlU#}p0rLfꐍȁGʡC_	%ϠX=F	]t0R&?XIQV"H{?ճBهehW6`fXM5><O7Ik`jwn:q:c,{W<`{iH&<{R%)aگ@>,!YF"Pe#^_g.s\op%-*_́KThX+*xbNG+c,YɣZNC$lɧ?Шe'e7ɮ$2lovIC"6$OM;#aP+5xU2
+3kx>4M*TdK?DFxAm7"LiPS{y`-~^*u0π+q:Rwfļ@D&}{|Avf{)>WsmC/
\ No newline at end of file
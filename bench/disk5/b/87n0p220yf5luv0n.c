@@ -0,0 +1,8 @@
+)P"V30ldkW0~_oP8nq
+0&̬	koZ:dMvWb%$o?apm<g6c}^X/ࠡYgDY<Ւ
+ĈJLHeC|V^|%c\O!ovǲЎ¢WSm$НPovZ܋\W}&9OoTo
+`a}T۠).m_JoԡSNU´֪ٹ,u:𞙆A&oVDx3&Țk|E锱;<b5"AI|(sD6t(+5dlf-+潱~N]%;jIw{V%`~>\>ѫ5<jI;pS@Ư+_e~ n4SSt\u a s]j9:ɫ! /{	}>ksK$,$kMuABK,E=8Hq]〓A5\ɸ#}撎+N3gR:DLK6k*+nT)BՊgMxI%
+EGVڋ"dyB"*3r%DYAGxZ>;9ǧ/hƀ[\r7fT7aYg¦<NK7>	JR~y*)*qV"YUu.*Fyn)[H`CK 1;v'&XŦ}^TgyYOI5;%>\%m私9Exg[%\4\[9fzA[}jfG-A2̠?GrM68ɑ.vڡ"5ViwFP݈~5I~<ʍ=	0>ҴP1uִHTCTQx,B}be+cv)#g[π݉xSsu2g0 fO4i8uǓ;ymëXzu>K2 ˮ~y#5S}'%E)M7bv>p.o%0g]`r(It®擻xt{zoo"CZ^W|yŖ	Բ17^Hd{TvLa5[^kb zLgZ3\ʹf}A{LԻbvcTޒZۊ3قV9;P3xte`2ȁre%z=6;f'cTU^[4 1/;.7Hitǀ4Nv_1ln=F>`|?8߽wӬ kk 4jmDHzUmg&̤//5SҗZF[W2*2o^tt=\BW2&Onx,[ݶ=~&%iuLnƾcT$0k!>eLS)#ײOt~9χ-1bvA^ڧ4fV0}mϢ"(4xЈtGb=ٖ7tY6]tjSyHE.7^~A~BfE	cq
+6LG0cG$wvٟB=6nh$z.r:+q{E
+nh/(`AV!H.q`LCg
+c%,e./vmBs	]s"6MZwS[!N+^y?tE#x\AܴgC#za/SPl%N"vK*FDgv1^@%kXRd)He93)LY*=`P|-F#V1vz7קL$=O1ۢR$0Ѝ'XA/k5yNWji	.4R7w) >x{-9ݑ*[RQ[/iqZVcf&n9t|RWC06zx|p^F}ART coc6!=yiD~rk6zwo*V2⎴@p?:]N%.mm}]y^7(<*WnAml#6>}fk"sjY_OᒅˍS;uiQ.DZiOgĢSl85PL޴B!K'z,_<|Kw(ݼLRձy!DYnRG$@#jOxVw >!"	0~8bFT7p@'Cc*_?2zu$/a2G僢@V:-dP;/8gs:N$>i2bh7_FTd*
\ No newline at end of file
@@ -0,0 +1,5 @@
+j3OyUy$bO53sEˇq[pWIO(S?3A<X:hfM2,(&<ƚ'Uϖ]x="X.#L|r@rW3Vٮ	ҞCH}4<!ucGZ]l3;tł_bY:^}6<ުPxV~+9a41T5V)S2dpW6$i|ps{KX'Atym	Y]ønk9j'΀`997n~K{PI(+VGgmFE`&:4O4D9vhFwm\膒q9ѺA}?;:tD*b3(|N:9Kj>AGK{F,5}FGhS*ܜn;=zuEsrBafE;>Yv'ZiVDRAfϋlauFK`69h
+)MO@>S;"~w~z3~P-tM<
+Z\~c(V)od<$C]xR!+!DYA!1lÐ%EVMg5(8Hv{<ݷ-|_*@15JK}C9R'8!_'Nf֨/m>`Z= 0DГ)"ְ¬.-i-Ct1{ɺ t3gc+-IuXǁqN[2r%@}Otl\K89?ssp7˸*(_xS0=>.ըySN;b#WjBf *bCnA:Fwjk]].5WmaDb>j\yHNEx3kJkDރP*ew;a$bi=BtĔa*~M޻bq^po!YLIBh撏Wq%*PZ,ނ0a0ZK{T̗P:ZpNOIcx\?mC^T?:o"Ct}ZD<N#I%^Q8.	ڬÿ+!O.*會QC~U s+,RLpbpZ[\Ș&0~4J8HJ@!T#MctH#h `}so9K:ZR!̈cӍibJس.̋֯E=Nk2P{A) bxC	K+It)4YiMK_½?.@KO㐸UR6O\Sܘ
+3hH:J\cFy֢@91ړUx#pZ;}7/fp0;grSIyC`YjLgPh_gc<I(LJVP4R齣L|6MY9e?tα{[G֜?:,2
+[XzjT!*f)n%x+R	̩F<bĒ0^tgБh2?^էR:ݣXJPGEg).Ό5?_::7ZdAFWm9'ASz)2:l\pбg$*ᚣSMPDfQ.XgEN L~oUt2Uԁߌ7䜦GiWhiUĬy3?Y׆wbU6d`rfY뱭^vXJVڮ9Ƃp=;E,yXCp7''yҊW]~X}~GcFh~zCj.ahš9i+]ѫi~l)ja悳-[{=璜ە]'ȫEm¼dva!݃7YihhY*\pr*$Sd-=(B$ΙeYS;+#*Gï?6p
\ No newline at end of file
@@ -0,0 +1,12 @@
+AZt֤YuP܍:gaMۻ'ee>Ǻ?1nl![Yy;үV!]tyqMd/w>aXlqKOη+ǐ7e3Drj䭫uB],mw-eƾElAaLMXp<jT6urh05~5)5·sGӞ!ósrѾkY"rrļHoY
+UWya7[sPh{ z7p:	¶2N+4&Of6dVoY!.PPN)7ÄঐLnvh!gmOՏUކ_6*!*s6?al:df\g+J^!Q^>4L$VGh~ȷ*SbPƵ	'vo̺Je"=YSlFfmSP +kSUg\vw:I||wMVo7<u֝&!=Y-yeTq*h**$5-:-Yf#C=BEbnNm7l$dKkl)Lg.'?/6|A˙.3.oHl;/gτN)u7s"<88Fb4$IG*EQ[0O0k@
+	iى̡ݸFc#uSI%ze,~[S^bnjASursJV:[MSs
+p	1w?~/X|g6n=sm{XFqQW&4U	mFDwL7S4ќ2+9Z48e_D[D;^u,w ζ0f@ؠ()8݌7sRUN&M{ž7^cok3dV|$l"49Ġ[}02	<iP4+跠$A".0Pk)M/'fiKy2ɜdiHщLo?=Ŀ)VW3zqJ?L'i޹pv/ۇL:%?H0=9F˜W8:xa)ϞQz Ȯ矪t?XـH;z㐝'~JxLom
+ݲK935c$O-Hy{[l̋ݑ| !R;NC0Ċz/;77pP(B|*WEu_[5-dl\& 'u\S7jumu@ߛѷ7t58iqHp.8ǵO@09̈Q=!1#;{}g^g"}Ql}/b^NY2`qX--kc?]0If}ɓYNdOś<k{p5	vLcXSt?HYxX|77e'ڿqy̙#-¶SD78jɀeݪ0~[ia.AƐTvExQnPvVY"zT6f
+e_vz}J<;?Bvvۈ=%nrP,]̢)DY,R:z>}xG
+ַ'EGU{1_D:yL>a2pjLb|!LcՠH	7BZ%|Ʉ.//PI n/0/^GknI.u/a>/;8")D<d
+2@3eP.V=Qv0iJBYi(lˎ?o۷z;b!HZq.I<ip)[fަwrT иկZ3Z`MsE*J(0o^B7W6Qڞ=hP6,#u(q'8dJQfvᐶ0-
+<	wTחմ7/OYSm,`b߻ºhSk	G_u|O?|,Zfpr]fw<XQnŖ,
+B3T?`8iIˬc564|$:5rbIEoPI8$hAXBYP$$2Hz`?7a:HHYб[,vvo1(xuq/Í_[q>AI݀7ot86vwD{L%s'trIz(5v&s@z
+Ϳ+WՊ7DT^s8KEOdJH[^5[[P?䉟@t.AGOJq΍%=&i#[_צf;g`{-p& Onj2+j?U]\lЊ&/a][Jǃ>{<oG><|Պ|͹0{S=v(]ޫbY~fLt_|c8ojp;.
+1Md4X/
\ No newline at end of file
@@ -0,0 +1,15 @@
+ Bbi.FpBjpsc'PJmxMp)]wK㨑ݱlj9W%m3ugu1~W:FR?,'X,U&y)v39pcjpo\$AMӭIl=x'qhfAKu@Ki#|$,PSINz&qt47m-u?kC۵M<m>x+l%2ɋ5UiD."ONJdgyTziԺoc/2#
+au T0]=x`![<Zv0s+rѡl	C3&b<Z*,ŧ[b2wڬį[;E\y4aHzJ{maZvDdv.D-8j?qVxSw<?dxTA=iLەy]xh,hVU
+?&]LƊ$4`,(guqA`5:fXe+560Ϟzc(i?U
+oEBy*QD!G(I,U]IqdXZoɜ´";
+`Ke|ET:5-\(h}TC%6[4ʀS/n~EcoLRyO.8)ϝ'[n^?(Tڻ4K<{MUItbƨfKErw!"v#R;b?%0-:F7s#>S^Zx>ͧ1u5[悉FdS@S>a#Zy'Ւs݄y4:{K3[HXD#c=9yJW~|,LpjQpsqeBiuC@3ǯÐ!׀Ww?vmtα@g!/ZBM7b/Ht0etPD5ksƿuV+_ZD5!2LM[N$rIެV.0Jtf)]@mJ]vN*IN~GUoK9BQے Jl!R9L&~exndBYz<&|a
+lܦS@´[McC>ʄ3>f[٧ _YMq3$\GYmWKYGIݥ,A,qxp<xݗ翣q	\HQvɏkOX6>΄~
+g$BK~8r!PuaHAS"&64퍵]	2̱CBP;7²5rI'3#Ǽx+c{*$#U.II8!P	*߿e}lk$<VYd2Ѧq).avwFUإF'4U?!S]k,	j$<"eI2@(=h7_-(1	ɍ[:dPX[4b*^~yj!eFV&On9,ye_LltBn,i@x_	@|s9vvYsp13DO/N<-3ht+=5dRDhc/XRb#a@=#.6_-Dv)g҅vZG%ɦ_,*$|SϒDmX3$4ܢy-r_,qa_ *Q?t.c}#XB"/SDh1r˃|b?;hh.UR6/}]v,WP"XFIqrBc0KPTT߻sW±Ѩ|]eZՠ}"}={˥"z5z^הm.?ZtHxQۻAHbocPQp2H{H̢96d,߾8It,f*D0TO=P㺬7`Ø3Qw+9h7}6cK!K:l
+TuaOF
+.hk- VAʻVP5cz(LM;Tcx
+&8hyfYZ0lp]RdVΊPQ,Tc@_Owb"qWret.Y
+?)?q}B
+#HE*YMlVDA^{<K0l8Ū^${b`,pBL"kg.]p6tcs`PmF/dIPKj(nGR"\N9~ԩxg]om<'+'BhSW@yӆt"&U!QdE֯[Jev`pQBpK;"\ڊuix|Tw.zWalm'C-y#"Gx=	|lM5RCX}%v	{ger־Gp=%N(\RӄY;aTgOFzQk2(GwțPj,0
+FD8(.{'@0NRX,x;-[Q+5ǙMĞu{|"^nқDNxovEmroo8'4͠:@sU>i((5;
+bWo7\c OFW@;j+$yolS`}ϳߓYK1Bn*÷~GI^6Ј?+OIaQ^ǶYYfصD
+UU	7g&!9.o{gWdB8<1M3z=&h8~DhJT7hmg3DĿ%A
\ No newline at end of file
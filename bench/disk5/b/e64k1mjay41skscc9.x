@@ -0,0 +1,7 @@
+GKJ*6M;ֆ/vL鯿a6Q~hHX|%Tab(owJxВfuojo巴D	zZn{[.]};%>:s诨W{*qQ:4hoG30¬{)pFsp(RQ7ß`:Ke*&䪷ϝ_1:)X4JaY"R`8`r.x"mB3xgog!5m߱|ǧXRMqt()Oߍ
+<6P«ǅљٌhU;T6,9jv3'cy	!=SUo9^p8tOEL{;9XL߳7\ei0)Qvi-w.vn/MZ0ڸZ*hodn{~3qߺLPO "HowhEQ,0	]m#^$Vf|);þDi}$3<k*'98ME9π޶f+DL-%Qqk`hzB߬6y'ćL~}_Kw)zf6H&T4U46_~,n?Oao\XvOi~UiZ9b˼')c]A~XB
+QP+a*f}u~ߚ!pAQY	3l!n~2fI!.'A$wW(fƍ-]b}LIRhTJ<◺#drOtX߈lM~Å	V(	ݯзUt|hn&wHϹwTCEpiXl+#	S&r?APʠG@&Ќzi.\zGaSveʗVmΰ>{m!`T%G
+ܯ7'lܞ]k~Z$jȜ)˵ Ȟ9AyT`3ad>%b(n`+&ޕ	FLT٣Rd65,hBMȬtwރn;@nYj87(&.ADndb%]י@A|Z@yHĄBhb_$
+XE0!s}4RpWE|&D:_]QFٞGZG9N,Hฑ>?L;,kh̅h	\O;"J&p;d8#2^Q=?]ZPpHv5S
+vqk3ͺm$NA3w]K)ڗޘj?5nE^Ϸ0Exz()69Ay%D4P4N֘0jxڏǳK.Q(GOatɣBր8Ϟnkv{3H=?^OXRT
+ "~|k/tA^h7
\ No newline at end of file
@@ -0,0 +1,6 @@
+MzCŘUj*D1R+|xP/9?y.}]9n'7\GQos-PHO`0I-Kǽ!ݽ,q<{j!kSmWxR1ާ!bX)^o6[kvýWDj/Xӗ}Z9֡Y'fopt7E>rtP?4kT[x7qfRY6BR]|^wF	#\`Y9klG
+vyCwNVTηsn!SZu-=I}jwy~@/.95l,5-urbjNT|	Ox`!?[Pftjk#
+. )VUW]8F,-r*w[6tjmN@4&~'9RݯS9ܯtAlڡg	;@nA-rpV`.E'pqL[6&y%d)
+]s+!		p*lP7a]db(zmVsM>FԈ%9=S{js愙g"Iϕw4ԲY<U
+nTj!XtŒ?1?(Q1d'4O>'q"A74@y$:B7bakk!NP [_WTs^H]_-;WƔhDZeulᩀn1Q\$fqme`]|\an%ch	LB}JBb"l\H)4W.S[cnJL߁Ƙ09LT6>8Z2Wt[9z4D,bj٨]'eZwU$_8!XRBxGVY{S?C@=4 ,*ϴm*MА;]''&=hlr/j@EGsW"shj{3e!dF
+UE[ܟy +4hw=.8ꋎD<ᑿݫHb59PGɹiMB<&H&^Զx>3NÒS-X
\ No newline at end of file
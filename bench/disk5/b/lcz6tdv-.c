@@ -0,0 +1,10 @@
+u󹠝'U.-5P.Dm\w/+24>S_8E0wh͉*M;h-t՗_}WV٬<$P.1!]r'_nN>ҾNb<M@ng	{8rW-_o*9X̬-7CCep):
+׍s	Nfv}batI>Q5]8ґUwoF)z|D~Kxa`t̍`U{o,Cjctvnv9zoOeÛv[[spN#{qǈs5f<n.MLokёR$l:0L;F)OC;;ru%0)Ɏ{S6}#P^bіnI+5(0t?-&cLcnr:IJYMy>ku`UЅW-OOK[0sW$1LxilnZe]?Z5"J5]	#F.(/%iYC2?~k$3,7Z$2R,#	7aҧwM`r;B'܆?qp0A~2қ`BlԏatLP%yέ%lxR50eڅ'H1*sY/ssXZVrRl"wMq~('y&b`}H=U2^`=cVtiBJ_WF~t6դpVzÁiI~εT1rAԜa*v.|@g⇷/\JلhL&<`=2>1A}Ȃ>H+$Yr%5z~cՇ_n*XlIRVMdq#ul6r}ŃnqC Ԣ8rotgq_U}gVz-(@Ka;mi]\cЖRBC:'rrX5Bl6u@8'+?4js'}>4,&RSDs7Hm̭V/s0.4
+Y#4CcHZA(ظ_)ϩjGy_~/}{D*PFlq2XܒqUH1-{1]'r$$Ђs@0s=bJ0\.3~Bn.amScM_ԃ԰-EV-yR(bԇkzv{&nkgM*3Cyؤa
+5a(
+d1\QWK:u+B(ʿI>wF?,ruKÚ&Teb[RƶGER.4U6#w}v3y
+cB>SV1;^rd^KRY{iEpNt	)94'"[u賗	zS?m8@E P^{eŔ棦CDj_p;oku(Mj*AZJ`E%П;j	@iGF*J~ݟ7(<+j/LnW!һtOРK蝲2vktxjINnTZ"jWCUQY1Ke{Jf$Cp|即J7qo/xϣr&k)UvMm~-ΠpgTOLD_ETpR+|pRRߌ[2Hɰzг>j5Ohr	!gw}`c/2>!Nj`pTRk7ns馛^yZ
+X*TzQ*9%wzKGVE(*ށPUDb)c[y:(Ё$v?;B5Zue|
+t]J#%\!Z)_.Įk;cu
+9)1Ъ1R"Cw'ޓypW툽/g_ƍi.gmX3Ix:7Y^
+ayxHeBco3_C֔tޭAo,*y[E!;2@/EKJpZm^i@niPUXA_9z®6gE]u;5l\S|WʯkPW㳧Z%ˣM]'d
\ No newline at end of file
@@ -0,0 +1,4 @@
+	YFV`?.(
+yG!)jWC`X0ԑfO
+	̥,jq˴F
+=Zc"1o̡g\Х賈;~z5?iaԃr9Cʈ@9:fr]eǈvX%"ęݱ熖xg{1>uRx*ĜiD^bte$KC;MBawa7ZpO܂:v캙~lH<':Cq\m+oJACw6<.K,_jMl;+Q3u8DԙV=)'RRMp_F4l@ V[N[ryGMB4e?S8u4GKzieTnQ\:]'Mo:(E#3\6&'#JȏՆgr.%Lt='ԶMM?^`dg*]qD`w$o^s]yڈ<lF;ѶψNj#!irj펊BD?ӄ,c֊/1zhN9	xJ lQYUJ	魟k+/B4{
\ No newline at end of file
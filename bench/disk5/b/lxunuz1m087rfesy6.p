@@ -0,0 +1 @@
+9l0.xccl4.sqx5-gq50
\ No newline at end of file
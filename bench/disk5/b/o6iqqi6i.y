@@ -0,0 +1,11 @@
+E<`O\T57r|k	zsR~.^;3ׅ:rvofԩZ;'=` icm]Aծ4"pBM	ڸ+w4n&$HXy'ASh|e06JѓKF|I/tyssvX]:ET \⾁y`Jz˘-C5qaÚ.3O?,`J<`3>On=#кcT,l$֪߯^EHN5'6f~HkV&~%[*r-O<T+aڏ+JZ@fMC	@)P{fP.0徴Xa~Bk8=4GGR7/dWq߶wJrLէJ3G8	AXDцH8Z%eZLftT*+kw&°GdiէIe^ɯC}՞f(.YA]&܌-St[M.
+^aXs~);e!wjY%;<꼯){ef3slݤ>8N8O)N̺4YH}.8s+"pwRN6)c:@xn@!8ՅNC2]1oVDs[b
+"qLlϡ3j{[-@*
+׊eU\9fǆsǈtq	͊#U&6O%T8[PfVKݫ(af3:ѯTdvMu	W:~~poӪF(⢺jĦ7ĺYxTYV@v1ǫ8]Jj.aϻoKm6;|_#40F9+kR|}h̳3*+#q]n$H7>ӳArc0k$]~6%V;YnJrSm$ͧ3w"؞uukByVr,Ũ6$'8xnV jcCp`&kFR+Cqovr^CXӨm̂ ;IF/.3(9/#>dxkc1}BK3<^JoneaQ}_=ܒ0yX_WUyo9*/hGHaA"ڂ8#`q:wBK`%G<{ARߦ7QĐI̽3
+p w-pH#k9NQ4v37n]'.	^<+!'pv@g/uc([PRJ#sd$sև"%pK7<.[PgU)J8@TJ+w6y-O[cKC?j$JYjwGWV_0W]p{ j2Dܯ2XŅtuCafO[*ꬬir33&l!T?mHRcNa!iOrGnZX&@q_v|PC ]8YeC؟@9e+G>iBu{rd:s=A>ap)ǜяz2NO=BXdKG݆(B5 8-r4\Z	)W؟OZёI,J6Vŝ:زVGw]:}LWp![]!rvMJ`rMTQ/oS( (73Dn%ll>HNKGW<roW7kNo4ve婘OL
+Y2%IФ}K}ot.3CJQhu`9k}rJ46%,ɮb0gW>a6rRmMSO8XD<	mӷU?_Uyu{h97^F0H!mbLf[*;jb|hHo=\i,4<9@3*剦yG"hYRۣ뜩0C,̞;bع9_sn?]ʫ2SitE%﬚]I_-\."ƩzygpcצI7>ЏuxEj,Mt~OW@h*䆎Ev`I45|){N>Ӽ8r1,qϜ(_YK
+=6ԝVvugľɡe}p#8Uk~%9m&0^6{#pKN
+*|+V۱W~Bv@{)֎eؖbDmB}#㊸ByTzia[p뇆`0@64Sbl\0`7"KFYAeJ1j!6qZtTAmk.مp8헱v
+f)ADh(00<>34>QtZjM,BDܥ Aqr.Ϻf;Qޮu	q~։
+`cf[$-s}~,@/ksV}tqbK\K0@pqҸ>l|j9/`G޿xܣ8RfY_x	74FKGwYכӐG8^t":2WeCٲ!%gmL	U)O6M뗢"˽nP3ܸD1H
+MkXNc`Yx1RS'w|y?'7mTQD(8B
\ No newline at end of file
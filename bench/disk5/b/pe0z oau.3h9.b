@@ -0,0 +1,8 @@
+iKS1ƂIon&슮xSy
+6ߖ폼z<}D|h&7L)mvv_FXGpɼp&UD-720j{Tmaԗ-ȻÃ h K}cU/&]xԄe3MZ95bAZh;EI)^}8q}8Pș&.xDjIKzA"a 路q*j-:w3?W}14rP?C2'4a?dBDuݑ5)'鋟KASy@#,]qE<"oݗwzھCSQXTWe"֩7&R@3 g4vß9ZB$fC:
+*@yBy&ղ}
+2	\PdЄegbl/
+j=d=Ǥ4֙,1#Fk>׹SGJȮjL^yq:dkl8AG7
+O$gcݴS՝`'LVԭ/H}ru!ϢCGa0jd_:ǈ}8Mv9tFY:D!Fer #EǪ|Dy,'(aPKeYFG'oۑ`oŽWqOլ$x,W~uN[/ʍq?ɌnystAeD'[\)XW5:녎5S(
+$ryXFZt:b@߆9=I!/ʑ8{	XVh<5wa\r4n\O`<ֈ䋾"^Y2+id^j<+5~Z2mckbC*wAJAgbÚښ+4S+`.Qe^GΘ$=R"H!j	ѿ&Xo+EygP	RO5yeu^P%e'G5׭j4UN_1cٵ^{(El:Z(,9n2zSOHS֦i:0_BegBl85qG<up=S*GZ&|rV<ݮ0w8X+}	^ͺ=SuZӆ!9ÝgKcD$M bpmʽ_l&ndهK4CX8=d<(XFQ&*T ϚPL2f߿ٳ
+cdXMH?1֞)ܜ$PvzvԈRtX>%0wq|IOpαWŘlS
\ No newline at end of file
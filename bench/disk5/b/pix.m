@@ -0,0 +1,2 @@
+J6%I3QBI);m<.؞R?m2hI'3z_FC;o(H*Ѯ[WG3|0O#c^U;]c*sfED@uO9bOu4xv(P5QA[{u
+2ݲ+W>'b~DK<
\ No newline at end of file
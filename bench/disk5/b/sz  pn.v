@@ -0,0 +1,13 @@
+]ⰼpJ>\(̨WJv(].?n2'@Rb!5.1>ʌ{*.02g_B
+VM&qt}jhźH nj4Jŀu\HX7-X1Q{Q1%,gɃ,ŌEOD6F5+",KH%81TtA`TSbksNY01Mѫ~S돬Aմ*$'=y.|'i;`Q.NaÎ<{kZo`2p`3`OÅjۃ>lIe36V>	g=GfuoҼlW;O%2=_Ez&HL٬N
+b2aLK
+E6e|&](,M,N`hQ85rVH_kέ~ ^w,AjGH|eE,g)eu&B=DЁ}/BeJR\yc.H?CXL\l	*T?cjTR.mȿy}5tZuF4[K%mXr/&˵A$"	O*TXaab툣H͘7o2G	(rXѺnᩨ[m8M?U"&trt9*1	*	D]s$eaxF/iI*ՕiZ?F&-q>)UPI`l/d]\5l?yڌ
+n=ЂuedWTO@<y,,	wE6k8qy%wE+O1A6WM[Jnof[N"Hg+cnQ$B0A;fB?Z
+$Gթ~xIxI#5p4iZD4l`@ׅSR;vUnV^Gsl6iEvWg튝UOG.AJkƱ8ҾN.WB}b,a	(eVzX7pgNu9AaK"江Cvl/ PЁ%]2Nث.>4M[_>~ƄD;I(	YbXREy"z<	DU:_JKY*%Z_9!^F8% cyc|H$H.d
+q&=\El̼H;"ylgP2
+y5-\!yOdC
+LGcgk'A/ҋK?`tHsS`Cާ>֢	'Hq:7Ӥ(%;˝N3!XWtAN}a+$)ٷLϾ6C<M32/N^#]p;܋y'F_m& F5U5%[c!O p\s;^^
+hZ#}˨V46T>|blk%heOw^NY	.
+D8!,kiL7XcldrCHw
+/wK^Rv5WyLUǰs/\8Ʋ:GZ͙O7l:-t/D?B["b:dzLy@\]ԜE5!5Z5ȵKAnȨPTL='Wmlt ^68/OP;ܚ!ʝ{^9˭v@O9#7Y<A8Y럒%+VJ+>#M}ϔv*`psǀ,yٳ4@V1DGڷă{#NC8WE<VflO|,qP&J*J}+dOh#W{Z"AcUyhDN.Eݦouot]ybs9##}wD,>YAK\MF+$~YVlXfkT Mk68#IeoK;nEH:g{ƎӻZ(棸'g@D]~Q=	_틬Qp@'D+`gG[uchTL42Z.aPJl@kCM_HjFб!TpɕlfC	>=1|^})Cd	d|uQn*0zyk@y~),zh9LL_ۚl37Y޻	$&44*MܑsKŝbp\BO
+BWG`r8ދt4/?JDÂ{(I5sQvX]VK;SO|ϥQ:Uۓ+|җr=^f/&[)`){V!lirΐ;Y#}[3KgRQ`xow;&=;cg@iKmF+DtS#$9;;T-@vYT:$vPWHH_N6RBs"H9<K*/(@Y`Y9)U.8	2v{5{tն0kD+P(CG2MmL[ܛPꨱĎ&y<_ki uFQMT|rH~|?!}LMQxI~3w]:3y#ZE="5ڼܴއ䁌'PYIL*ra3fN&	8Hu&4YZ	:ʩ'ݠ$>/ސZIX4I27>n^a`Kx鍷I$lU]d*09lo2IFʭy/*q;T}!&
\ No newline at end of file
@@ -0,0 +1,8 @@
+$ǖ_Tό!l]G\66t~|E˕XAs|Fj$_BXo(wI*`5$)E6(mf3?T,1I[-퓇ch!Œ>N#璑L2R"kzӝk%	k0X;n-+ X("0e]2jC4/98U76p?Ct#>ĵN;bݴ8zimPSRهSS2]f^1S2_xчPb(0OFJa44jMG5=goDIz/{wwAm,ERm|m.eo^(.,1}XSO@'&pTSy`쬠gń;­LPAK\?Hh[T;R.;޺O{9MWB4eEˊ͟~Wp*
+r2=-A0-gg$mWo׊O8e<PaEI`56T<\m=z9WsZU.OE~!JWq2
+ AL\Ȝ38Ӫω$x:Ɥe| fGWl.or|qt^sR<_ĞHJ_ZH;`7`h)-fƴOd>+zcd!\Oѵw[M۽ƬEɔNIu%gʏU)6"Om&ARrk*jWθ=Q+LOݗ5Y!Eq]TOC]dɯ<`Xw|4 VIS/	T'FoZ&⑗=E;hv]eiDt?(DAC~4>K8:feukt*ї~؏~f@	/qc\$Y75 9h)n D\x>pO ;7tJCU'!H\t?]UQLTшo7+w2EqpZȳ91yװ8RKsCH5Ѻe"U4U[I[x]D#=PL(b\4ABPD6E)[|SqG7k_0	{B;5bsPxf9:aw	0eiqαP!YSà)p!Z,*ߪ92(C	W4+vo/L陽ԉ(f#ɝ`jih{{ϊ0DTr![kQThpo*? C/W}e2czTǣ.c묞ܘօh_x:(s-y4.V6 jAmח?z	5DiygD蔔ElnCn@SW9j,EUbjᄠJ N;VnTDt˭IOk`	9& S-6M5-w~J};*dga3R݉lbt|Ӧj.r6ܺ(HðdcܞJ)d]OvJ2|~]}=gm֯5QT@^nI/Գ}NwHC	RlCy{pE?w-0.'(@6!E
+y}Uί
+z]Xx	K`=px{%ܦ<`6P$l{ަ~h|[ _v塜EKb_R=D;UNgո}hrSGOb"m&lW'k	-`Lns	RlhդiV0ϐo؎Yvcțg7RzPL٨d(Y_$$biR:Ԗ2ƇO<#ФjU;1Tp.e[>Qfs63TүH9u~Я7a'ZL!^{RƸɰ˕ba=e}6Dckە@=Z/}78ؒ$dCݡ&'8R杇A̧<xS B`֟*VqC$
+z]+^JQ]WX9r3!^Եaƺ闹_Bjd6hY=/'he\K!?jP`M'+N4dWyGRȓJ&Nz{&7ڰC>Vš_[k3Dtr{Bd@b:b<4O :bQW.CWD7m{I/98x'hOZ{f}qn".zǯ(3[y=wZ_G?XgXԘu`@OcFviGmY,_R4וcn*&
+|	U,'A\RwwN^>/ybQv'^yT@Yߐ|+MJԛ+"̭:&YCNYcrg2C
+bю+]?`F0	FBk,ꥸemCkU*clȷmb8&kNc	UCK[x`u8n`U0v1g"D=t3}oYk}eTKtQ"ũWö[' !|h/5m0`U !L"օZl|qWTOb
\ No newline at end of file
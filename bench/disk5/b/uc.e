@@ -0,0 +1,5 @@
+9jlk4{e4!E>ye3ÝU)~x3d%6ؔ$V4b5E @1o/Nٱ;KIV4.yʉ08(Ð*u95z"|`SRV蓌z8mW+68	ZG8KWXϧ7c+]FCGmu* ;Y"v31
+?qOk4b{;i뽽H6@Õii5u$A߂,YH:g但>
+&RyKsjBM"ݠ,N;SHýc7Gi˘yJG2总TH!07b_Dj/ye+|a|oRy٤<H0]FIao|z"Aahʂbh=UJШ8G>PTTXur&Z)øᎈ顤n#_6wցmUٔ:e]>{si3EG]Fw
+}-}BD7D_$sv2uoxZy}b5T	1b5D{Qb[69ac[#JQ+~z3^yJXKZ̻ljirwV3" 戺[S:N5^QãkeyڙQ#hȺhh#ͤ ;N<6gٔ];Wl*pP#wh\=~^>xSV̕f8_RcuoB""s8u#p|٣+NOuc+>]Z%Jqh2Kjԃpیe:XHKIJFRы^K'Gs7Yjk%]ijFϭ7GNSFyR{Xd@Ϋvߝ-Gi[i`)iQ68NHg{dIO5M1pt.Y$B_BY]*OI3P"&@i18ffS{
+ȧݩFuhW&"dP/QaiqG(K;CB{##SHg7}ʅ]yeL	orЮ̻H-=?B?28ԅ`]7YQ5i;g-5>:E5Lzߜ9Yq]TGOiE<UQ⹘nc)I9L(Xζe!*햠Pnv"feٵ&m ۟J~D&H~.'ݦW0)ق5j- ԑ`O"\	#dQ\	*it?	_BXr6ziCB<'w|16C[Igg=SW[UT7lZ/=\+DIhw{ŗ/NMDg>ug%̟%pf Ĉn0'={M QC)Ercq}΍HmNd~B	>¬om0xY!LhMC}3Pqr'V׆@5--X~m_	oPeQڷF~o8Eeb?ԽJQ5m>J7ƗU:bP;hfA{TL]u)77Na*nu!!}S<xbwRAy6lRdUqpt^yCq͵q8C#m߂t`}4Ds_[:@
\ No newline at end of file
@@ -0,0 +1,17 @@
+@0kJh];1aˋmAx٤UP0OUaCtQ{!_f%ֽx9lTj{%þ)e,Q~@}2ۄ!>JE/{K.cO^&˔:0w
+b4(x?@_ѳA\n$NwD1|bRn~ػC4bN&P7T d .\.~ӻp̍3Oiј_^8Ն\T*j%Kf:0"KY 6~?4H'!C)QUwYTe$^#aOFf,$-Px2 ~&h_W[8_,
+a)a^$nz(PAǇ{kmJ$F:ZtQB&.JД B\3LApRIJ$4UӐT4?4h2Lءnc*{mj]՜@{ܳ3G7,):ɇLf8iin.2yJW& vUT0v=HKAb\>?&ij9jT9jJY`Mi1-629HwӬa'yN9Nz)j[&LGȉJWgvhUDx$Lx-Vah-͢~sS_>(W9c6L23`ֈ/z֘y`Z]PĴ(aHgK<D j8p	sG໤Ai7tWK3"#;#ï;t`EýZjCvD(pCDyۊ
+t!;H
+uSLGaN֓#$cA|D4ZK~	O~/3,٣%SP<8fh9+c%9Iqd
+%Xy
+[ÊSmڸ1@@DEE|HezI5Aݡ;]t8AOU΢b&ެӌ7Y2n7[qZ֖2ʳF?GRc5"-b{\,W"-ڦ&uCh2
+M{[xɃrpK@|kHQ-*a,&wUG#;L+N=o척hE^k*j(<]|N݆9BU-"n@=u'PĮ<-|z1x/]Cވ&i'C\WQg
+s}m[tZ`x`JMKm`q-.mR~жԖ]Azd`Z͋W;}^a]_\|+ӳ>ݟ7!mᵑʺ ^nH0-˖peʑmlqBMs.W8}a6WYǽcyfgw^u2
+깞;9!unrɘ^PI#YU)|W{c^z_M,)jT/+9ᬘ >#F1?'	M_rj2C8>BgՃ\GE[؇\;x^AT.m*cK=(4SkHaAK=zE@U	~:*&JU;D);{$JEgDhf)H8j+xtci2LKB[iY+ND3/*C.j_˂3b6l$MZ*0e/*){6b~='^no;ĬD3߀`kI.eQ{Jg~9h[(9hpeE(I @RʸOmĕPWUFDѢhCv|dN?]y̿Vδ)A{5̧u_Gq,јWA(J]I`Gc#`)|DAݰOoRt糌AAp>.h~hK<UuՐd`8my0kSX*-a?OMc}л-f+-.w.A&ǄCҲ[1h!k|{a9(`B7팰daPKzl9Cs4-tǼ
+1.5rIO8>;ޡOW(*ZP=Bj]ONSХhZLj(Gy**g,L1&"8  ċc7SkaG^<	N2Kz~ǧpE#tCbT9-68b,\'滳TX4R.lN؛U\zyÜ捀FrbQ8vކrkasmSk:UVHԧ\yZX-wLIG4T7Y1K"Oy.]֭ڗft_Θ`|^y&y	jp^U3۞zϾ!dƥTl5gSophx)2[{ڿأ!Ml#=MyDAp)	߯eI̞R7_m[N[0zu|{~Աse͸%nHYLŬ*>]j1\CbB_m||	~OҷNe)!;XV;$f)g%PUva䭁Zm||{o:y!	>2AǓ)\YN3ĭ4&b۱Ne^J*oa䋠j!&VT6%h3G|^g2/Zg:$"m}z?~Cn2>@ADZ\3b|<'ٷ0n
+ێH,t746|ErKK"\v2+VED֬J(A߆/&Js&K&|X1)o4Mr݊hxA
+z /a|W0\
+lP3bw5kΗجг0ԧ67ODߜәJeEA@$I_*4NwGb
+U:Mt"vdI
+'9`ͮ48JtIhz/]eCD}G(3
+{c4gOu	=OfP>fO	&+2Fi@*OǗ6EQ_BYo'$`x	i؀R`fJBoM,|WTyH-e+aZ*]E%+.L-#\SZ֩|Sls9RĂA~`5_.Y~GaH;'I!֥kf\dE,o4IPhIG/|t<WQz66rfYz_65sʽq6F93Mܔ{ӊZч9).vXXuj.1&f3p~"_pDf͢UD&'1Um"0- {cc`uޫX>pBo`"
\ No newline at end of file
@@ -0,0 +1 @@
+4Xyy@)|Db"
\ No newline at end of file
@@ -0,0 +1,6 @@
+,KWՖ肠aklSEW?s_7vR*^g:ڋGS*"Xkހ5$$'u1=Qw'{KT?\av9'|ivf]B]e#Y\de nGe`aMa꼢Y;v+;ZWb܅K|)5b'МKqH	ưլ`@zqq3o	ŉ8=qy&BӀ,SHNHyv-3դa=055;	Kr#˝(nbYs+eM|ɃFD7VETۍ&y	'b-N'"6E̗䱳ݝ3=zmW%V({0"0Z5%weXe}X5iJT,	_u}Xz7lwďL\ϵ~%5pȑ BóAE5-8)-8H8`Dv{6l44TA-ݙkuӫ}L:sкO`=#A\b_vB:'RЫ		C5WU]˂GO(B6!@KS^~垆US"J[% gh]9?X4$҆@8j<`B6lщŝG҈WHr(]`#O%OT85
+sF{^~L;xL4)ȳ-շbZҕ;>޺=:= 	sܢy6~j(\Oз_ɥ	ڰXjWA},k5P|&%q[slEVGT ER^~bp#C4 t?vB_moy1$[j	"QND[fضmD"77%5Ce03LBou;G$;VXL#q<5ګ.F+աH#͊ܞ3<Y`+S$5tt	? *[=wg˕_rH}T\L.XÊNi tSN>٭*J-VX~'~Yuɽ`no::&#;]Nhne/z@dIn/m3s%I6T#uٚsO$Š??cFD I,gqxF&Q'm(# -m{U{t/̌FG3]LLZ@R\>1'nyr3\lfV5"Yͬ^Z'%d+y&aKOtwcB3q*ټ)DELzgC&.f{G;ژ{hj"y=MdTF2V>CD궞f=}9ڞJ8R61
+Yt`~0yfy<q;DrTă4p"G27ʾ-CXޮP+jepqߓYd3%"!S8ļiG׻-$^;tGa]4xlLN%x:yLdQ^Lpu/(%:H8f1R8)[5a9*o*)@{'=X}w ,?atn*Ԋ4h6u]Aŷ[0pG?.%$%W!^L#<FMlN%\CUƝƑU~Nb<F
+ty`AݗJ-Pd"\:\4&g/mڢ[.+>j'ә0vGUӷ/|| Wr@8"K*q"d+Uy\'`!Bx8>c66p`(p`3),;"8>TQxmz:b\KK$!gAMCkmP6@Y'qP}F[3/t$][ʩ$-v2dk!NP֙
+]BPڄCCW9"[(܏
+>՝v/Q*&e5-U߃(g6@(o蝰c
\ No newline at end of file
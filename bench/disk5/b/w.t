@@ -0,0 +1 @@
+_)!ӯږLv*qgUw#}z4Gjx̶x|6/>n}xTc,zcBpLBv:!gL?"r#k*,F	VGӨ_A~}w
\ No newline at end of file
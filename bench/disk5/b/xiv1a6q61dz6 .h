@@ -0,0 +1,16 @@
+!O~haD0aGv]NU0MdEE}3̡LcF/&+1[8V^:y93: R>s526$Z;),Vr3=O$csIù=
+lҎI4-DFy@U|JKxa)hݧb]%$UrKIh"j[]`__cM$%ZN*K|a?iQB%Zԣp/	æ=AZ?eϒ%d$hfo`iбélWt#)cpAת3>%KOhs
+aK.AEs(6.^UwQHHCT60v0;k%`uXũu$W8qڋ8;ov*|(j9j00#/q![Fޚ2\(P@_.2h{4|XMP8LHk[-ڐݨžDTQttCjl>àtkp;|p@%0^Qi<J#%8!|馠އ"Z0m6G~$676>&yCn/]B$Oj?KȪ>HW`3 *`ŭxB	8{S\S%9xSzE{]5B
+qHĞ	fp˳rZ94X}ì8JgjNIdQR&BXPyhԂRx-8-uJΩ<ݓ[ioඍdiUX~rЈH/9\SX}:JU}'o^۩Ri˕SLP)U6"zoZGتMʕqjL1'WSJf\faONÇ~"K^a	&c!1[&lLS U*foD9h0GĂ)oOb
+*z'9	Nr
+{ݐ	3C-Go1^l[d\ݨMsuhC?
+]-.
+(PN[Ls\ˣ%T|^-_źC0eݯ*(	1G`l#\3dD[pCkL`C'[;cdP~ E2$;0av 68ǧqraqo-˖lP{{kmE'JC`g=K#s>6ֳq+ThmEx2s}n7ſłtB.sMgƶ[|]QRJT8.uk)q7TXJ|eK@t55{>4Cj=*-߀xIx\Q!;`S\$bApƇSϸӌU;ɻ.ܫi>~eS>ZX^E*n*;&($G#'uQ4H}i51yOle/9$O+6.yF48]nTȯ6}들!s*W3ٞ*|&,Aq&Lz)z9NIp,WzLXnbhX8Sb6=Xä=fǂ?!-лG+pg90ib`@W<JS35-ǝnӔ?o^Nz\I
+eg37kj}Qw 	NU^\?GnqD0ƅ`@jULKٴVQzFIќ(VG r_
+ɉʥ!Bi^ɗ22
+BSA?:Q09r$mBNC6b[g݀$?BMX.LwΩv3DNZ	jCqT8qZĮDfM=_Ek7{z 664L}5\$*|E7}^lAWNK&"O!R3ޞ{!k&^G<;	750)'V9?sJǎu<G:U3(䃶䑷KǸ]9$y4Մ[ܗUl}ũ	-<sǅe{bM"C!nPt4'nn=SB	E
+eHP8z*7"-L)$Rk	Lwj
+jmƺ%{bឰIK:9mR~22_PjhfFb[J#ڃ}M0滭{eBQ,Undóa$(!YZz+PYl`վKmhJnpz|6bX^`tU\6gyɪ #:d5T	YN~^SOIePLq4_Xp@}CD!N+
+c૰_`!?!N"woOC`v	SI(3mZs}lZ>A$uVkL#D1TXk"Έ3.7|i>ʩz5WcHeVB74
+0jMhf?%fIjp\rQlj_ɐA|Z%ɐhٟXYwDjlB&>mHǆL$H*(wv4Ǧvtqq;2q	ӽ#Kj}CgP\yťymǊ̣;0$gHA(UEFUs#?Y+/bɪfҙC""	%84)T_wrgk>ǈRb-Y	5ݙ>~dDI#bb_ןEj`nɺVH>ʓa!_zANL}jű.Y\ϬA57S!]sl~U	h8M"q$$G*QF	+Ɂ	Ҍ{L%ƛqZx[16e'I3{GHX`5ѥ#"*S$/n#VsH?%jofT֒x!AmǅQ1{ߺ&DnxX$bBOxADQ5cppX':'`%J	yBW~?甓{kF
+Ó9K,bRɁudy>Ul+ր&,6I+x$Cb8%k&x]`Fl`q;}dQzs_b8\{1tJ7}}yC ݕ;_}=ԝ-R*Vdc"ؔ zO[K|}e֞6Q@glu 
\ No newline at end of file
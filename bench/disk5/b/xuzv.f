@@ -0,0 +1,10 @@
+oS5J ŁEZDI*4%@-NI(qJQLEtpqOohvJʬNxyA+d䪹kE5%i?ZlЊ
+:O18ctR0<}ă_"c	GbhqBVM$e-y7<ZޖdO༹щ
++V={:hyQ,{H0nD%fP	SPzmv`0^nۣLp!83x3C6W" LMGS@fe꫹`tq|iCyLp6V*LAja<A9}Mr!B668~;D'5i{TlێT&Tk"\FAζ=fi~sh\Tޑv&LwIjUd3-j
+y8!Ѭ~Fgqfޠ(<^GPGBS3oD2^
+1>D	u|b$Ub -;B=V9cAci!PSgėA$dLV,cHbG$r+
+8HtB;[*PdQ=[`=qbV`i@_y+06(PM~ZFz+TқhSxˈ>Q#GaSA1uzM(.7x!kou|Z^I@!&	i-I;I>4@cNU`קfO_+AJrl("Χ^㎢e"vC<ws9<}̯+,P./$1&D_x1XJ)^ST5PxacVCr5Fy0Lb椈\^_+v9.dTW%9_FFHMvl;ͩ#7[Q<F?@	~
+,6g9.R='Ϗv|Emo<m&0~N2$({Tx "a+r@@i7@r%D[
+RchRq*)w̩X~jy!V4\.RPA8R~BV'>pBMvDj`J|HV:S淛dc34"FѾE2(Z;7La#ƒ8f1?Ơ	kuŝz|-Ԙp%Dџ$/4!VmIJ!iA(k\:RdtiO͝˾_G>/Dք3h=N":%˞FG~9_dsYZJǸTWLR+شMz @gÁ%`E)_9l[4_1x< *f̈$pZé%ƣ.c0I.=T)uډSbl[	2ayus@(`P3*8bb gQ6YQGWK={1V%{/6' >]vSfXx[W7%渿g^i3,Og@<(刣3{:ýaڣ"mL)-_7f\S$9R*Sڎ]N@jlL@`-ޕB!		*g!/شwN3"Bog		-bfs`A6V#xWp`qM4</u.ȟlBROyDD]3`ɣ%cf3CSLYIK0K<ڗ&8Ď!r+ZY.tf(e8rU ~4fY`_d²xOP22VkdA)!'[V]grA'%|HTe~	[
+zOCVྩ=P9|#0qk7ˮmHދ<@ܠZwLr-_Aip>ycutHfP/*U/6sΖlu[ƙL#PF-Hn(fU疣`n{:/&Vt[]"`X(	i2/~n'cNV;Ue~Fu*OݘX~)/XS
+PyD`Ai8])=~97:rv;^ypHRgT!͞GBToXl/z͕wUIV;]	LrY¾Q|?`w8#oA:zm6,3U2T׋Lq)9^@0lسrCLL6䫐.$bNVE2tMoQ9*NycCf Vy|SݮdB!sA}cDͳZ״D;8&!Ơf[dq!U+M퉡Y6@/8pe'uLu7 cW#e48AQo^࢐]MZli-K[7w/KI7eagcK֋o߅6)+gT.>^+$tR1fvûP$ew_xωUu,yg)[Uބ4sOưXq1)XFڻ^ȷǿ]wJam1oMH9ZH2F{ L޷g>gE3Ӎ+u(1bjR`	3N#:{	IT]M^P8g^\.:e0ժ/>~s뼇DaELGzi%K 	SnmVSCVėUʞf!/l[E&xa:JDdIϘT_=򧳜u`EJO+$"'DHvqGL284)u4H:m#=QˆaD;qG;p*]E?֩r?~iQ}t/l}yURR:DZRGK&J01"lPi$CU!nȩvS"VqW("E4y!Y_u>s~Of6%qɚ5MpB tSAlBG.c3ك`6\300 x'2O{i
\ No newline at end of file
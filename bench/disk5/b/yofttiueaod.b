@@ -0,0 +1,8 @@
+@/$_9_<vխ%-8A0X)cYWǨ[xhAw'"Kj Q (5阾t$J*Hеy[X(%ý!qx1.$E$_M?wRhI9Y 5J-sP=7\<P*d]
+=x5_h*r#vozG3iSr[.V˟9Wa+A8_g]t\utp8pOgvu[1t(~JlqYpo K`R2c=6]dh'(XўE*:\If
+*t1VL*4<e25k%"U/oo1ovBСgI^1-GŌ+'똱Oq%hV7.NqWkⰧQj̏_˃=Ln4cw+ 2ʫ1~v'J݄6]R m+@)7[A P7jE
+.q|<^m~ѧļFBSQv=_pBQݒ,,95}kYߌq*ςmjE=EJ!Ie
+<fs0`=;m5#&fȐ<y]8:>sc&ib`1(q%7(^Q&&5GĀT5-uۉζˏ0GW,C-϶L"aAY$oINsM9ړ,q0Gl)gYzcH{An6EV &`J;bﭰB~HƼ@Q=}Ka @b8KyAJ00Du1iW&0O!UFL'jz:gPP$:In1׎쑾nz݈ǮzϾБVxP^xD8ۍ-kS&a~#EH|`{Ь(P:ZTo~¤C&;>xR}A2(*@iA&XN	Mc;/:褐)V"A`z	!dӢ/B,	U@ϣg$fԍ+DBXEߢϢ`Se~~>0
+~?X5Yp|~ڤO?;i<ցA"z]	Rr15_`=p&*4RKıC+`i3/h.)StDRѰ&?:u*3,;ME}B%:%qTf9jSe
+
+'RǾ9z<ؗ;`0nt+u"P/v'˗*e/㣗v2ҔVּXxDGV!5 @{h<&r/P[q4K'0%	Z]N4B5Vc1a'ǽ&ӛepAwOEq1Zqb G\Dvz.&Π GW9:Ѫ4Sqjy)3OqEDŏz%AF$`q­{іl4'JbpR(fPvNADt(L}rreE-6K3>f88c[_aa/f}Ơ
\ No newline at end of file
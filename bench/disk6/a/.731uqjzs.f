@@ -0,0 +1,13 @@
+uM6Ѣ"E:>8;:yp[ΘL.IN{|bHZ邳Є,Dt!AЭ^-5yj"&ǚxrb?_B!	zC|Gְ࣊+5;'vѬu6nHSmv_ GCxiXu`@Yȭy
+hx׽ܽ?h_)u.	'8-HdX?}
+c5,>r`q<lYG]ll$C (I6g,״!W=8*˭&eJJxP:'Z:o:,DCƸ5/[sveeݛ32R(oktyPm׏z{Z9X<!uy驏1o5Ou"ǻШ5Ry7,64mdLtQx߈	g`foi&Hmofí]YAO*Y.6סɄ]glb[ohdkau3(8HPuddmҖ\lSXkV0B1i\檢X҅.R3aɱHI/~}d]9NCYAB3~T'vs;~Af`ӏY wA۠DǼIgi{w,fZk&](FeJ/zgpB4~Dt^1֗2W|;@nnDeβ4Bu4JMvs+j9E:("BlT'LdXTnZŲߗՇo{oACc#0_LX,ӌeM1
+S8|ô%Kdb}Ot\Јf
+mdnv);+vUc@gre1a`ԚGw;8V-%^Oz,jIad0(v:!;vu13 hF[R}1hc&
+S7?t7_m˿ȄMˡ^q3{x^@1z$#=m06u?7qT!?텑XL4K[<D{7";v	6[Bns*!Kch~LDz=	OmGbN1&
+W&ٴyBs!*Qpʾ*lC;[a7R.%qUDy'CP]/@ah/$Aܵ.՞ɵ 7>qQKh/,c֓a"GW=eBA0@PxgK:<m]3%NIݹG1<F_
+ϼp5=uzM )~89tL(.vh'dnaV&hZe(H?[X'K7$M*A>􌈘w!N?ZF"ό~,3nr& &=|a4`}F/T1o>d.v+2Q }dRǸTEKVf\mRb:uyNZV'?wd5LUwvyO9 SВ`Of2#&.Oǆ~A7RGOD^@qb=O{zG(Q0*hZK8W7}Y$((JQ36ӚHKJO.m8?vCs#[5΁t f`N~ mnoR9qh3nzprNCYnZDmy	:޲O0c!Jkqb/ꝝxgц'YapfytVquNt߲	'HͲ1ϔEhUE,qWc!A[X".]LٓB!P-,n<Eـxc0KTڤOw_\faFNXBQĞj0$iNࡶ+/6@pjp6>(u~+qU蚚6tWFf/gN^chiw3<_qNySULLCFb'
+shǲ!K6ai:hYrM`+R!oM!*ih"]3[{92CS:EuƳ;2e':w0YIKFRo|Q_.wŷlLx_8߂WBN@,/|kJEJt!ߨc*/@+c3͑Hp$0]+AqZA4-5#+{\EuC&;96aªԛ7/2PО+bP8\ f<ULK_KzJћW6L@z.!p1z@{e>{cRjHaMk_ƯV`d̿']a$PּHue^`4YA}7q	Fw[cRχ=s'[|r{}hd{YrF^_hKOQ,)
+00'	f<<j|mZ6	0Aog٭48Nεļz?I0^Œ	g0EAhΦX~g?h'޽OvKVku>ѹKZ
+Q	Km#T3TdT?ua_X!՛PkNpUW
+ h*rtyVxӂ
+r>T.j =!c0n?+$"ZffJ'#J N8'a?q+\9/!3P]p@hFך;|RۙgndKs/a&It}UX}49V#	5bwuf0]ߋuĈ~(Ǩ/Lq1զ/pM,tЦ쟯/fU%~)˰aagI7._ahǌu~3ܝo`c}E_/aB'f?2&nRRhT{FuX<*-ήPX`46u\%cF)́eUEv2
\ No newline at end of file
@@ -0,0 +1,2 @@
+][뛄I4wXd]e~o`[I+<ZHj#jD_:ɓqcz\eiT&2Bᾡ=0	0j<C.h$X7AX;buEh?`Idh4dSM@NH#KkseUF Hy/67C*(S]:Yi6^	"LF:u;h!p|)} LKThPriprш|s32#m)Lys.c7~>VRdV,g$w3ń~UdԦc
+3UV0xnKo.B@GB_Fp/`ݬ	WhD?4Wǩ2*{w\1(/)jKǰ[jȳnІ!W!N0mDt;nuXy#t{lHA+oT|/Qll?D7'09{&0UZ7!כj
\ No newline at end of file
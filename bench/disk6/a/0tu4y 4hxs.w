@@ -0,0 +1,17 @@
+ +N"c@1.'FvpLwn%M;\]ܿx	_3L$k;AW"WS|*)C~"a{e.cf{X;ۜE;v:o8@po=j/	EyH8WŻMﵝ'#md.in3cKǘsx$~&Ŧ}X=SB[o$|YGPj936Ty%tT
+M`Sm$$w}J>Ei#atk_an>KTWPo(7p}4<uo2(Kngyg]Թq1_BakI
+A35+(NKǏK}&JmjQ;:GpCJAn~TRk?sDcea
+]s"Ze$dQ+؞8:iكN6)`>A5vas5dd۰E1mȍXfVlr	UXMB~S)[u+pܿp"Ўj/mNZc@ήKp)~=Qioe	NZ%0Krς$C Vۖ6BagEZYe-qw+즒sOv`*ٙ/TAhVbU²+6-{Ltm !a${#Tͷh%
+K֡1L[Ԣu@ȾsNE#$ҠQq7tO 񒍶P4^MY\K4?-p
+rVYDZWhډ[GS{&dD	G10#45n>bF.DTPt՛|q\}~wzPEg͞B}ǨG]yqUImo29|bS|l'ꚱng.Ԓ$m!fL.}@:)!w8c4>uNWfJ@Hi~0w-|#kԬ"V{߯>[_47$fO7%Vje ƴMg)i$ycI8	QBgQ	'ܜLiEe|$&~vҦp6-6(8VEE9EY)8faώg^qIr3*ֳIںQ+~W3 O䔦k6)I|1]H3c.쒄AinQ?z֖4x{91Fu#&HvTo71X0l+K'dFORK\)8Zt7SN8<6UuQ{1.Xi><͐^ǯD'j7h>vf!
+BND wA1rӟZ.m*2)r(F,>qt٘9\Fk=j[KRCWa/I/Gp1˭V84D`,q!ɿ~[o`	tҠ;vTe@h_uKL
+eiu,έQ<qE,Ï<Uy}s@u7V8S?c$Ub♮8]:HFYjk~7$KUWţN$ˈRV49YgRѰ3UƤ"?썵&jCj>EJQg/+Dʾ₞2?/T(ivfxQ;
+-߉<7qk܀r:'"<AYqdső}3.Ԭl0h(?5ңVKS:[2jiet[u(sX5|l/JǅD|Z'F\<e)ՍgCz6>h<WT]P,,I2̉vۃӑVrUZ8*3ѯDˑm%x53`n&Gb5M&s$)Y {o(O?ZGu Jϕfg:V}zS*	R_[-*v=T򘸆4
+|k;=jfoF_sK?d,'=5U-?`>y~^}
+>dⁿ2dsAN ~>1Ѡ'.V_]sv5mhjz,SNv6\|^ucN	6w&ʊd00ZH-G~CVἈeqpVLEd G7w)YvsrmՑLx\X-eKpT]8%udd	.
+zQ:1*XзM@V)AI\龇IȜi$cdډvB:Zv6ˏR<Y2æS,_[l!YEkgdi^FZr4Ͻv%5Nh<֚S'5_fsw%9ԏnۊöN!ul0V!+q,!.Ig:Ug4};e4!SlSF#zsA3)f9]JِT-k;]N#r9O{/+ޘbJa7S[Ǔw9,GDҏs֙_cyx LipNا+MBk>/@aj1YI
+7̞u>GY+Ƭ=pä`nssǏF_Pؼ
+@Rm)%,(TOee&K	ezoYzdH
+PkFP)g0MqCkZN,RQxqD1(Xp玘aU<rӜ9*ͅ:
+DT^{k0I``O˅ߓxS8?O| ?"oww
+_YYl%~&mwU^~Ls+k_kD_dy.q67QhsŰ7`%l?vsNsu^9ebaxZ9u?]][j:N5z=W[~!))mWtIZ{o|%LZ	i|ԥkNj(%9ϬJ|,cmVHɱEA77DF<;O/2T!Uv4	$|(t,i+|"1l
\ No newline at end of file
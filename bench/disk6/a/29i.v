@@ -0,0 +1,2 @@
+
+L"wnIksݞ{Kk!Ud]1^!uA\9diw1atX<dYItn_ߟj2d60b"#'J5x5SIgut@t4\&QʤB6Jx^x# SNYxarfG2`3kˢAu2{d/lОwS$q\cv
\ No newline at end of file
@@ -0,0 +1,12 @@
+c?1ՠ0muUsmXAc>Y(;廓dqVaj6ЄBF=yY♦ eP{c`\`HEP:2C@TU$=f۶6_9&-,.GrfV@ybiLpm\Yk4~җ%Hk*h/n\?l_:#=jm^5P/_%ri,J\ͭ|TZDs`eO{𛼘$}K6[;Z(K,br9SU9go	^ĸ[{hDB/:_`:ǋW\{Myi0h"+2)EׇlfʾEEJ{cYD|	ۦ/$qDoK@z,@lm[}y;Vd{,7K&ID1I&Y-ĝ:џoƊa,Cw?*vd-ozFFa"kc	"[UH*9٨\֯[#Әӡ(=TU&#~`tS
+?$yS wR+&H'\b~:ן"!\8k4	;PeH >N5G7VjĘa[rOͲvO-W~o.tU3DwKDȮ6f7;zկIs'@14͏a?bq~N;cp'K'$A?i7<e4~ZI`}Si^s^Al}V뼉05$HGܕe,2vaj]vG1۠׎}^LN缮>_u%L09ȿ<}'-?Fϑ QuMJ࿙M$GI
+E?l▂`|7UDZxpuGdYrT0zO1۱Ah<ˑakc#]cT`'~->@L1E(0C̽S_UEWIpM-護gJkc'r}hՉ-fEC5M3/R3f6&v	nΒ-8Ƅ
+AvV>8L0N،w^l]=!WcX&l'yD*
+Ec[S]%7Þ:K襻_yPq-:ݔ:L?ܧ*C9^Lh%Xi$牳}ToQ_C 179޾aJ`++f<:21mrФ71.WmSQutC]gv=_K
+ɝ+..'[cYAVz!vqlqX&`UߩSƍoL50z֝C{az}bR۹V9vS2WrE*9x7ڄ,EyТc~b9ǌ
+)C9բOJf?w	GEi>QސR\frd5v>;R%S}^ȋx|5sm?e,1¬ȆBfվMTN#.{E86h>:	kw؟*rI9Oiq=i*T=5
+ɋëI5x
+I *=[  hqz%)XT>uG$o&kO4{ͳ
+<Y73gVpR{C)@^Gה;;xv b2vC1Kk΍`'o+k#$Py\9t40tkaW۝WPsYx!gEkwo5lN.
+ixzZmP@Wϲ|7w4,%DԿbVvz\d[C mjze8C4Y
+k{t?rlK ?8E.hˆzl/!\/b}<$ㄳVFiRԨmTSxpJC5ŲPOy's~P>fn"R`q}Jov1"v:J=4YFxQ#))5hXC1+NYkZ/v#ǳE'a?M,ǐ!Ԯ`hήGKwU14˰?tE(9*.w%BYy-?3543ESn8,v&oCJZ0Rrϙ4{pI&^
\ No newline at end of file
@@ -0,0 +1,13 @@
+]OWGPNe*~XLcu4JV!e$W0yd"͔-m721ll*VY4Q5<9ש0Hn(h)e{$FݪBΊ S/۸ˆ
+6r#Tj+<aSO2\X5C)ҳ".M]RuQe9t\%.&!cMpk'c\kOKG8EOWD죑j;7Bc'߂֊Qi):j!QG]WP0D{,oU~?#)k^l92Iy-Ebϕ/h6yTo{kZhxxOl>wܙjIEdNV7jF>
+a(dsXl%[PD
+rULm^9;)']R,f,-^lW5;\9x=M0:ѯ%qRn ^w>a$,[Wq.@QA`VNAFՍgñ9È[:V(|VW	gٱ%D]Wc0#K3#0]";`YG5\+]>LR67f.c2-Dv1~ǫYuQ=2%og LJr uzᲇ$hFo4\@!Zs	6U"76f`0JWaA&gU(a 9f)ԈM9B%[ƿ'v2MyVe&jXW(|H*ؑKK.+2|'(DĄV1B9!p
+4|4Wҿ1"I1KǨJ|9zкSŒ_cy>-w(nt~0f"l>ܐA}r3rT(,eÝ	%*s n3vkx@\(`RFڏ
+"T&g9i%9 gȶݥegr|_/miZ-\%.F~bEK;X	$mxB$68>qRTG8S:5';!_(JC@	*%yG=UA-zR>hkH.b4;_wXTsX>lϿM:0	0[\d@ֆLꕋnPI@NX9EbaM_qNqqͳpў$&eh^gJ'b(o&p[=H0vk	L\EJ+ɭY R+bnM$3MRW&C-j
+c"4B39yn͋"o
+cC`[mӇA0W7Y
+@ե?_?LijS!;qx[ژ˽me8N{W-;O%gJ=$ORF[qa<(0GYL [<j)'H{O[~ڠ?MBkG9GKhgR'i<SLWXE-rJZEӊ[0trf: \[亸E(<e(y/hWe[;I6:z-<(mSnflc{qa&Ƀ$;ߟEZfK.RkKPEh}
+Eʊ0T'5Ԉ$97ʉr^WHbe	xyU\8vl{:\B]FJ)#-4U`Z4+%Y>Si'VuN|`ԙf\%so%ey[40_'Om-5.y=W|A^Hk!1RYc9R)(GpQ@7=Kv5MEf[\VHKH&ARvpɼtA%[$l{7h	fU`bFVz+Qk݀Ѭƴ=+}/d,WѤVKSuq/-Qmg-ŧe	P5)Y~Q!jeds?,Lz*__1yПNrՎ
+ayV߮(ʀ*43!$"CA:L:[IA[AR\ŤZ5HъξL3gPÞm-qYzqnӭ,"{'нP{>Sv{<1I픓G-nIM\O8b̲r/uAӖn}Ї-Yk`˧E K1$7}e҂EU)$S8td՞؞$
+pȩuQb@/~5v(	Esչ164"|"J98\<hF[Z,mZ QQWq
+G]"
\ No newline at end of file
@@ -0,0 +1,8 @@
+Nw+\YLsvVP+.z&v"ɑe&Qm|ZfUadhU8
+L0Y۠h~?OODduP}n-(TXKLY"Kq4/]eAŖ`Z/rG%C+юAQCZ7o4j	["kĿΤKWWm\6_^mgIL??Uta.@$
+S|1ά[7WdXJ?^22o3XbIy޻9q'cWa^~>XA?)~)Ùfw_{+S-[WlDCi~ZY</zT%zC,t=ν7(K:k1Gu@TnURj
+0rQdnA^Ӷc(̵Į7hD%Pg9
+ _haP#Y#+|"f=4_Vͪ{hUY&]af°Ft΍!ￏvpq]n)S`SQorC3%:z s	crsfێY;g=|P'~0cHV@{5}8QAIP:9	dfF"۾esJbRt-r"/pjXynlpu73C+l|~zb"=UV%fgٳ*.h6Y{RCٗP`mD{SrT۴<%];0=B[:@@=̙Ma0΁NI(|KB'0_LWum<lʿ$R[NJ)DH3S},ᦘҢHi:βtZ)#q#f:=IP ']wʱrR`2qѱG	jX;˼{2dOAs$Gg0١3YNxva{6ӵeһ0%d*
+^@ L*3(sD/1
+gD (x稳]GqnwxG#a5?̦ɮgMn+b]t0+GKLmXoq%CdκƳ>Ds+TΫW뒦c.+D#u-GD=y|U|էODbF&~4HLu7HVx¬_Or͐X_rl*Q#G[/R['|7<	˯<?FYe#.^6D5I
+o81W`ͯ.wCHnJNHQe-S#oLѻAU*ܗn%):xUѮnwc^h>j^۹(jbiQ^z;)("qʢDS>ZV46Dw7$wRsvoEܗV
\ No newline at end of file
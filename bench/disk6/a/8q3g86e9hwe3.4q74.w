@@ -0,0 +1,9 @@
+:X{0S'<sjVZK00!$4*}	-*oműҲ&ݬA㩢O@>X`9#JzvDֲ
+BǕۮ2;/㥌r 99qW.{vv_FlrWh/~Pj	eB*oF$lX"a_J8M,s)XNr
+v5?:O-lޔ;7ÌkvTN%n]#}<ζaGlY3	Z%PՐ/j?!@[]h>;kYč>0ڞߎLLB$&`0,OD`79NzH!eԲT6rkdΦxiF
+1)V.gh٪?_Y??;D-gNՓ^ЋUÏrpϓ+[rf\|;賈SS8bK3Ӄb!;4'9'sfFf*;7"/I5k20PL|>!@,Dޡ
+BcvD%l+wLF6G4)(BYyEzj8iC{p3[yÙXzϫr2GH㦡iOۅSU\$:bvC/	~{>ӼԿPa|OuLNTpF9L]V:XU{R$dڽi3ivz;+((E	8lL1dIL̍gMEDS(8Sցz94ɖ@"\"w(˅/̈O@c+m!h f!:pM	ǤzF<2_?':#7gC2@0!K˷uG搿ȹ%ՑY~S&#{a.IIm(>jh}dsVMH^ǔÙoz$̓,k]yUl~$6{D<$8۞Jю:]$gf_j|]%pe~;ۙvI5G^Gz
++8ra0zb!^!&Atkzt0Dof]Fe&w4
+!G4ilRn%AN7
+,r+EXT=%6Y%*kRX-Ot4lR#ChL*3FgyLQ2AKPz+z&(BM4qe==ҫ7
+`rSݶT'<@sp)cða^F_/;ce,fKx/A
\ No newline at end of file
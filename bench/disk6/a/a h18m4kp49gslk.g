@@ -0,0 +1,5 @@
+FaDN68&[_Z?˚c$5NSg<X@CԢRf#A{aLd/CMt͍X+k%OauӪ1keת׃ZaghDT*\)7Z>T6uM?q5k]i1v@"%/?eyx$&Bf%-jqGmuzpx[%(cPwcjc3~;6HW7ڼ9%J%^̣+Yz4K*&኱FГGᓞ࿵7U`q)X[.^8,^<L^[0*&SP2?-'ƾ/Qk[(ǕyTH/(q+xUSLw礛08PB!~1BItnlx=\qjˍMr$L 8L܌YOk|dB#@<z
+EǊZŉl)_DUSH݄eY'qi[-2P*>B87506"%RHǂT.½Y']0Dr>oRKtS>sea?Ngl<{q?׵}˜N~q5Ig0,C㼝y
+)͋\egEǘS7^(~2f;6-cŗ7_<^4_ 3QhM"}M@yK+L9huA3h~Ci;KzSP!|osơ檱Ȏ^+#5,#?xnXxK&9t5򆮯B1$D[mAC8K}s&	DHamXb~=BoviI)WLŐhTeCD!b$
+ޙ))"癖hR%0orrM2R7MFL',	|~t\xnu_o?i/fYun 6󘏈9u@/	^`B}ު,J(muy&}gڑ c#Q 1Tkn"3>2o`BDL7߬:0.$Xmz~}Zҁ2Vtzk&YSg3@Q
+!6N(1Od	ڛw37o1Gi7i"^ZɃzV^/:7hi٘ǭ}0?zg9d	2ֳfxP":LwzAE֎{Q}u?{R2B"|=aqA*rj}?.}3=%AZ4ҙNAz{*XÅ3V&4oyzk?/?j2x#]JT# H4'a_WWRP#Aڐew@3%4șx~Ǒ6<!\b?we.RADIYuh`%CVdnn(5Xj`ِOր@L}tdh@MDF}c+1쌪cͥWY$34+=74Vqo-w> :^^KsٛM?26[Y$(\S'm==Yfl^0C._Ԛ2|8{OEY2"h%ʨR	Vξ㶚Y3$̫"хAf^:(tw@]Lfh?uE?=9jȔ!CPe~LΝ}܇*{܃Kd:<
\ No newline at end of file
@@ -0,0 +1,6 @@
+v%F[JjypP:sMS	N֨y6fh>zyVA=G7OΉ)G.#SkXI^ghH.C-P'nIes3E{CjouBKbm'󌋔 HwE*c8z>L*{f>Ǐ`-E\jmǤ#w4NCze5FŶc2f"e+ϽgҒ"P|KW!VǙۨ LWy|'3-ΓUVvN䲍Okit.z1F?.s*@|HOm"BEXQ86I3q̪v6&)I)y]i4W_twǕX@KbQmqe_@݊@,zvaRqZ׳"Y!)؉1m3;j֨gY9lޮ@n1IbNk.l&%ɁȺkX5D`̐Kt=6aF'IߜfPkc'a`Ӥ%ΏPtW;;a`m<n2s5;K}!XG.(MףEԯffꝀ5xw%[Rl}j"<[݀:cRwI$Ϊr2GW kaC=s{,'yc~[TJh8nT1` +hϣje~xrŉf}U8nZt&HBzЉ.`:ќvWU7`\sYܤB܄D$ x#hg@2LOO߱!:j5Ra	rΝrxA?GꙐS!.o
+p!m/ItfkO"6/Cwcٯ?-@bԽ.Kc&zn>*"N(y)f"ޘ֤˒JS!?d};rm7`/6_qz~T9stwJơ*~U׼fǹ7֔$}N>$D^uŏ"X_f5Rm/xIv.[CtBy&HۊD8㳭n
+Py: ICIym6˜S=ްJu)ЉzYˢUTM3<Cl2"V4_XeqJѲɕם(?<_5r?tz6pJB>OVyh9t;%9!T8;5/ztT1gӟE$xA)r`)ީ}qÕr`5mas=ضN(O7Qg6ys!nIX<M#{ o	a^5;
+%ƿ5?|48+5`Z9Qhr6Ed@1qQp<Z1WV_&Jϝad	^$ȟ"#DASƞ!blr(`;2D3yENVD[OTǓ9ci>̭R 	SrĬ~fM]t/\eE]"aBSB=W_wAuܤ	h?#5vzɲ>.t/JC~HJ:nVn`pÑ1"$~*=K1)kR=WCþmaA(ݐzg%Xl`u-m'%SJ<h"O[$tyψyOL"3)hE	gvwH`"Ń3m#dgI8(V&#t*.@Oy:k@j;?&[J޷ t(-O(k)R㣔F,P~@+Ƙ@;HPr4_'1{PA1}m:~җT#JeGf9)Kxy8mx#]\F{f/^"MF޲TDfӇʞDh3'`M$$sWجM#S.Cx9+ lƜGpE#pAM>	P>7K\b
+Tz	"1z=`݌W,qC+Q[RphF^ૢAyBhv88/GD*o+:/oXE+@;hu	&Lnz6EwpLĉz`u	~*>T@\T<,)uQ0?Ж-XXw1++aBm̝Rv@t7"@	5Pˣ;3Ɣ,&(saVSQ9g\&1J@0UI⍃hp>g;4}It+q?)G;2pхچx`UA{gKP)#ʹei!r"B	yOl#hbBbK lݤda!7FrUwŎϸWd{Qmfw FGy7p\}vPXvDqـ)kZ|6vĿ#>frlh!&,=mt`xE\02Cr):MCu0ZXwnrghw;
+8,"nK?َ.u-"gI-b399D^xN	Ѹ?q}4ozo-6҄-KiQgoJg~*h9)6xdZ=At91a3~CYs4d$7 e%4JR(xτk1'M#+J	DG$Wő{ʰURMZ
\ No newline at end of file
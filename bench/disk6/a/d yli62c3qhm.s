@@ -0,0 +1,5 @@
+8`|e}m*QɌZ7ww	O^!Dծz_罉a|TyܼAF9$sh߫zAX%@2AVڮ^ŀ.~ڏTyeFnʈx!,a=Jzb_U>wiX7O2w嗤^>}Ex4l OV@KB(
+Sd˞P!պ\M^jvdNP[03mN(ױSzc(yEŵpپE_/%Ww覰E\pvVC#@EHӆz~4TU4ŞF*i.1aN<S30K=hYTAU毩O%H%1^Yhۏtc-#fCSs7CnR2ȗ!uÏ0AWղ?XJL:U7͓J"ʋƦw4ޏDH|xhPq$	Ƿ.h+E"̔"=SHpݾ/O޽:BQ1`^#Sk1Btgign$H,K{݊^zhxYԽ2hEF`EJcaؔ
+*B
+w>
+@ĉP^"hpg5#1pOv0MS{Ĕ/1ᷱUdX@ʥ2DP2兄Jnt~XFh9<3@̦|JF>y$`haӗ#G;+iM-Ѧ?:ډdXNhL[n1˒cjOTZݿ&?{?dk"jbӬx́Dıs flPjd5̎h;˨zdRMt7lp]_P&xx|`Zo6B޹$wRǊeuGbQy5WqD3AR* P7hM{' Et߹ob-^Q[-D""eYHʂnXp@KDAxݛsџp<b8M/r:vipJqF?q>80,s[[};J):V&
\ No newline at end of file
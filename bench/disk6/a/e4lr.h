@@ -0,0 +1 @@
+r*I
\ No newline at end of file
@@ -0,0 +1,7 @@
+xf5(Fj	BZ'!RĝR٭Q~q1gr#wZw!`Y߮UJ18_Ju1#&WC82YMgKo*toxdj)yxV'aT}!w3<"$%ºQ^Wf
+fcY!BcE
+^QO'5sL}EȍAKc,6lZb"jh%5e5 }>StB-Te<%^EE,uƲPe.6ƲAHu5&u:T:5AG)}Ҋt/;viS묯'm9D5		
+m^*oP't]oR?:cQEV>֖Im[==S
+1ґwY<Q-
+/D+ށI`ңMÚﮉaRAPn߾r>Z_>%)$guTu@36=óx]z\8NL;%2	"Ywm	ۭHd!@N`ޱC}Iϋ*຤cxLˣ-0V҉[|Ar"zS )K*FSR9V1$M$"D~MU}A?VpQ[8炧_0B,áHr5ji4BKpEӓ(.lO؃.xU퓣~v93TNF>w؊ci%{rVK/k{-y<׫y͡Htn5RG9q>qhڤ-k773;JRs%ɅFAT򰰉S,2md۸ޱTN$+AxP8<{3J߇$|vxRޔXJDS\UR_O[IBts1؛v'qUNϐHQ,֧sy)QĪ.A&xK}!ƭ"k@(ĥiP~n2jjbJΤZjNc>k1icIZy4ٓQ.xyڰcd,#{CH|pɖO	`:r[(քw93 Byx0ˋ&3Ս)Y]Nk].3KI+51ᕟA-bHW4)Է(θ66wF̆!B8[ צ8hY@đ 7^kȒ$ֽ8|_;S{12yu7g{	@\OzK/̼Ɣ,Cf!MeSF+#UI>J[%K(ʑڲ(ZfJBdNjT#RZ:
+;-8(NԐ1J_GPA_H݀SI>[d42y"|Tm;m>P }<@*̜8/o)cO\=ĒQ~#^jZWz
\ No newline at end of file
@@ -0,0 +1,6 @@
+O.c\pT 3Y\	*aȥqfؙ]i)7[QUCAY.ӆbJc}(vtY)Q0{Sw[Ĩه"_ Д9<$y$öʩ@kw	6
+V:LZW՜Ϋޘ0Q6خ\TD3oS]P[t_
+GX|'ٮaݻWo@`P@8ـT޹+#C9|BP?{5H)پJRh%$E)[~=ۘƪ0+@]F	~\5vgLvengupE۝΀s	k
+,(h\7DpF1I/,)TYǇ0}{JZ>
+LҚ+SdLkdbwzRc~ b*!a<y3@zp2i֐[kE9~X]N5-3r6/eIθRLˬY{|TBiVZPnx	jǵya:rdkKޓ]^(cZr#wLBG]BPaG]wE.9S١xVy5RzNe_Wl,{fCeo\ohyu hU-s/8@xҎH^WQ?3>i?WH
+]]f|0=eCaPkgQ2~R${gȨfuMʊҳ븠#u略[Bq_ypfDߞORDC&LxSr+D{j6դP,VD&J<)Ce*;]M,Rѧ]{.EKS+ߝ~[:5$OHc7#?{.|8fɜ+o86J@fMB*.ąӬ,	]A+_ageK5Qo>9[lܞ[Km
\ No newline at end of file
@@ -0,0 +1 @@
+oxz6rk06h.p8n
\ No newline at end of file
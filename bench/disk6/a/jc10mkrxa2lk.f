@@ -0,0 +1,15 @@
+Kf/5e0÷
+DvIPv̀<wǦ]&K%ӕh-n-A"Wk~^5Y*@"j88Z( x$zC->	5sR+Thc{_~(]vwB~mns-dn3vat^`@d/R%sN+W_縡^ `+'=F|{F |i0oƍO{'Y8JUO=D"2+92(Q0-7ܐQaZ6#	2u)7p{!&9N]<M iT:[Ǻ:|Fxޡr~T&SN19:L-:
+|F;0!^Pŗ4˙6VVQ-1ݤJb~ѝD$ioVQ".>~Z
+Ze\v)f|EQkLmV?|Z~"+_߃Nfgb5q
+l9ͨLI|R
+&>!cif<bNh>j	bּIzU-gCbB8=DQz4pŏsB	^j?zH1/nab:50wjZNiЈd\;ù}D)hD{|*HlDn`-dvosQ
+޾b>X|	'].'`3l*C|}:컝T]I|5%5=sk5ON٫hLOcR	(%v)@rNhT[ʄ+(|'8U Q.<dbL2jҬ`uyQgt!դ:8&f<	SmѱU'QK1*LBAܘ±8:O2a$xBnqT]6y`0nU)`<?\N
+LX:g$t9oɪkG}{ƕTUF&"xn[tL^6gky^6JrC}8R7Tj~Uڥ#W8^C?i%xH,J[|;*B^%SHr#;!Mx?`g!fhئF*E0L\ؗ2t+S^yl,qC%eޙQǂr<}ӯVԒ$84ǀ?u72ҹקz]H@
+"m9ƦRyHX2ƹ5?yz=.uH95ͬ2b-Z266~0iZ4ylȶv>W6Y·4݇cE6EDjMRʾ's
+.^dKZ`aѫu
+\FTx'Y|	U:O,xq9%Yv7<XURVȸuI_+
+az׀_jpJ9y0Zb4E(tj@v~w?aG_ibƍ?g%r|DP3Z
+'(i_,Իn+(L2-~|~1k[bUh]c83*L+? JfF#A1Rēx4v-3YRϴlejܭ}o{z?DץfknEBYJBPg|Ҫ_zl̫Sۉa&b&Z"0r%5{H6k}?x{jYRES,7#*i
+SӛXb0>2cn_@#SC*GaFeF)y$U8[0tBr2s}Ų{j~4!lN[*dT"i|j</kWj_%Yl4𹚢ٛi͏ڠ~D.2/aNO5O6\Ӂwc!";t5K[	3riC`q=-`]{4ޱ0O&#YUtxSR{Ո<̺j-4bzbUb*cvJ&Eт7kT1mmzlGp5Nn*-e`Cchf풩+CM"]F׌hE!_Af|q)J#i3xrJ?}YC.h WJZVگ"ַM`jWl%Iּ%|)Pc0%(I1LfefT7)Iя<tOVBa޳z=A
+QQ]==Øra׸OuvmϮ9U>BbIppmsijI)EkӬ#Y	4r[wA	(@݆'6QpS}eE]=" C>"L|G6|3{tJfD-B&0\2ZƗA~,]7d/PqۉhW^g[D^m䔬y?wd;wN!v&Ŭ5AF9SuTJ΅QER׋ֳdwÃR/JTb(6DWEPTc\85jmķ/ AI1@BvNE^@@$HGOx=a_kRU\8j??̆v݂rPl?:#v/ҖrU3{Uu"7`Y0Mܾf	qzV*-RCmC~:_LZ>O{?{rq,݊?sh	ab"5`Gxlc#5Tw41pT3<٥^|\B&:8,7ID\/6x^]C"i6!֒h'vLۮ[>>MTpEoR8\-1k?JTWVgN2ւMnV6Hϗu[o'_
\ No newline at end of file
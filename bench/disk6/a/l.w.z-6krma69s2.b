@@ -0,0 +1,9 @@
+Pp6\Z:%;;g`ړ#}6{oR,y2ܳL5c$ș띾ōOU)UUMA6R;+aV7n61{n#4=4OoQVS_=j⋍V)YH;U_eC"ᯢ`or8y##ȧmB1Er+Ae)f	 q&4׫\is|LLX'17-HfTct?Ț݋K<`zѥwy͎<,5!HA z1Ra.%GKK9y6=L'p~)Lx*<5 (-U'5Y#PPeFcrc ԯs`~W1a='C{Zv.ش>َQijPYxKí[;:26#^['#rw/bt|%:$]rNC"FJkOB2c~A>W[
+4ZydE/:Pl!T&8T=Q3Ǯ!<c<(A0~^
+ĝi[srwiIi]S9\;d+ȣ>Rm@@-$㦂_*ɸO.I
+$
+Exs($AOUmw?^N=_}hJS#EG󆃛dOɌsMI=)W-y >8??\ީ#P#QHQ
+d[6vZ[p*SQ6~vWfe_:"$9jzjJL^&YSYdԬ}7	y4iy5/ٺ.<Fj&.EhHG8m롥]")j\YtbTCa<e-B=!,2`-ڒ_a-8	;e0lC֦*C/A V-ȣnc:n۵d$P_PX+%ng;g,݄Z7!"n$vģqkRV>׃9|gHgL?`o;|?Fq1k=cOGs`&b҂"@<St&gBYqAm	!baZFII"@<3xlްo:6!/KOcGI
+0P랁3/3cW]P&	EjlUץgqhń3|fm7 2{>w:ii!ܡp2^C,ϑpLcm ^T:8$1`q\2f[_%8c@K8lqܘgĖvE>
+5)̶q"P"XU|%up%-zirm@\ᇤ<PѺKzQT`34`7l^>%u"{=ubvWk,?:۳y2bf{},]ߣLLo_
+\&Pm&ɂoS]f+GYWqqG5u.zmx;kY/Ǝ|p1	,^jĢ[َ(r1zT)fZ5D"RfHʠ[>/?nT:qh'%}P!O<al4*T=cGiʸfn5zA+ѳp*j*Ktʈ(=}B_7yvӷ8gH~0:w7#θ|^05M5XAŵU3iJı\󙉇Gqc).QFj`Q9-Q2~[T8AGHjmG1{G/Qoź+7Fwz1}-`tUaGd8~i|5]8*7[S#$5;s
\ No newline at end of file
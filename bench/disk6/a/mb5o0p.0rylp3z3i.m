@@ -0,0 +1,6 @@
+y\l{Zd	,dxN%زc֙ ovz(vǶ$Y#.>sL	lS-@]"ε:7?݂mn{4th9AzgBGp_\^
+"=8'R	i)jt'C|J
+[mTIu#Iq?ӌ0gK9LHginE53j3s=$yNJկpt3})9Jk'x&T m+EKLOW̳UFr<*|T*D@a}?2"-P.x4Ϸs!%l(,K3!.QHj0RI\R'0"7CL:`aB~T=I<$a0Fp.`<?	ԖZcRr/LNfepVIߟkH%
+e]RD90]5!32[Vg[(#ac4yA&c`*A`Kah-`QR4l\-{*Q'{75*M_PD*1޿r6+}pP<Gu
+OR()VP]w0{Ղu/I`SDuiOfOFXL{еt\U#?&x+,H\/?e=fIq{n?zku8iG vGut,ZҺpf<w$:`;Dv{N9n[iYk4*Q<b"c5bOեqוb0Gů&w*T$.x|Ϸ~eREBaV7|~)rDvawgj8RM/nx*;Ζ
+37>ƚ4z\:l`)>vd1#*Ն.\YLLP'4@x
\ No newline at end of file
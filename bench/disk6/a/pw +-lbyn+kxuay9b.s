@@ -0,0 +1,20 @@
+&`Vr,pTjqߑ՚}>d۪.?i9oTdA-Om+slC\J;u*$
+A2gDn_% 
+R9r_y7'G#/6ڰA(\⨿o<?	'JL1VuT1Bx7Cj`oɩ+R{i11uiܹ96+gEfPT9|ڔ̕0kڂ {`>}rTHkpԯ셩rIsQ>`*T)t
+dGj+6:r-$`NQZN
+='"JKe?dKm50cC%TTܻ=JoJ 0$
+9`gbWGE;hH{je$_ifҺX>m!Nm"dsRB)gS/z,J;O5U/PSm0ukTy9kW%b{Xl+Fr>v]vXݒz[\4?ā'2ַCl.Zg8 )Ҝ)psN rB"UK`\q_
+]8O.SR%J:.Ls:\
+UMvHQ&LTTɕͿΘEH^+@tܺ|Ťx>9PLDͦ(@GL_4c#_U<֯r0bEM{AH)QHrSȤ=eIZ{ 14lޙ]^Ke8FI߽	BocK8NFB*1xΫ-ttF^)iL
+9d^UL^:Y֨7Sآ>>)szs3)lz
+Ăm&Pe{܏ 02@+lu#|%
+[${ެXʩ\6zWó 
+4pݬ8Ӌ\Z֖٣vTIo*r8"nv/Ѩ[>_aSh1jגtB#LȗY6l^-叓䦗O'9gk-BB@v]Җ\K2v9+1WK'`""@jWPFBE0tvg:H-)gGAH.22u7lOxk#}<eP-왢"^FZUPΣ7T B
+ftH[Y;NjіѨ\NN)'A+	 $_SH<lq誨mVejI֝q1WkL+b!3⡮6XLk&|#q#]uJN]K:]؟;t*HkMLu`2ӿ8*[d}qcJ
+~Yg8)w}T o[`}X~k_9[צ71+9u̙mXէf.ZsA):XWKBkpyCZn'8eѪοN/
++-h%.}BF穫&[+8[h_hغԿX;E<y\^:mSDPy{k`c3nlQg%<jЧkBДg>Մݹ<v(y =L|m̬KM74HNTlv*:kre+,UB0ƞ!vp\*mui5su
+/-_gGW5L&LUԍYnTֳrbz.pف8@9 wvFusdX3OyxyKWcxØͿ7׈n7_աu$q4=%&1z5YQ[wlJ/I*qy
+Q.ePz9'cMy%d^I×񦫌B]VWLMa=uVI2,eU7c^:Q0@&5\e`Oz-<%Ǝ-(H	x3'؇-xr^$%CEoz3)#]akj?04G]9<u|( fA7PBQͺ~4k
+A͈))w_3ᣠr_?j)R~cbz<FVhlABQj#/v~*Q+:F$H{*8B?K,|¦^/p3UBi F(N }7^Wxejyi`r+"Xej郁xMȽ5UI0?,
+ߌkSDnbBUX
+2[H}ԲC/z[A&ςC5=3d.1aۏMKJaͅvx[|!%*kрl2>xw}`pJBӃa.z +%ny3Y[Bدxb/{Q18z9FOݩ+p|wxrEr,$оW
\ No newline at end of file
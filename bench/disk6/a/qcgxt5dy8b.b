@@ -0,0 +1,21 @@
+R=5piaZiL{	x.V[ˍNPN2t]8a\jHƌrvu~
+2Eu3["ڢ;<rrwm}ewh2sey\loS~uxxט<$-(:.Vs[ú̀<~Z屢V&L
+WX`D
+~6J]l8+;Q_{@eۻFԉmmfz8Rlb-ދ<ObHNJ%}WHHpc^r8r{HGq@Dh{e}݃VI2s9y9]0m6lc&k2Tb.Qu{:	yV$2]ȝ'('\=KHַJ$&3d\TNsP?fߎcjO@Y0lS'smmǸ?@jtFj;N:
+#&C`8XyOx(ue0> 
+%$B&VU1?DЋG~.HBŮx})o3;A=&83!:.{^fQ@Ov.gy'8JJqFr"YC"Z\#0޽D?;O<D3f;I6?K/a<~`N1-c$<+SMk@Rp4y󒀘\t7̩=Gi(%xZZVl/7RM+4q~kJb^rxOcg]Ђ{ͧ,4S(q;l;$op*(
+sy	[pjZHW'agx_JZJ43oS 8U?čn^ľηX>k` @?]Y?cލ6v$)'/E͠م$+J^6MM	ĞSCNg\ڰƨz0.2?
+̏p;ÞaN9GL|ibI
+mkVn~?qD[慉VtǛ4<Tw#5xU~BOZ@	HҞ)yh|Ȳt73H{1ӭk6KO=xw	]y]zsW:׫:y`фrȴ|} kA=DZ\X#x6qcSBR\{H@C`F9$$˖a
+dدXћs].WZ
+e<'BȤ6pEtFx͋uOF%PQ'䢚纖8yu)Y0SH쉱$_U42Bu<sb2B6=m+J8W fN{jaPAake}u9G?.. >&hf0:jKTv$R4-$څ@UwcoO9rT	&%ngXCW I-KtK<VԅoN`g^waKBA"Koz9C&axBS#wBk#C!}ϣMpu9D1Q1oɌѫC=(G"'ߣ\tJ,u|[f%yo_;VOm{.#ʓ3I=A̚AV[m:~m9zW6xpik7Q7}xέؼvQTRڇ|/U۔fW乆]de06+;/ '֪\$rułNԱ##Ɏ`DqR&0R Y`Tӄ`!k/PUWR,w@~^B%fN嗙9@5%bqSd\"O4-̕ɓh+vWș#ac)<nA"y	0B/:ӗiRǐˍ	܋@lыԜ-E:Mؐ"'BE
+m '	@MdXPiQ<rd3FgDŭHs̓J,ogļ`Q.ݞ"F	.NwܭAbY\0k<!(|";Bp?	88m']5T#:+0܊2A/MϾ 0:P$r5^Vw#|Vvۙr&$w׏09خv9Uk>ۀ.j>cl9[-\Z3`?|~cҒ1+rKe%׫aJTp藇YO:Qob(\P9rO,ۯ<@|bezaG
+:OFRb$7t܉nBl$o3
+Wۀ
+^-T[Z6݉_NN.os/ӰnoKG11T BІ*2h._ft>K#H-:s'siZ<5xr6~bw`mWWBrOeM},L0t2%NRdtbv"2986A
+4D?x|P6+ug,_,x[Fe]չ
+o~J
+	taIz䚱['8U`O$7N*6y-{d3$}[v-2w5.&Ďh@p6.ԗTo	l*2شT	.B+Z$+hÃM|j6қ>DHʗKvexH>̆4cL>gV
+2,	}rˇ{unMBj闻
+$:x^}^{@kdǒHP]dBJ8n8>loR]	6uc [%kJR۹f/C	!D9(yJk-Sô8qbɏv#\;+]a.Z|5$F/8:"9wtKƑ+jLNzjmrTɪݫmh2*4 /n'T`nD>UsUW(֖,Cq=S*6&ϩ6*hrKFCI_ʪV`?rIttXɼ1ɌaEb6c'	#J:#Ma	hAӀO@
+I+%oDL[m.qLɘVlEł85df|l0j}Ffփ笌v<ԗNةz5<i7%6m߈+qj+ЫdO>z\4~銮1?tͥ4{;wkI6͓߭epBbrFxWQ\Q8jfyjO}}ӈM6@pܸg*-4ZuVvgUjٛ~<K.ǡ;zaOGFVdǘRFs	*y*g	PsyxPFZ&|e㢧6||ӈu>JbA5:$opv45?@R'WWR@XCPnS*`g$²*Ya4xJ	
\ No newline at end of file
@@ -0,0 +1,6 @@
+ʈ]Zhj_⣣5y p3QWDEPD%+λ>"P;ziՔR%SJ̒ۯWͷiS6xFúwv)f1HJYT:wr)4e	fXV:FEp'x%SZ\$G6%*.ԳcE懚&<1:`ݑK8KX-#}!iиXAB	f>1 jm_PWXymAW)oܫct/U<_w7mnz5[r\Z	h"Ԙv6\<`Sy0PcE z"0CW#zrVy\TMHo+6Dդ#`s8@,Bi"`vh2Bbi[Aӎ.@{MM/mƺ@;H"1P!*Q^PVV*2v/}7˕Z1ZkS{S"7Ev+]xyIHol.Zt0v
+}>7|X2_Ҡ\͉.Q%ҙn{A^63#zO=W2aw4%M 83NTq=^ያ\qdS>>˺CDY\´OQ \jAʄt	aQcxޖYry/҃/vY<_9/gNy%g`+*lq2a./|@Akvtf5WR)[тsQM~t4J.KqWT8yϫE$MϕNy=VJ}dݸu31*eyBS+2%Wyz&vxaDet/Va&Xnb@N.\σ!6:e 	99U5xt^>ZcfOU/&xU`ZĬ66.Q1ȣǍHke]c&qҕVwq3N]!D:iw+?1/5$lӺs:]8qMao
+I| 
+N38
+VuK:)0qdkloJ_]?LY1A]N%֯/љVOrw15=I`8hQ4yUTd+6,GteH6zkX!w6d_Dt.SՉ,)HwP)dz"
+60ݷAd[>-:ɭPЪ`lH<) dy2:HbVk6G䥡a_:hv|g}OƆ8m"bjc)I>RZ!4;g
\ No newline at end of file
@@ -0,0 +1,5 @@
+ClY!؄D1j߭8>4/Om24MJc4LZU2薵9x/Xɠ-㓕\B}juFSLTx+j#_3m`łtRrN,~2G>jDV<c4s$hJQFйw4cm۝I=()㕂RLά\k0]@ke[>JBOޯodS^k0Hmn
+iwjA5vV潬t0(MJR9Xw8
+ͼxHAGkeO:78w&}.4h3*LZ3'*%yS7A/MNūDU-W:aq.,5gP%Y8t!H/ˮw|~ʳr<G¹k~@to2#:5v>kKU,^soFZ6Ӣw8%ݯ%æN%?ًG"|_[(K\KCo`a<g4DSTHv~IHCm*y1RmGs$SQG5:15El^"`,K<Bs~7jt7)dXCx$NXd;&M<8EĴrj`Ф[xg2JA}dJm<#BQ!0:CSoE?4 .lKY^7st `̢7LYj7Nk/V_lSllK4.Tљog߲K+6zđpޘmԍ#bxLlԲa6iI^sR7Fz#RYr1kn/~Ӥw&5[G@Ɛcg/dG{Q&yXEFӜqyB$jiyti|開ޡn_4eA6M@gS⋍5`?IB|kGeJV3cr2& Գ8tqq_SrpfR67ߵ|OD.M:0%TA1\S΂O}*)pheL8~e&.&/㋭JdT.FE8,PR]ٗ
+5-lH#m).;quJ7X9"5|LժBEAzd+u.@%YmQ^Lli4wwW%I|{n)<Gϰꚏ..ۥPV`pm&͛mjf82qZi.L]uTO
+x2䊢(?`qF~Ċ|@giSٰDߘ[[f	o]H8Ke4e;ODWT\ɗUp%3#7eʑDjv%/u`Hg*LDJq;I@~V#,SY\!anr͋Ĝ2&xDtf!
\ No newline at end of file
@@ -0,0 +1,7 @@
+!3e<g婨=q$<P[8(@+Sd#zl?fՃMb\G29]pzNfpqu^v	V0n#5Vǌߖ0dTi/i0eb0s9 42T]qWW܇4vh:+M7P X>F=iX]&^`=Z`lq2cYv)][yz|^f!e(1Hg^Q2#d[r.<~><"MZBR!'a÷\fN (!޵7LYoL5RhRjU>eT'u!tݔ.}fYBێ/yε>BßÈǫO]	PAθ0NVUjF]JaXDW~x#2IK!^Abi#Zemܰjrʳ
+=MK_Le{ʑFOJR&TI$.mNn5df|/<bL?(u+X Q*^
+6FJm8*ձwXnXЙ.Ԝ36(<VVJ "bVmL1g#-?Ԝl^LʘOf\:]i+RZ+ᄜ :;-@hytć˞&e<^ճȮ?}אLLg7HlÝҌWµN/<S%3l~6/IdeF 21#	x)(VK$/-Cwl3Mk$sDVPpg(pV'?>ԿjCY6Ҩ㪟p͌B4lo::Oif
+}df>o˝*Ti=׺g)8 i9ر4G?K ?f4?%;fq*m&GcO	n
+	9Cg$_@ǽ8J*ŲfS(eHI. msgo8WWye"!s!KDIƺqtF,XC͸)[_9p4ܙ瀬W=ئ1eoܾUiqln{bDe?`QN߃^H6kL?nda<^?
+ҜH|`qL*qڅQKik^gм[^hUR}Y;ĵaR~L&"3O;g
+g(q#\/Zpw\,d`L~hmH 'TaKU䦔C9	3忟)u_?cy\Dϩ8z(n.(x
\ No newline at end of file
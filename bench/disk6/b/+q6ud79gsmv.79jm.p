@@ -0,0 +1 @@
+V7FJ=i^ߦ
\ No newline at end of file
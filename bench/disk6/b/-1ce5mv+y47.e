@@ -0,0 +1,13 @@
+=}XUp[,˟x7c}]π;bv.]T]1{L,1o25/Q{ EGmJnZ~ΦLʓQ{̥YCerH@C	2ݤAd_|!_iCLkcg)Q.ɟ?8Y~@U.^
+&Aƭp&5P|DQ.l",*j+kMV+Ə{	ʰ(O1#Ju"gq_r>\ ,;Uj$4	xȤU')Qs7<DI37hfXCVTW>#Xmv\ҊhvOW09@<}Mo9酔2J8)k>ozy0uz%SI`ϓKGlgs'Z*-T-j8(~D'*L$Y81n_8npgo"F.nVAy̓.tYط?3v3ڲ9bhӳ5,Z	L;^);dcE"vu2P*!]"p\<Jj
+O{E١CNѨjYqs{4/h[6!u
+WB=c
+7o?G]Twr)S2ί孛-bZ8Sa+C!ELEvM	V^c]\)ͣ	g"qHokn0C/lўSVn䙴-(8,%r{+d:yh E>sA\H}Y8ur:|D?n^Khb[%ZP,Ln{#$kxxUy{޹*&Pm%;YQYj^mob5IvAB5]Ë@.9Db52:UvXVR7x2]^%;-fBcE3DA/
+ɤ0C+jO	֡jPVTlK'֤e=hAkw'#s+:)R.D&;l+8/Obh%@X:r Mr?vM
+ަ֧-	BOgLS3Aٟxjro60+V!>&f#x&`C1=YQjLn	rXHA~Mj4D*	-oi.a:9D`{;FF{`P_EZE*8I*ǥ-Gt2;j.q|dI(cm6eMTK-PBeS,'g9[rOsd`RnO}kQ%*&*)~H:K&S4Tf'%C{wٚ*j7-~_H]K]ܞe0ci+4kUu1=`VldtI^8Fy#3eV"!hR4@6'z<g;ta+,D,r"3[%ajF!{# ULw*klZI8?p~NNV`(YNR_'lO`4Ԉ
+<5tl7Z
+$BSsPB"tZ[v׭䤡e>{U0ׁ:~4?Kkk6|{T-k#3:2F=;b5H~Kؼm46,N#oWƿK:<ETvxB6L@a;\=ӁqYZR3zwkv twHMY%F,7R~uՆzD@<yc9*\ X-DuA#,ep+^Θ{Å#uC^E8I@^08rH1cU1A6,Rm҄2O͍G\{j}fG5<n\t`p(XB,W1Ypټa-Pd-vET`m@jk[Tx(%k4@b\/xioȈ9׉A ar;E2u*WёmQ"栔geX{	C80aO1+v:ւxgR6"S#$Sb$fS6#ԅg+.1M_vMZ]9:Y9D&rf񽂡K^Dk9 l-&n}c+uQxa+N"dgs8Enލ{2>tc=dED]ZMcarX-h|ÿ>zW~Vݠ{QV
+!0l@WBٶN^UoEoQ/\_&	Pl|ϴ_[YqԷ/^9J9&
+Y"JJbtlGبB-M`)<#+G@>j|#8c)v0n3ICwכZTlԡzJ5Ǹ}d\{t
+e(6A@np.ۯ98<m2cWsg1	|1DC<Gp)3J1[CyY*~j10}d{L}+Iaf"*Qc-RY]2+)yMf!̴(vq̼EHO=KOPtBT	^g)?SPWÿPj)uWJX+\+6[;‾4;H3p|[1.4D[h=;DaztG,+#~:'Yr>bp%ix{BL3=;CO3L]wX?JNQ,g
+#a}1S5=VJ@D-DIK}P#ƒ3D($TLViICrWԠ&l%rmlOϼM]$o&Z[4t^s7	|j٨d[gR8SlDWBd߆lӄdɺI\GLgic.	#]E#,eгV$JԖcg-2<rf$ZƆY좈5#`[u?Tsrǵ<QаmK)b{({/K1nQ%Yl&fsl>5g4204t&8 F5Өx(<F,$or!;xsM_,X؞KWn&x֦-Qjwd <,4XOzES+9tM6?YoT۽M4bV~q|ǉd%#kXd\EU:$L;<sfaUw=Xg1|aYܹh9d
\ No newline at end of file
@@ -0,0 +1,2 @@
+[>@:ЖpuTV"n_*;_JwǑ+5ry-΋
+! TTGURL;NWQ}Hn>'VY{'e׊ }ۺ9N]=^qu8"#{ެ5{_Aǂ@Qƽo<2k鹟ԪU)S-@'H>L7bbER7+E$.(z
\ No newline at end of file
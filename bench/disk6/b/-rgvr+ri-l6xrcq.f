@@ -0,0 +1,3 @@
+b	/!J?{oçe>GHcf2⦿C1@3{#s}{.&Uo>!?)lKT:acYAj2ޭc&&SD
+vC5,H/8{<lSЬMP1e|"*~KsuƊ:S9eА	O^凞3'!%:{}.?q·}FR'N[&Kazsk龓ifi;neO_Iѿ3t
+2`nw)ar-F,oa'\ً{Mah[׫2ciN<Id|[tD"mU'knB(_i]:O=inK/BJ	:Q	s:Q2a	gDEǴ<%&rQ/]_jS4M3x`'.r+U	|` aOq8b7tI#*JDS,f7GPۤG4|-r@6>:hʇ8KڬJyTܒ1{y5Y׻5.<3fIuю@|u}e!Z]-kQ|l%r
\ No newline at end of file
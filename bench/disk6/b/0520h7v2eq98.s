@@ -0,0 +1,8 @@
+Yfdst.&Ϊ~zwԄJjK0|c2nA'ffDC6TyR)_KBS6
+>P`h8~ Ҁ
+S)A=GnRnZct<\v#KMdgм[9L[9,%a1RIB@ƪ>Tsk?{oRL
+	YcֽK0~eid߰T1I28_]f'l3xj'܄qG{<Xua꣦[Ųd)+WkߩJy:1-P,Vb{Km/e(T%JޫnJG3[!h 
+@MXnqJvc.)!"ХB}Iة},0U?d1Ѻ?RF]+Lghg^γпRćh(Hd_M<SrKS' Cqsӿ]-j#^wZ>K_ q1\>^Wf<LzvʹƕR*dÑzc@W+	u#^Hb6/Շ0(Hr$ZTih/zUwiؗ逶C$ j2Uv)gKr`md*F[M+ToۿFD?81 =.}*j/?ao+61rdy4!*%X-l4肈ݖ(-SHu7䒬.tynQ>
+6Z0qU%㹪֐,^P	کcT	WޔnwlX?7K@+XF'F)dfwi
+Zig*{zz0H93E{(N4.iHˍ*jT!,V};lĴ#7ߘxw]L.;qPཫEO,$5Tjxe8\B-Loy؟.l^d3M%H{f2";Jڳ6	\
+'I}8>Z}yl䈋1G\iS~!ɗLI̦b>ê[huN.Y>Mm	oa+ZV
\ No newline at end of file
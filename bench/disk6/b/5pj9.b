@@ -0,0 +1 @@
+zhznk9yco44doyq11n
\ No newline at end of file
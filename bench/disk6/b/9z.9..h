@@ -0,0 +1,4 @@
+wї!RC(6̎;a*Qs+NU7p3.-~ z1b+k{*T=ЁT`>]ũ~eCVAΤTR.p4is{`^!>UScrL@S};<'V-싮J2O٘Ŏ\mq<<\UkGIZ^)>Y5+7^4S	^1{x(2yGBrH#?B_~xʆ`:>LVeOEnYUo	MI%Dm4bn/weGXb~zrR6Jӹ0(oKXG}YGvnʷS$lb`zEt_^褮qT-|O˙+ފh'^2s,'Ǐ9LX"D'
+T:K!>[8vF~1a_61pL;NE'%)۾tוnjB/TqҼfhCf+h}q=y/trvz!=(mM0p`ڒ;%K`6၎jK#Gl~5,)gw6:CӴhr'kɱ:("z ED$lڙ^4AG/73yk"Ip_4ޓVkfpDk%*E&SHv_DFEe~WYr/PGk-Ո^}	δF#
+SD%s~/P[gey=7DlwtU7^.MV92\l-(.--2| uI/^Ϯtյ
+7s:g	 xd&}ɿD\IwFjn ^>VT$eF;PRѰo#OK=/=OotrqSy6u,طSwL5Dbjo2Σ5Z֖6u^/nvpQF	Әk(oӱmN1D@E^u6PS&3&#5Omo,|,N}93N$ϳ'(~-l">/݉qg+XO6T?8NU;(^GoM"ā+/rh+z
\ No newline at end of file
@@ -0,0 +1,11 @@
+=zo_*cwi佉d_}҉o*L2gp5|a'u@,r]LUvb^P'C&&D	e?`b?G=J34HHRD\QgѶJKtg)n1y{E2<L<tܜ<T
+9V:\̔ۢ+n6i>C@n"/Qhr|\|aejǂn[Z6O&NSVj5X6kj~Q=i	oks!Ţz`A
+X8;MT?5Ɯ]0_;A^SkvSeoV\ͫm/%Ec-q@WyG;IUN
+6{kT1Dt's]QHi'b`~8$)VDDa).} S섈i[XpqgkM+i@qr2N$
+"ǮRmv2`J^%>?Q j[QXFc@fz
+ 8-_>k.8ZnMw146Y:ō 3Cnɐs_$S*K[6,9g?KL˖ZL5'RŁBd*mS]Z{OQs	')v[f̥Z}>9xvE/ۛz="huq'
+jK8?pqVpۑɜ\'v3jg{osZ1̓ieFxqnT^i8 VAE'tg40ZO).gS혨>ՕV~l>B>.l},L^>n
+Rܯj5f)U=ds7U6:;r@xɟO%w1su^[q?(A%}=uqպ@gH)kG X<ވx_;/Zqys;nT~EVP5q+p#ʮCj3Fr$3}	kNn/h0QEt-ĂW'=dLdA-`0az>	ҠJbBEhcDʙa1_&g\dL5Q)%~p{~`r}}Cpg9k#i+2S]JqDFe?&]S:123%90swTȣkPjTD ўó'~MA2EͧR%﹀NamGF`شf$)_D9Rږb_PA]4[LUH?_`Mh!&U֢DM2Dɘ(FpNlNZڄ{j'!ۮH%1[6I`Ѷ)fѷ@@,bxN;YKDqaQ`>3OԡMT0Y[Huu6azS1oUm}H64?ZUuÉp_;P6.6ocp1?m-񨟸9j#&n)qG%GanQd;iD0Lhހ88b#Td%br!X9:P\0AbXu:Oyyy>}:\lz:v;F{1H!^gl)Fs0TJ5I5GEg2!SR!Q
+@t1
+R|YHv#VӷE"N0MDbA'yn%*hDݿn@VV
+2Sjq.!gj-t&)#W(H`1R^@ܣ%;$G3W2YBQVa	I;Kɰe*DcWcAŭ2VK3WE[uO)ԭX+f(|z4˷#(H=Hx*sWW?g2w%!daXѕ&p^U!5Xp7vfY*D\5PZ#Iix'a+/1P]$Te{XC=F)v$YI2/xF$ҏBgڞB1Af0;7zRibuUppr	 -4;)@Zz*!H	VdǙ],m%dYu48*>`|[vlsin|<aV-uG=ގX	Ypq%Oҿu<+T!xW;rULW{W4)Uˉ"\b"+v0H}k	ZT,߿n
\ No newline at end of file
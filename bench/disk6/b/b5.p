@@ -0,0 +1,6 @@
+YU@U
+=Kt[ᘾ*վz3c)a4AN^95F;C<;c^^W0]>HEH$Apmfg3qcJ@:7.mB/s=S?[bnX>q,w`_nb	?}"\yuCJڶlWy%Gg:փ+ُ:lA1%#҈ܔkڒi@p"dȌbJ.kf6h6@nrP̱V>قDw*+*21-?#z'}bRaNHBQi%NI6s(F؉6M[%yZ=ұs؃Q$#XaO!TEAݚ06pnFFWM>4iB`B"WR蹃!NAǱVX[/CL&,; [rm<bZTѿJ~]=Y,3hR,dveD]<HeLb<N)v ~X,ws؂6Fnئf,^.x@Io8|+ǿnL}Jq=Ҹi17+xڒ*Cּ_hB1^{q]%;^6Bp(<~s3ט/48KnYBߍ;5VqbSeM-PBrmWbY#UM"K(3⢽z7U8{~i2bH݉2mZKQe&|HI3wE.nAVvN@C"]M	HP&uLswHcq_UGUY,쥸x5 9_eBl/5⮻o//OG溍CU3
+a!>[VxC鉃֣nmx`Q*=P.Dj"ӂ$ϕFh6u?h!k~ת%/tW	t4&[Wg,CUV=IVSzHI~kZHI32Sg%x8sK|s@h+<C]6q/~W[h]%bH<,-jνԥ,M?(k*nCǄM}k@  B"7'5SX՘nltVܝf?wArrbUI,<嵼!{l/c\`0`eM6oMysX*;OKlD7-wMx#Jha9 &)Ɲx`q"/x81'?N= b"& Lal^}%>!R!&}SL9O:KF-A;]/x/vVc4Vx'a:fQU̶[_2ƴ}^)ybX{]t.Dn>i)%E5>禔/"]^>ܺi/%O)D:c)7y];,.bMI8Z?0s-Wt.ty$4q9fmP_{H$q*JqMWOg6xc$/=t
+rV8pQ/9>	פ1ޡQJ%"!vLʇX]䊬ϐ.@\W]uQHH/7m޲[.qAQ	G\ro-W͇c52J7,uDi
+ĵcx	Ŗ_K-s<~?6悯w]^iMʷBAzg&Ѝ82ix!0-h6lM?pхҳ{ZrK+QeYX5>xylxյ6]lĿ~j)ʃm;[%<q2278h$/ª;~eFīd!f0(ΞpÃEHEۋeIENb_[IMR{̍ff9TadtsRqBgН	 l/J}(}iӔc<X]b{%l"Ox<m}Tw@)
+t=Vj$;ɗ#mt7$R,-O{;ڬm\jZWb,VnVr{5
\ No newline at end of file
@@ -0,0 +1,13 @@
+ OM1_'(,LK'\>ɭacT^i<1Ђv#.ЫX^ʤ¢%s>|jH'Yې'jm;\0l_=;LcUͅiN
+-hL&=E$F7'0,j72r?מ٢:oV:n44Q}+*n՛P:r`i_#(t},^7OkZJwXfIG	dIK!):-/3Hg]GRJ:?ǯr1^Gנ Mσ+N/s%79*9Yf}nzG}]WqO,3\	bo9*jmDj8Nm\u`;bUsQH-|~y}09<-6:VeUN!)DѢ}+l/Ӿuo!olM,HCH X^DY*\ICGQBQF讇~4)EQS?vߓszEwCZxkKsŅ3u8俭w1,>1S&ġ!W"&К1ƸI:"U;g[X6/|iǳ.܋>r%!*6*߯L}☦#@$4 |,ݰTo~;Q7Q}xQ~.."?"*'[zvwOѺw!PGЏ,E5T:SC3:}A%5|5w3ubPʵ	H03"CU.	|W>6b"/;Q8BxAs~Lq'Eh9尢."|~zǒ,ټԁf}*-9=7LQ~Dh6ʪ>Ԥ^mv\lfV ĚT
+ՖơckRm*"T!9S[¸lXu7ZSpJrypvgNE򚏅)t}[im3&#,`@>m8!jKsuJ1LL_O4^Kec@y$]g9%]&x𘷞}]8-)pU<Q(pWp5̋EY+%J
+67&C_]l+/JW15pnpNAϘ	PqO'nzn$dNκS6'uqh3*OT~L8zc/">"CJ-.]`x+Et|Mhz<]I+qy gpeCШcXC^ۿ{iQt$W]X̊DX7Wd׆YҞ)0i>ʈ:.)(ٸWA}^vfn'T<	<L$O.Ͳy ex:;ƝòF/ȴسXtt80z'C9Vyȕb5
+Pg=<_Sg7p~hZ9=KX,NUF?";S&-7%V8u^btX]fǁ:+/81N	tokpy.yT40ˌ??b".Xn2ƼO
+bT@G8r*:yME$PjN&Z;W3qtip<K˭,fo+~z&	_Ϟi?jFnΑ
+:Q@_@|J޿y(%9? %=j?g'鋀?d!rozzf.Dt
+AAnBt\5=Q+m!li3(Fl9ӃvfluL7&3+#Pv](pS Iόu_CMF&Sz1w|@D;Z#eb/V,sYh$(J6/k?PP'eYRעÐsdڞ4ZݦTd)% ]{nk/U}<9ƗVHCnVPwUWԻkzmvPZҏ	ɢeb	f6GG̀aծWf~>fAP?UN>JRNhPw
+!S)5V5n''G'?t#?&OK93"$EcmlM!	KO]A-]<E(^,2=t	R~ݭN.Bi
+'@GUJvg~>I2H4I`嗪ǩ5а\e2K?A}΅KFU{!Uzˈ/][IJٝX˛#Q:Td6E>F.:nlӭ	Bٺ*)tg2zVvB)`lDpUu!eZbbj2
+HKGIr"S94.ETa[4\]Rꩋ<³0J<PE[18ZXk:M.H bum&e֊ƽMZ$,]ǉt{P=bxjh*vflw,Lˉ6q7^eGߊ|dL~}dcu
+UBV7]^0ǋH^(SdQ3ѕslgdh-`YwWH/k*}He7h2N19va>l?}Ny6[~/@~(!lwOoz(!{<8vl7sbd.\[J%:טKlIڕtQ-!W*;t9#/4C
+Rv5)	ԋ!͞fbDp,κ*YP$.	Bz_A9wKlۇXnԟ(ﺰ+o'!rnKzyѣ"lOTDm:ZZV~
\ No newline at end of file
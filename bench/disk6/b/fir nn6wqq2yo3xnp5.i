@@ -0,0 +1,2 @@
+,Βt1j:hSb"arY=K`bNuM5Ɇ-Rb\oNq_#8-hggPƿn=(d4"]],"*XbeY聯}@_Oy}li@~{ߥ5RuꂎͲ	YaXn',!*Z|o+M@ޤ)#C#jMsg"bL0@Dʨl>IW=3oeZ
+{sXCrNZV[At஺؄Ji&!+(, )9	_)(AtwF/XUwawxPIZEzcFk6NABQsV.de:$ͦ-9Z#(.koD'l6dj^DjnT{?%$Su+#G`zjr~hⰧ	'a1,,[w\%۶qwLzȼSHȤBdj\T*g"m͚<RJl߈E#sQ躷Y!CvXB3),TۧF{\(1ʍ1؃"Mƙ(SQbOj_\|
\ No newline at end of file
@@ -0,0 +1,4 @@
+ۏR~5B
+cP,'ДQSKiȲXGj<(SYeue2DyY՗V%1$	й~@Hn;[T)qO/(UQXٌ֘!(#?OFT>}}
+J)5-*q킕R%I%4fOKl#مB"3hik}1	5[$~L)gsuhh-*@@|Kd(x	#<%뿌n,w#eF&:q2>c IΣ<c]4/gVb46Vc: ݏE@raxl H޲8܉gÄ,(p<؏*zHkW5~HjX!VE
+yQ*]lqTOܼx=LFk5%MּVXi9AӍqo
\ No newline at end of file
@@ -0,0 +1,12 @@
+9;N#J҅:t~LU+%;5:?o[Y'AՏAL(;Yz)xArvv;$璤^냅#PCXg@շM0uC]AV" x՚0Q9CO>"%S|naAWC6M	zK7*@>Fb1ͫ(+%α?ﶔ'frJ'=8|i։IiRdL]WwoQVtv>\ANc+L#StMUXSjw@$|)3Jh_la=t9:r$;VDh[*Sş~9;d(]jK	YH$~D:e"mD>VGg51Bh!N=KemѢyX8WIc׬5͍dPt՜k\<ٗ}dZeWʥds9?Bܕf`<UZ&4ډ/a,+	l5-BsF";HRˋ#}¾lX-f5esLyYσ9:D?@hl
+ڊ@1WH~3SظVnL9Gpk\ ,^5!p3Z\]8.ZW-^w$vM?J0UU5#:S|'IpE#kぷ>Fdp_C]vEj܈($T*'tJ13C'yH6
+!g[0PN+V"aZ!C))p\sxcߕ.^M9n~uVNԅbL+j㧣K|Mꆣ픗65W~ m2_){'Ʈ&(QUqy	2s1C7t;O52XVqExTTgQ#tY_b,EazhzOˣY
+=/̈C{I1jC{RNx(@U\r_}l%@ۺ:mr?yU1/J`8JMZwڻklO.LVjǶ`Tb-eN䪊V4#Si-EiXs֯?:"߬JIss'`XyX{6RSXWz\ynNXr~Oᱢ^]UeELd-(F]BWm/K-P`=CAJn]Ihϵ4­>Oq-i!8rzg%wOJj8`$j /gC`g)Ga'rsg?b.}2!:R.^>#*$B{j,OڱyH=@~_<	(ķHKd9R:.JUpqa4Pm|sO`yy%YUfkHLW<w.Ǩ1l%:Ƅ4˷()PyлFBdnx{&G1&z%Ue@-GO~$x	QqZ&^篸*='A#R'bywJI3k45ԭإj3sT18c%˳ޑıSyOX4;oM׉	twYO=%ڑX46_n ܑ,Ң2|3Jn9!iN~QH>0.o
+0}3>qs}nHYr|P~$fZg*
+csa!.3rZǝ)#UH1;b
+@5x1UhLQuǾg!ST	4r̢ԉ͵sX~r5K]ig1vsw4W?mFuj6p~."1#;Ss8UbSz[
+@1n*rJ=Afо[O	WP1\rʰoG pPtd'?tЗhcM6Zq?C]	1mSZU}h.=Ge;
+x[6v	^ ::5`^>Tg]!ݝ?`(i2.Rwo5(!@YX	B_YT-bPUBm`GBc%Ip}Vsauv=琾q}b.~68G5LJTK&)KNf._8!j-JCq{frGzLR|
+C-ޯWցz{H5a$2vXr1r"	圞zCzf7jкU!Bw4$tuY}E&;BnbgqSk8(h':3oLH#uРbPz-T}X܅,ucqŷĈ̴FV׭>qLDyhݝ~יՕhsϽ&NkX4[I!L+tS"9wܯ0-ʱi`?cF<&þnO]~g3ܞێ~¹2e{'V%-s?jtig-OBtgaBhT߲y e)و?S]{Uqa:p21pgBmڰ0opE>x3GM0H]'5n*oi|V
+&ڬ:*ͽb&>wӞ=h4Cx"S3NDZO|S Z!ˁ`:6iʌ_ɀ,_ů<9\SmL3Q6hAz9%B_	7wc	\{¹)v{1OЦ!ۚ^&8B~#ܝ6Z\*<
+Z+hI|cg=^<4? 400xh77ȋ7DfKōYm,h05Uu]Jw 406EX;b~K5wa	+x^:A68mA鼠!xotKPw幘[gQU	zyXjz<c``XzzbSf;eM" 􋅽(cLL 7J]Co@evQ.lU
\ No newline at end of file
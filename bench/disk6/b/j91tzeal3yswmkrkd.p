@@ -0,0 +1,4 @@
+F)qsv%fL)ӋJS& n]{EL1m}뎬PZ8a+GWv4XlԾv,>=cCa<y:1j>;zA˻3YEOV`jH<(컿yM#߷{VQo0٤IaGXdlK"*
+áFh]+s+YD	|kPk4jy0@(?9g(WMQG>($E&
+A9ҼSOAU2H+@,DjK|W&z%9Uk<3gCLn:e+*JM
+ؗ'] #Eo1\`n#hyՈ~TjLb2D/(ixQ'? 5ް0G1$HZmkxW>.j/6Ɲ΃>uz	hC
\ No newline at end of file
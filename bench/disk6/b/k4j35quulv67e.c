@@ -0,0 +1,16 @@
+5rBf{b` >S$/_ő?vi|_[+P'mُ)jBFQ;7[qXOR*0O۷',mdee+e_`q@WBZ*a=x[E:B5ц☨)ixLJ1Z<k\[O\)WĻ:sjf&KL_yJK
+5旹_`eٻ_ep9t]_CyR/FwV>\"1?;(5;{" 	6c#tF3v!k\;*`y5(ɥ@/Ehqwom[-I]<J[L&OA@|{zd{^BT[j~.q!ۆeM@V%?DudMW/3rBCb-lTiMG9pV?Y	ᾬg^L0෽I]H	2S)NW`}nP/ks)goE*3xRBZ|Fd8u&=hn+֡#@LZك[g]!=y[+W6ONEK&l=gS(9/K+G}iÊ$`e"bl{:[xXʰ/44%GizE
+<{9]?6A͓$55U1~*%m}7Oxa@UJ݌1(_ODrER$&RLZ:m"]{C񂏃LID c=Hg#Z)B&t8ba,rѿ?s +Kk~aqᩧDdO#>րj`нSm<T,9hn=RsDR:JϺqgwkPKvX[[ Siןe9@UwzIq߆ri
+_Mcs8LS9#mXcTʐ<؊b~ QU) Bn!^㠰S_][n˨-l.FwK%W|#
+I][yU,pRr;RgT\c˵$\6xԕOau6jH^\%ze^(in<,t=w~&=r4<w+)Qx 9f3Xf,iV8@ò+p.乶M9_>8)#wv/Miqnv?IHcѫl
+	DWsY;	ӷ
+"1iMXʒVWhSKB'i	Xd'}f}HK/ۺMGKFB5%N$:[^b6ć/I_}JUh?,^m1UZ,Ud`hp3O3nU3s*[\g[j=w6I{
+Q!ܖm3ޮ#|L%hC5Źn7PM숅	Pпg0G|BhjNFst}'{iD thU0;W"zZ.o6p2"b勴V3ڸ:<A&H3w8w
+f	زIql68"@+8*Nۄa;W*dWgP|7LU-<Xލ22SkJr!:_<ir)=';$ξ˫2>8̋"}7w|x)LQiSPϛ+#H
+H=o	ߞR3h>ҒH!<[wei[S	pB`4wU^-y¸X#@:9=]{(-hщ/Nme읓@FazO&t!zQC߆P,FM漨rI^DZ]lǫTIIIg[P{e]=arM#dv=qF8$&8Rnw5	oq	4.y,$tt-`ƙ\ +Wgkq.N]e;HkjI5ff{%?ptw`yMFW*5MCޙI?̅KErDQU1F13"%YR'T*qiatS!pU*l;Z^I]M*}%McPKڞSc&,YE-O7V$)2|> :+D+bE[=E|2py9ؽ0[70Hvξ.ƣ@jOks!@jKgtVQx\:{)[-N:.#'zdi,V;0gŪ6G}Ha_mjwWq{PXRTo91ރ8}nqXV9ZnWL&R#p'fcGB	h,nbdmL<hJj}bT%F4#їKo6kt]Zʉ[):^J }Mگt7ς:'t	.pwiN.fH<	Vۭ[!,_ٷİFF+E=H|jkN%sgѨ"eKhL
+#ck,U(Q,5:WOP
+|u\O2v,hq]ֳ#OzS+sZBvfi`o(\::zN1>&{fdc/6y*{A-]zTM
+kJff<1	\L/8"FZqsn:!Q?.>ͤϿ
+p#AˌP]`漠*^Q{r/BK~nB0`b'B/Bt]~Nq
+y`,J,v4
+OꉻA{ŏS@TNJ捬`[ΤRhRB,f{&t.c[Qu;k)ɿhCz%
\ No newline at end of file
@@ -0,0 +1,15 @@
+|?Nw!Rǧ@9GNV9@8mz,W}j2m!OF/4mOb*ǜhʳ?72/&3F~n.f.
+$b"H7_ȰsM"m¡9zT./,5y-ۅax??'kyAi[S}ښ޶K-ؔ	Q.xW𝏕t?s4Xq5A~)c
+Nx
+ޯsLlW
+GG{pTg	.8GnOiވEz3|N}Fr|֣оK|氁iwIh׏RwvG婏}̸hh{D7Jzapijub܆G,,H[0V2L*)4fB(lZ_Cn<"󷎫/8vk1n=я3):9?"z`Mo0Zrej%_t`yv!,[m%یh
+q#!T݁BU#e,%OT_s>R!LG/q1\257td6'vϿ$50BboNruZr{ώY!_)=iwY'@
+o9lAխ-UHd&Sp4rWT?POz^92>"&wEˌ?n2GNMXa*rq[Tܠ::żAZv C*y^V1HȦ<)kQ+g<؍}լGytQ>*=	EW+I0F	l&FSN=DxN&=ȺA&Ό!lm%~L"*`4ϰB*vx=Mil
+
+,DxT>\M\jR\⶚Ák+M#8M/4dd^c:(\}[&YkMGE{fp/pRcvd=يpގ>~;ou$!]qew;,ā$#kqNC-ҝxfxAr1$Ӿ	W`t`xw
+jt暆=kUknBcp΂T&`R!@a0%cc}!D.kӱYoK>1LCrkX9PDeݯAN\>IxCwFKCCA^5re_Zz/m2#셈	a3[ķ_:X/CڦMބ1^ ^Uh8UW7#c$Dc?f̥-AGKӀ
+º?6	,W?noO6+
+u8ͼKQ~^5<Hxb#p@IpYדpɋxPqDfg?ޖ]/(=֊TMj&gr'xo
+ IJ FMiv,ڭdZ:PW-~gm[.?R3U6,~#K8+&'%	y@!u{ GsDPJjHt%;AkĊ#@,8:#qz5
+&'"%T'3MnXІQfIXX@}{%IUKXAp#{P*p!=Qy7\(%؛Wakn)__/_M6LM1"M2]lXQky<]m(>qvhzd}f;> VXp	jB6/.l.n
+-tyfv\Ul7²p0rTNɹ&Y4^/z?	}:(Mjဦ;!<G?6>q3RE
\ No newline at end of file
@@ -0,0 +1,3 @@
+F2|=4kT	Z+1_˾]-01yB}Y9ѠDA;cM9@+$=EÞNaz-*NOB<Ovii7a(]bU)ntNOz&,d6HAṽ<\ę&[ ;㠕?2'u@SBm%F;v5rɤn{YRZR+8Tt,k3ȵqA7:	֑OQ"w|:bL$OHe=B-Hky!뿠
+ղ{QY2}F1+Ǉ2Hi_F"
+q"eOIa@^U/2DKdl]F
\ No newline at end of file
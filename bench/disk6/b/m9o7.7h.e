@@ -0,0 +1,9 @@
+2U	e/@ZNwJ]_Ie/V}:1!P(W^I:nXАhRC޲^})p^0sauأIa礝HQhBXPJ(LrDOp/eZ-̹6aUFQtkbлb3j9>S,&CB
+Y@oހIDl+J&#GLމA57[qq98}{ʴEǍ!4u}ۤ}g4橫H0X1ZԅhFfXJy'㚩i;jVpw`~!oXϮ`ekЗXYT4w\)-3/6O"yEFgy"Ak"{Èm}{=yGCb	hktbPQtF9Fc׸b髙qsXavScBmHGCX4AS9ވnOlw:xDY됝-(~JՒeo7!ݛbh:"i9anqZ=t*L9dmb[#:|		14U6Eݕ'HnbP{0qn>pbܢ?Gqb*{L.1|/e7FN+Yf[)P}-뛠|*H		'g"c#KdėWoRsR2⮈2N0LNq-8OOp8c0ǀmy)vJqݹ}aoa{:!3e\zF 5T5-N5lcJhm՚oXSḞLS51yZtX߄0*,[%;^*8 J<-#L~@FQ|;AYM<=84|]NvvJԇtUpO.9oQx,(9.Ul`ZF$(
+U)a;޼$U^jp;LGQodN:PWԐyݟ*P7Mk52V@R*BA)h=f{mi?^FNY{tέK{@Gyo2@>UWm\w?XQuPgL0o5ec%uj?{ˀ︠(8;YOv_&3m̉|εfXqb%հ2}nTu7ꛛ个>->1'Ǒ>[,\1["`P]_o=FbKKW/x>!o9LסΩ0RNs剑5R_ixd4kcTg`m"8dKR9~P?.պzDta;Юa\]b$J7g-.&"%,%Y#8/n~.S*b@YuJ?ҾH.g<vmkHX+GdaR)"eh3}l_Yx7xMl PUc!1	omDωK~o֩O"Q҂p:=;;mj⩂@	~=(H/mBX["VHG<<tm%siJƼ"īx=pp"aH
+;E(t&v|T)M0TwHh|J{\#T3壏*2l4vNqhnv݁:8w(Y'c%;#m0m,Y[ux*e~_<i
+㗑yIw	7͘CPbN'fmZLƥ0%dd|M4@NӤﺣ"V1.6o>y!b<^XJ[w7"_B.#,|{r֪r㫲hCu4=bT>v*mxݣoiOZYݎ[t@	`q&P1[ƾPۉ ]эS	:x;"jTOmsu6fm&^l^#5ϵǘr_]ʓJ5M#l%d&	1U/l_rd٫^vJN8h
+<[ʘbC~ވEZ̙x"&_\
+Pr7mɱ4V9j9ׯ~uKQވqn)raTu[.PYap|H;+lQi/ݔT#1dIϮu:ʽW$1@N"}4_BbM)h590?#L}#;-LjMA>Ff?v_lN<3:v٤ԛPxv85}2swQ_>3$,_ܭY8up,^yڒh{QzLR;!BB8y\ԉq<*bamx&?+43qZ	~243UJŅq 㬇^0PE6iF쫑P<I}Ha3+0aJzqD{'^:؍bj2Qa8kA&[wn^_(z֞-{D$Qn Kiք.RD+[׾qw?oEn쯆 ڋ*u<N#yUAP?& &QkޔD؃$M0SI3v;(NXuwz~$_y7S[cP-qr]ɠB<{4"=am#xl[vn׌4F%(_r]G,2ƞeuzE@{lrdhX<]\4b|a0\ɁXIL/D'!fM_ <Rk`e^ CO\߶ໆuZ?ޮ1_Lt`}Wqڎ#x߯:	I,O~
+f^?oobiž!m}0z5߄h[&3ݻGOά~.wI*svB1*1c>q:gc2ifr36:
+P'dpIW~p_[ڮpeL}`j4P(׺؃C<)S,Xsd&rAƠR1>2rZ%[hb,إLc<JyM
\ No newline at end of file
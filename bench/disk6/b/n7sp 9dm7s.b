@@ -0,0 +1,11 @@
+ѽujbs
+Җp]$-u+K9=,_4wѠi	߿M)$_yI9(۷$DOq	z6&4E]bE,^	k@Gܖ,PLyA&?^ˠ
+pSOKjĵM)zԑc8\,<У/Uo+aXQW
+Ph6^Y][^JdH^4iatB"џ-s]kFx`0f._:<WV?LY:P2!9ZX2WhttTde{rsGNͦo@*YO?CqrSEIsFQ?ͦpFh̏#>"u&7a\?u:hO78p ̝%1,ud;[F~克JE(dOsQk?PXC2?&J"K!꒶k'kpZV`blc4Vc ~':ZIve_
+9hc$=UQC+[7TQK];;콺|ǭs QUh6xv-H8JR#	l⧽JL0wf59T*w #sHsvf!lD2`QjG26TDkt5vs1@YˋuiYJza(2_Mdlh(f#YÅ6-cȯfL^bN3í8X@㶡|Òĉ?<o!I?KVu4;`kܳ7})4)̙kZFيV1]_v7V:|s)-r
+|!aE=-6b@%z W.BP&6c^l!.v:宼҉Z`ljSNrQ&pJ,d}ڧϩXJL%V'ԆZJ7ιOײs2\vя$kũfe~c1)-Ykmh(y昝 #2<4#5b7+zy\3ȐI49ԱUǓ
+'ӗ)9I.:'@^3AO;u[nϑn'ڼ@LqZJС\>L3kbgCj'Qw}؅J},41}Eh2<fAl#~DL,ES!a9/ѸMԈ;.w@Ѹ|;$hm˧),rx<hx+
+(1ĩjEAK{vFpo4cs]ZGo0?z.'xZ IcmK9#SeJK4Y[JZif$Dy0_~"^<39¬ѽy$RL=h[^ =f΃S)z &i,^F@OUeZ):n" LFKq[Wf/._|bmlW^mm,gԇbrgQh,)̻%~?X6ׁzL`A2L',E`1ʾ"=7ث11wl:x1$aEqbb؎&nsB(lpٰ7OoC^<TOT7âp#=XmC`}M+[6
+z@T	JT;tRaˡ	2Z[/hvPSFyQ8iYg¨՛hq췄`шJT/[jhKb9QU\L%c}+$*TAn\/D޼mq͠9kZܓ6at8j6}4!p},6czxqTDǊSYPn>7_,jloT3V10QO`&doQx*V§e
+3j8d).n5hQӍ7am|;rXU6TR%ۤcOpBkݻ٧|P{٣s^dTHI<ml|ɺö00{PobU0Cn;qV~0WeҞOjU;+Ѹ92Hw/=ꆈu"#^\#L#0OD:){EXQN2jO}ҟkP'泞f'
+iOdy1ޕevjҖ.H+Pk3fzd!uimyM!{rS%'$yŪpg0Vs>o/?G6N0bbXԚhXW8|.UUJaӳb9"5]o8CX̻)*A}%Ηn7\Rt(NY'`L$^,LM%D[TFc3*B	V13K%Q}dF&[ \
\ No newline at end of file
@@ -0,0 +1,4 @@
+}nQy,]]R34RCZ-Va`o\97PQn<Gd/OdRޒW4mɅnTn[@7LNgZ	{T4>'?v5oWJIV@>Ő]s$':|ѳ4.vnUj##4]f6˔
+'yMk.C/I<|f#+uVu	%	\Hu5,{(wbjܟm%mI%5	JM(vh$RX8<$@>:1Ddz`),pk+ݾyiM}^gRqgMB]1HmӾ'>󓈱Y)>ԀOotSݢRw\ NQ]<O]~ь_V=ɳ,푺eMdxs?Xr`Cavy`2tV<Y_1kD&@co>ة"DQbR☑!YԹ s\40>|tiddcЋG",L L&<'[kvte>HEE3'z)DfnA巸Dx
+ϘJ^<B~4Y=L6ulo|?z;9	Gɣ=4Unywuh.2ށ'z (7M1}U84z'!8fY٣'\!^Nf/$ocɏL9@'+m?Q-Հ}Եb*20\:v7^$;\o1벗PCqnQY+'g bwC{%,:;Tىy-U}d;םq$Ϭutr3<;~T?criϢu?ЋZؾ翘4!b5ݨSA=ug@hhj_eX8a^ҁL&(qjSs	8vV2I>ng*0pR1~׈C?dq[n01y8uȸ"X.46+J\P<;\^^Ʃ<lHݚrc_zY( zʸsD*LD`VM&W)UXqLC d<XddrMNaa`4qy Hj@q(}_,R;z)Mh.oƯ1FMA*ȅ>;)<ڻD3.ӝAFn0RUNv4≙&VV#Qϸ45Ȯj55YkWlCRUfa|*ᕘ_ϡ+YSCt_HSM!,JE-&·*xknfr3]j'YBU{,俀8sK$WAcQY}Ӕ$dkϩ(DѰw\hh푙mȢ^zXnJ9#]DIM`.KF%y^r]4uZ1]5g6uq3s4=W}7u4(1^CHK<NdHΊgh^B=sE]VeٍGu<
+ދ-pRpiㄙٰkCcDd8֑4B[LoąmO^6> ^Ã;w"gk2@rGGdBZ_H&-[$13WeguN9l؊;i)TpW	0󳟠ʗ);J#z8Rgf"y+WeF֚QDBD>ݐM<RGb}r)hw0:*0a\'=KJl,Oh6ׂ۪02Xz\xI$g/2غ7`2OzvQ9nVCQ93LMkXQi	)e~QSO@|mEx3
\ No newline at end of file
@@ -0,0 +1,5 @@
+}z4ڒ/R3Gk<hͦIf6EzMӈ[UBW+0lcP(W=d91-$۰43<Lhj?G1Y?gvd򧒊a=bG#d;\{f;gœ3`̰/ Z8ԚZI|̠mdvehd5fqݞAEo5BCu-`4'Gkr*6_Y]
+(*@d-=~n5Ld2N'wjy9.`dd3qﾆ=Uǆ¥Bb^P2.ꮮEÑ$jQ3sQpQ<bXY~FV	7<8Gb[=Wp5**)^A]Sg|rC[jt.[wϴFYKD7
+Vtf6b	kE3W[U'EofZN7Px1
+Q?ߖ0FE
+-ÓܭUl-`O"wQ{wuNgž/2-Qݼ1P&ʹꕥ*^2_ϫx\ :~:mlW&|FyP\XmmNO^a$7hQIPqP6#'Sx2_$2!V"NhzUXLZ~G'Tl]fG~n]cλj7vIe/Y@VHVFs[S8hL=x4Ú6P_Q>j}=*yOumá¹،&GIBT >"pK
\ No newline at end of file